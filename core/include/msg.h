@@ -273,6 +273,31 @@ int msg_send_to_self(msg_t *m);
  */
 int msg_send_int(msg_t *m, kernel_pid_t target_pid);
 
+/**
+ * @brief Send several messages to the same thread.
+ *
+ * All messages that fit into the target's message queue are handed over in
+ * one go, so the target is woken up and the scheduler is run only once instead
+ * of once per message. If the target is waiting for a message, the first one
+ * is delivered directly.
+ *
+ * Messages that do not fit into the queue are sent one by one using
+ * @ref msg_send(), blocking until the target received them.
+ *
+ * In interrupt context or when sending to the current thread, this function
+ * never blocks: messages that do not fit into the queue are not sent.
+ *
+ * @param[in] m             Array of @p num messages to send, the
+ *                          ``sender_pid`` fields are set by this function.
+ * @param[in] num           Number of messages in @p m
+ * @param[in] target_pid    PID of target thread
+ *
+ * @return  number of messages sent (less than @p num only in interrupt context
+ *          or when sending to the current thread)
+ * @return  -1, on error (invalid PID)
+ */
+int msg_send_many(msg_t *m, unsigned num, kernel_pid_t target_pid);
+
 /**
  * @brief Test if the message was sent inside an ISR.
  * @see msg_send_int()
@@ -310,6 +335,25 @@ int msg_receive(msg_t *m);
  */
 int msg_try_receive(msg_t *m);
 
+/**
+ * @brief Receive several messages at once.
+ *
+ * This function blocks until at least one message was received. Then it takes
+ * as many further messages as available, up to @p max in total, without
+ * blocking again. Messages from the message queue are copied with interrupts
+ * disabled only once.
+ *
+ * Threads handling bursts of messages (e.g. network packets) can use this to
+ * save a round trip through the scheduler per message.
+ *
+ * @param[out] buf  Array of @p max preallocated ``msg_t`` structures, must
+ *                  not be NULL.
+ * @param[in] max   Maximum number of messages to receive, must not be 0.
+ *
+ * @return  number of messages received (between 1 and @p max)
+ */
+unsigned msg_receive_many(msg_t *buf, unsigned max);
+
 /**
  * @brief Send a message, block until reply received.
  *
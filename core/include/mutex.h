@@ -91,6 +91,25 @@
  *       `MUTEX_LOCK`.
  *     - The scheduler is run, so that if the unblocked waiting thread can
  *       run now, in case it has a higher priority than the running thread.
+ *
+ * Priority Inheritance
+ * --------------------
+ *
+ * With the module `core_mutex_priority_inheritance` the mutex additionally
+ * stores the PID of the thread holding it. Whenever a thread blocks on a
+ * mutex held by a thread of lower priority, the holder is raised to the
+ * priority of the blocked thread. If the holder is itself blocked on another
+ * mutex, this is repeated along the chain of holders. Thus, a thread of
+ * medium priority cannot keep a thread of high priority from obtaining a mutex
+ * by starving the thread holding it (priority inversion).
+ *
+ * When a raised thread returns a mutex, it drops to the highest priority of
+ * the threads still waiting for mutexes it holds, or to the priority it was
+ * created with. Finding those waiters takes a walk over all threads, which
+ * only happens if the priority of the thread was raised before.
+ *
+ * @note    A mutex locked from interrupt context or before the scheduler was
+ *          started has no holder, so blocking on it raises no thread.
  * @{
  *
  * @file
@@ -127,6 +146,15 @@ typedef struct {
      * @internal
      */
     list_node_t queue;
+#if defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) || defined(DOXYGEN)
+    /**
+     * @brief   The thread holding the mutex, or @ref KERNEL_PID_UNDEF
+     * @internal
+     *
+     * Only valid while the mutex is locked.
+     */
+    kernel_pid_t owner;
+#endif
 } mutex_t;
 
 /**
@@ -145,12 +173,12 @@ typedef struct {
  * @brief Static initializer for mutex_t.
  * @details This initializer is preferable to mutex_init().
  */
-#define MUTEX_INIT { { NULL } }
+#define MUTEX_INIT { .queue = { .next = NULL } }
 
 /**
  * @brief Static initializer for mutex_t with a locked mutex
  */
-#define MUTEX_INIT_LOCKED { { MUTEX_LOCKED } }
+#define MUTEX_INIT_LOCKED { .queue = { .next = MUTEX_LOCKED } }
 
 /**
  * @cond INTERNAL
@@ -171,6 +199,9 @@ typedef struct {
 static inline void mutex_init(mutex_t *mutex)
 {
     mutex->queue.next = NULL;
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+    mutex->owner = KERNEL_PID_UNDEF;
+#endif
 }
 
 /**
@@ -231,6 +262,10 @@ static inline int mutex_trylock(mutex_t *mutex)
 
     if (mutex->queue.next == NULL) {
         mutex->queue.next = MUTEX_LOCKED;
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+        /* a mutex locked from interrupt context has no holder */
+        mutex->owner = irq_is_in() ? KERNEL_PID_UNDEF : thread_getpid();
+#endif
         retval = 1;
     }
     irq_restore(irq_state);
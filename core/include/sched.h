@@ -198,6 +198,21 @@ thread_t *sched_run(void);
  */
 void sched_set_status(thread_t *process, thread_status_t status);
 
+/**
+ * @brief   Change the priority of a thread
+ *
+ * If the thread is on a runqueue, it is moved to the runqueue of its new
+ * priority. This function does not yield, call @ref sched_switch or
+ * @ref thread_yield_higher afterwards if needed.
+ *
+ * @param[in,out]   thread      The thread to change the priority of
+ * @param[in]       priority    The new priority of @p thread
+ *
+ * @note    Threads waiting in a list sorted by priority (e.g. of a mutex) are
+ *          not moved within that list, this is up to the caller.
+ */
+void sched_change_priority(thread_t *thread, uint8_t priority);
+
 /**
  * @brief       Yield if appropriate.
  *
@@ -278,6 +293,67 @@ typedef void (*sched_callback_t)(kernel_pid_t active, kernel_pid_t next);
 void sched_register_cb(sched_callback_t callback);
 #endif /* MODULE_SCHED_CB */
 
+#if IS_USED(MODULE_SCHED_RUNQ_CALLBACK) || defined(DOXYGEN)
+/**
+ * @brief   Scheduler runqueue callback
+ *
+ * Has to be provided by the module using it. It is called with IRQs disabled
+ *
+ * - at the end of @ref sched_run with the priority of the thread scheduled,
+ * - when a thread is added to the runqueue of @p prio.
+ *
+ * @warning This API is not intended for out of tree users. Breaking API
+ *          changes will be done without notice and without deprecation.
+ *
+ * @param   prio    The priority of the runqueue
+ */
+void sched_runq_callback(uint8_t prio);
+#endif
+
+#if IS_USED(MODULE_SCHED_RUNNABLE_CALLBACK) || defined(DOXYGEN)
+/**
+ * @brief   Scheduler runnable callback
+ *
+ * Has to be provided by the module using it. It is called with IRQs disabled
+ * when @p thread is added to the runqueue, i.e. when it becomes runnable.
+ *
+ * @warning This API is not intended for out of tree users. Breaking API
+ *          changes will be done without notice and without deprecation.
+ *
+ * @param   thread  The thread that became runnable
+ */
+void sched_runnable_callback(thread_t *thread);
+#endif
+
+/**
+ * @brief   Tell if more than one thread is in the runqueue of a priority
+ *
+ * @param   prio    The priority of the runqueue
+ *
+ * @return  non-zero if more than one thread is in the runqueue
+ */
+static inline int sched_runq_more_than_one(uint8_t prio)
+{
+    clist_node_t *tail = sched_runqueues[prio].next;
+
+    return tail && (tail->next != tail);
+}
+
+/**
+ * @brief   Move the first thread of the runqueue of a priority to its end
+ *
+ * The next time threads of that priority are scheduled, the then first
+ * thread runs. This does not run the scheduler.
+ *
+ * @warning This API is not intended for out of tree users.
+ *
+ * @param   prio    The priority of the runqueue
+ */
+static inline void sched_runq_advance(uint8_t prio)
+{
+    clist_lpoprpush(&sched_runqueues[prio]);
+}
+
 #ifdef __cplusplus
 }
 #endif
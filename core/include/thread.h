@@ -121,6 +121,7 @@
 
 #include "clist.h"
 #include "cib.h"
+#include "list.h"
 #include "msg.h"
 #include "cpu_conf.h"
 #include "sched.h"
@@ -192,6 +193,12 @@ struct _thread {
     msg_t *msg_array;               /**< memory holding messages sent
                                          to this thread's message queue */
 #endif
+#if defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) || defined(DOXYGEN)
+    uint8_t base_priority;          /**< priority without the ones inherited
+                                         via mutexes                    */
+    list_node_t *blocked_on;        /**< waiting queue of the mutex this
+                                         thread is blocked on, if any   */
+#endif
 #if defined(DEVELHELP) || defined(SCHED_TEST_STACK) \
     || defined(MODULE_MPU_STACK_GUARD) || defined(DOXYGEN)
     char *stack_start;              /**< thread's stack start address   */
@@ -33,6 +33,7 @@
 #endif
 #include "irq.h"
 #include "cib.h"
+#include "trace.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -94,6 +95,7 @@ static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block,
     thread_t *target = thread_get_unchecked(target_pid);
 
     m->sender_pid = thread_getpid();
+    TRACE_POINT(TRACE_EVENT_MSG_SEND, target_pid, m->type);
 
     if (target == NULL) {
         DEBUG("msg_send(): target thread %d does not exist\n", target_pid);
@@ -202,6 +204,8 @@ static int _msg_send_oneway(msg_t *m, kernel_pid_t target_pid)
         return -1;
     }
 
+    TRACE_POINT(TRACE_EVENT_MSG_SEND, target_pid, m->type);
+
     if (target->status == STATUS_RECEIVE_BLOCKED) {
         DEBUG("%s: Direct msg copy from %" PRIkernel_pid " to %"
               PRIkernel_pid ".\n", __func__, thread_getpid(), target_pid);
@@ -235,6 +239,72 @@ int msg_send_int(msg_t *m, kernel_pid_t target_pid)
     return res;
 }
 
+int msg_send_many(msg_t *m, unsigned num, kernel_pid_t target_pid)
+{
+    const bool in_irq = irq_is_in();
+    const kernel_pid_t sender_pid = in_irq ? KERNEL_PID_ISR : thread_getpid();
+    bool woken = false;
+    unsigned n = 0;
+
+    unsigned state = irq_disable();
+
+    thread_t *target = thread_get_unchecked(target_pid);
+
+    if (target == NULL) {
+        DEBUG("msg_send_many(): target thread %d does not exist\n",
+              target_pid);
+        irq_restore(state);
+        return -1;
+    }
+
+    if (num > 0) {
+        TRACE_POINT(TRACE_EVENT_MSG_SEND, target_pid, m[0].type);
+    }
+
+    if ((num > 0) && (target->status == STATUS_RECEIVE_BLOCKED)) {
+        DEBUG("msg_send_many(): Direct msg copy to %" PRIkernel_pid ".\n",
+              target_pid);
+        m[0].sender_pid = sender_pid;
+        *((msg_t *)target->wait_data) = m[0];
+        sched_set_status(target, STATUS_PENDING);
+        woken = true;
+        n++;
+    }
+
+    /* the target takes the remaining messages from its queue when it runs */
+    for (; n < num; n++) {
+        m[n].sender_pid = sender_pid;
+        if (!queue_msg(target, &m[n])) {
+            break;
+        }
+    }
+
+    if (in_irq) {
+        if (woken) {
+            sched_context_switch_request = 1;
+        }
+        irq_restore(state);
+        return n;
+    }
+
+    irq_restore(state);
+    if (woken) {
+        thread_yield_higher();
+    }
+
+    if (target_pid == sender_pid) {
+        return n;
+    }
+
+    for (; n < num; n++) {
+        if (msg_send(&m[n], target_pid) < 0) {
+            return -1;
+        }
+    }
+
+    return n;
+}
+
 int msg_send_bus(msg_t *m, msg_bus_t *bus)
 {
     const bool in_irq = irq_is_in();
@@ -339,6 +409,34 @@ int msg_receive(msg_t *m)
     return _msg_receive(m, 1);
 }
 
+unsigned msg_receive_many(msg_t *buf, unsigned max)
+{
+    assert(max > 0);
+
+    /* blocks until there is at least one message */
+    _msg_receive(&buf[0], 1);
+
+    unsigned n = 1;
+    thread_t *me = thread_get_active();
+
+    if (thread_has_msg_queue(me)) {
+        unsigned state = irq_disable();
+        int queue_index;
+
+        while ((n < max) && ((queue_index = cib_get(&me->msg_queue)) >= 0)) {
+            buf[n++] = me->msg_array[queue_index];
+        }
+        irq_restore(state);
+    }
+
+    /* the queue is empty now, take messages from blocked senders */
+    while ((n < max) && (_msg_receive(&buf[n], 0) == 1)) {
+        n++;
+    }
+
+    return n;
+}
+
 static int _msg_receive(msg_t *m, int block)
 {
     unsigned state = irq_disable();
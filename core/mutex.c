@@ -29,10 +29,132 @@
 #include "sched.h"
 #include "irq.h"
 #include "list.h"
+#include "trace.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+/**
+ * @brief   Change the priority of a thread, keeping the waiting queue of the
+ *          mutex it is blocked on (if any) sorted
+ * @pre     IRQs are disabled
+ */
+static void _set_priority(thread_t *thread, uint8_t priority)
+{
+    DEBUG("PID[%" PRIkernel_pid "]: priority %" PRIu8 " -> %" PRIu8 "\n",
+          thread->pid, thread->priority, priority);
+    if (thread->blocked_on) {
+        list_remove(thread->blocked_on, (list_node_t *)&thread->rq_entry);
+        thread->priority = priority;
+        thread_add_to_list(thread->blocked_on, thread);
+    }
+    else {
+        sched_change_priority(thread, priority);
+    }
+}
+
+/**
+ * @brief   Get the holder of the mutex a thread is blocked on
+ */
+static thread_t *_blocking_owner(const thread_t *thread)
+{
+    if (!thread->blocked_on) {
+        return NULL;
+    }
+    return thread_get(container_of(thread->blocked_on, mutex_t, queue)->owner);
+}
+
+/**
+ * @brief   Raise the holder of @p mutex to @p priority, and so on along the
+ *          chain of holders blocked on further mutexes
+ * @pre     IRQs are disabled
+ */
+static void _inherit_priority(mutex_t *mutex, uint8_t priority)
+{
+    thread_t *owner = thread_get(mutex->owner);
+
+    /* stops at a holder that has at least that priority, which also ends
+     * the walk on a chain of holders that deadlocked */
+    while (owner && (owner->priority > priority)) {
+        _set_priority(owner, priority);
+        owner = _blocking_owner(owner);
+    }
+}
+
+/**
+ * @brief   Drop @p thread to the highest priority it still inherits from
+ *          waiters of the mutexes it holds, and so on along the chain of
+ *          holders blocked on further mutexes
+ * @pre     IRQs are disabled
+ */
+static void _restore_priority(thread_t *thread)
+{
+    while (thread && (thread->priority != thread->base_priority)) {
+        uint8_t priority = thread->base_priority;
+
+        for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST;
+             pid++) {
+            thread_t *waiter = thread_get_unchecked(pid);
+
+            if (waiter && (waiter->priority < priority) &&
+                (_blocking_owner(waiter) == thread)) {
+                priority = waiter->priority;
+            }
+        }
+        if (priority == thread->priority) {
+            return;
+        }
+        _set_priority(thread, priority);
+        thread = _blocking_owner(thread);
+    }
+}
+
+/**
+ * @brief   Hand @p mutex over from its holder to the waiter @p thread
+ * @pre     IRQs are disabled
+ * @pre     @p thread was removed from the waiting queue of @p mutex
+ */
+static void _handoff(mutex_t *mutex, thread_t *thread)
+{
+    thread_t *owner = thread_get(mutex->owner);
+
+    thread->blocked_on = NULL;
+    mutex->owner = thread->pid;
+    _restore_priority(owner);
+}
+
+static inline void _set_owner(mutex_t *mutex, kernel_pid_t pid)
+{
+    mutex->owner = pid;
+}
+
+static inline void _release(mutex_t *mutex)
+{
+    thread_t *owner = thread_get(mutex->owner);
+
+    mutex->owner = KERNEL_PID_UNDEF;
+    _restore_priority(owner);
+}
+#else
+static inline void _set_owner(mutex_t *mutex, kernel_pid_t pid)
+{
+    (void)mutex;
+    (void)pid;
+}
+
+static inline void _handoff(mutex_t *mutex, thread_t *thread)
+{
+    (void)mutex;
+    (void)thread;
+}
+
+static inline void _release(mutex_t *mutex)
+{
+    (void)mutex;
+}
+#endif
+
 /**
  * @brief   Block waiting for a locked mutex
  * @pre     IRQs are disabled
@@ -58,6 +180,10 @@ static inline __attribute__((always_inline)) void _block(mutex_t *mutex, unsigne
     else {
         thread_add_to_list(&mutex->queue, me);
     }
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+    me->blocked_on = &mutex->queue;
+    _inherit_priority(mutex, me->priority);
+#endif
 
     irq_restore(irq_state);
     thread_yield_higher();
@@ -69,10 +195,13 @@ void mutex_lock(mutex_t *mutex)
     unsigned irq_state = irq_disable();
 
     DEBUG("PID[%" PRIkernel_pid "] mutex_lock().\n", thread_getpid());
+    TRACE_POINT(TRACE_EVENT_MUTEX_LOCK, (uintptr_t)mutex,
+                mutex->queue.next != NULL);
 
     if (mutex->queue.next == NULL) {
         /* mutex is unlocked. */
         mutex->queue.next = MUTEX_LOCKED;
+        _set_owner(mutex, thread_getpid());
         DEBUG("PID[%" PRIkernel_pid "] mutex_lock(): early out.\n",
               thread_getpid());
         irq_restore(irq_state);
@@ -97,9 +226,12 @@ int mutex_lock_cancelable(mutex_cancel_t *mc)
     }
 
     mutex_t *mutex = mc->mutex;
+    TRACE_POINT(TRACE_EVENT_MUTEX_LOCK, (uintptr_t)mutex,
+                mutex->queue.next != NULL);
     if (mutex->queue.next == NULL) {
         /* mutex is unlocked. */
         mutex->queue.next = MUTEX_LOCKED;
+        _set_owner(mutex, thread_getpid());
         DEBUG("PID[%" PRIkernel_pid "] mutex_lock_cancelable() early out.\n",
               thread_getpid());
         irq_restore(irq_state);
@@ -131,6 +263,7 @@ void mutex_unlock(mutex_t *mutex)
     if (mutex->queue.next == MUTEX_LOCKED) {
         mutex->queue.next = NULL;
         /* the mutex was locked and no thread was waiting for it */
+        _release(mutex);
         irq_restore(irqstate);
         return;
     }
@@ -146,6 +279,9 @@ void mutex_unlock(mutex_t *mutex)
     if (!mutex->queue.next) {
         mutex->queue.next = MUTEX_LOCKED;
     }
+    /* if the running thread drops its priority here, it drops no lower than
+     * the priority of process, so switching to process is enough */
+    _handoff(mutex, process);
 
     uint16_t process_priority = process->priority;
     irq_restore(irqstate);
@@ -161,6 +297,7 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
     if (mutex->queue.next) {
         if (mutex->queue.next == MUTEX_LOCKED) {
             mutex->queue.next = NULL;
+            _release(mutex);
         }
         else {
             list_node_t *next = list_remove_head(&mutex->queue);
@@ -172,6 +309,7 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
             if (!mutex->queue.next) {
                 mutex->queue.next = MUTEX_LOCKED;
             }
+            _handoff(mutex, process);
         }
     }
 
@@ -203,6 +341,11 @@ void mutex_cancel(mutex_cancel_t *mc)
         if (mutex->queue.next == NULL) {
             mutex->queue.next = MUTEX_LOCKED;
         }
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+        /* the holder no longer inherits the priority of thread */
+        thread->blocked_on = NULL;
+        _restore_priority(thread_get(mutex->owner));
+#endif
         sched_set_status(thread, STATUS_PENDING);
         irq_restore(irq_state);
         sched_switch(thread->priority);
@@ -19,6 +19,7 @@
  * @}
  */
 
+#include <assert.h>
 #include <stdint.h>
 #include <inttypes.h>
 
@@ -28,6 +29,7 @@
 #include "irq.h"
 #include "thread.h"
 #include "log.h"
+#include "trace.h"
 
 #ifdef MODULE_MPU_STACK_GUARD
 #include "mpu.h"
@@ -187,6 +189,8 @@ thread_t *__attribute__((used)) sched_run(void)
         sched_active_pid = next_thread->pid;
         sched_active_thread = next_thread;
 
+        TRACE_POINT(TRACE_EVENT_SCHED, next_thread->pid);
+
 #ifdef MODULE_SCHED_CB
         if (sched_cb) {
             sched_cb(KERNEL_PID_UNDEF, next_thread->pid);
@@ -207,6 +211,10 @@ thread_t *__attribute__((used)) sched_run(void)
         DEBUG("sched_run: done, changed sched_active_thread.\n");
     }
 
+#ifdef MODULE_SCHED_RUNQ_CALLBACK
+    sched_runq_callback(nextrq);
+#endif
+
     return next_thread;
 }
 
@@ -220,6 +228,12 @@ void sched_set_status(thread_t *process, thread_status_t status)
             clist_rpush(&sched_runqueues[process->priority],
                         &(process->rq_entry));
             _set_runqueue_bit(process);
+#ifdef MODULE_SCHED_RUNNABLE_CALLBACK
+            sched_runnable_callback(process);
+#endif
+#ifdef MODULE_SCHED_RUNQ_CALLBACK
+            sched_runq_callback(process->priority);
+#endif
         }
     }
     else {
@@ -238,6 +252,43 @@ void sched_set_status(thread_t *process, thread_status_t status)
     process->status = status;
 }
 
+void sched_change_priority(thread_t *thread, uint8_t priority)
+{
+    assert(priority < SCHED_PRIO_LEVELS);
+
+    unsigned irq_state = irq_disable();
+
+    if (thread->priority == priority) {
+        irq_restore(irq_state);
+        return;
+    }
+
+    if (thread->status >= STATUS_ON_RUNQUEUE) {
+        DEBUG("sched_change_priority: moving thread %" PRIkernel_pid
+              " from runqueue %" PRIu8 " to %" PRIu8 ".\n",
+              thread->pid, thread->priority, priority);
+        clist_remove(&sched_runqueues[thread->priority], &thread->rq_entry);
+        if (!sched_runqueues[thread->priority].next) {
+            _clear_runqueue_bit(thread);
+        }
+        thread->priority = priority;
+        /* the running thread has to stay at the head of its runqueue, as
+         * sched_set_status() pops the head when it stops running */
+        if (thread == thread_get_active()) {
+            clist_lpush(&sched_runqueues[priority], &thread->rq_entry);
+        }
+        else {
+            clist_rpush(&sched_runqueues[priority], &thread->rq_entry);
+        }
+        _set_runqueue_bit(thread);
+    }
+    else {
+        thread->priority = priority;
+    }
+
+    irq_restore(irq_state);
+}
+
 void sched_switch(uint16_t other_prio)
 {
     thread_t *active_thread = thread_get_active();
@@ -296,6 +296,11 @@ kernel_pid_t thread_create(char *stack, int stacksize, uint8_t priority,
     thread->msg_array = NULL;
 #endif
 
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    thread->base_priority = priority;
+    thread->blocked_on = NULL;
+#endif
+
     sched_num_threads++;
 
     DEBUG("Created thread %s. PID: %" PRIkernel_pid ". Priority: %u.\n", name,
@@ -40,6 +40,13 @@ static const netdev_driver_t nrf802154_netdev_driver;
 
 static uint8_t rxbuf[IEEE802154_FRAME_LEN_MAX + 3]; /* len PHR + PSDU + LQI */
 static uint8_t txbuf[IEEE802154_FRAME_LEN_MAX + 3]; /* len PHR + PSDU + LQI */
+/* buffer the radio receives into, either rxbuf or one of the upper layer */
+static uint8_t *volatile _rx_cur = rxbuf;
+/* number of buffers of the upper layer held in addition to _rx_cur, enough
+ * for all buffers GNRC provides while the radio receives into rxbuf */
+#define RX_BUF_NUMOF        (2U)
+/* buffers of the upper layer to receive into once _rx_cur is rxbuf again */
+static uint8_t *volatile _rx_next[RX_BUF_NUMOF];
 static netdev_ieee802154_t *nrf802154_dev;
 
 #define ED_RSSISCALE        (4U)
@@ -78,7 +85,7 @@ static void _enable_rx(void)
     if (NRF_RADIO->STATE != RADIO_STATE_STATE_RxIdle) {
         _disable();
     }
-    NRF_RADIO->PACKETPTR = (uint32_t)rxbuf;
+    NRF_RADIO->PACKETPTR = (uint32_t)_rx_cur;
     NRF_RADIO->EVENTS_RXREADY = 0;
     NRF_RADIO->TASKS_RXEN = 1;
     while (!(NRF_RADIO->EVENTS_RXREADY)) {};
@@ -168,6 +175,16 @@ static bool _channel_is_clear(void)
         return;
     }
 
+    /* use the buffer provided by the upper layer, if any */
+    if ((_rx_cur == rxbuf) && (_rx_next[0] != NULL)) {
+        _rx_cur = _rx_next[0];
+        for (unsigned i = 1; i < RX_BUF_NUMOF; i++) {
+            _rx_next[i - 1] = _rx_next[i];
+        }
+        _rx_next[RX_BUF_NUMOF - 1] = NULL;
+    }
+    NRF_RADIO->PACKETPTR = (uint32_t)_rx_cur;
+
     /* reset RX state and listen for new packets */
     _state &= ~RX_COMPLETE;
     NRF_RADIO->TASKS_START = 1;
@@ -245,6 +262,10 @@ static int _init(netdev_t *dev)
     /* reset buffer */
     rxbuf[0] = 0;
     txbuf[0] = 0;
+    /* buffers of the upper layer are dropped, their ownership is back with
+     * the upper layer */
+    _rx_cur = rxbuf;
+    memset((void *)_rx_next, 0, sizeof(_rx_next));
     _state = 0;
 
     /* power on peripheral */
@@ -338,12 +359,26 @@ static int _send(netdev_t *dev,  const iolist_t *iolist)
     return len;
 }
 
+static void _get_rx_info(netdev_ieee802154_rx_info_t *radio_info,
+                         uint8_t hwlqi)
+{
+    /* Convert to 802.15.4 LQI (page 319 of product spec v1.1) */
+    radio_info->lqi = (uint8_t)(hwlqi > UINT8_MAX/ED_RSSISCALE
+                               ? UINT8_MAX
+                               : hwlqi * ED_RSSISCALE);
+    /* Calculate RSSI by subtracting the offset from the datasheet.
+     * Intentionally using a different calculation than the one from
+     * figure 122 of the v1.1 product specification. This appears to
+     * match real world performance better */
+    radio_info->rssi = (int16_t)hwlqi + ED_RSSIOFFS;
+}
+
 static int _recv(netdev_t *dev, void *buf, size_t len, void *info)
 {
     (void)dev;
     (void)info;
 
-    size_t pktlen = (size_t)rxbuf[0] - IEEE802154_FCS_LEN;
+    size_t pktlen = (size_t)_rx_cur[0] - IEEE802154_FCS_LEN;
 
     /* check if packet data is readable */
     if (!(_state & RX_COMPLETE)) {
@@ -368,23 +403,60 @@ static int _recv(netdev_t *dev, void *buf, size_t len, void *info)
     }
     else {
         DEBUG("[nrf802154] recv: reading packet of length %i\n", pktlen);
-        memcpy(buf, &rxbuf[1], pktlen);
+        memcpy(buf, &_rx_cur[1], pktlen);
         if (info != NULL) {
-            netdev_ieee802154_rx_info_t *radio_info = info;
-            /* Hardware link quality indicator */
-            uint8_t hwlqi = rxbuf[pktlen + 1];
-            /* Convert to 802.15.4 LQI (page 319 of product spec v1.1) */
-            radio_info->lqi = (uint8_t)(hwlqi > UINT8_MAX/ED_RSSISCALE
-                                       ? UINT8_MAX
-                                       : hwlqi * ED_RSSISCALE);
-            /* Calculate RSSI by subtracting the offset from the datasheet.
-             * Intentionally using a different calculation than the one from
-             * figure 122 of the v1.1 product specification. This appears to
-             * match real world performance better */
-            radio_info->rssi = (int16_t)hwlqi + ED_RSSIOFFS;
+            /* Hardware link quality indicator follows the PSDU */
+            _get_rx_info(info, _rx_cur[pktlen + 1]);
+        }
+    }
+
+    _reset_rx();
+
+    return (int)pktlen;
+}
+
+static int _rx_buf_push(netdev_t *dev, void *buf, size_t len)
+{
+    (void)dev;
+
+    if (len < sizeof(rxbuf)) {
+        return -ENOBUFS;
+    }
+    for (unsigned i = 0; i < RX_BUF_NUMOF; i++) {
+        if (_rx_next[i] == NULL) {
+            /* the radio switches to it in one of the next calls of
+             * _reset_rx() */
+            _rx_next[i] = buf;
+            return 0;
         }
     }
+    return -EBUSY;
+}
+
+static int _recv_buf(netdev_t *dev, void **buf, size_t *offset, void *info)
+{
+    (void)dev;
 
+    uint8_t *frame = _rx_cur;
+    size_t pktlen = (size_t)frame[0] - IEEE802154_FCS_LEN;
+
+    if (!(_state & RX_COMPLETE)) {
+        DEBUG("[nrf802154] recv_buf: no packet data available\n");
+        return 0;
+    }
+    if (frame == rxbuf) {
+        return -ENOBUFS;
+    }
+    DEBUG("[nrf802154] recv_buf: handing over packet of length %i\n", pktlen);
+    if (info != NULL) {
+        _get_rx_info(info, frame[pktlen + 1]);
+    }
+    *buf = frame;
+    /* skip the PHR */
+    *offset = 1;
+    /* the radio is idle while RX_COMPLETE is set, so the buffer can be
+     * replaced here */
+    _rx_cur = rxbuf;
     _reset_rx();
 
     return (int)pktlen;
@@ -487,7 +559,7 @@ void isr_radio(void)
                 if ((nrf802154_dev->netdev.event_callback) &&
                     (NRF_RADIO->CRCSTATUS == 1) &&
                     (netdev_ieee802154_dst_filter(nrf802154_dev,
-                                                  &rxbuf[1]) == 0)) {
+                                                  &_rx_cur[1]) == 0)) {
                     _state |= RX_COMPLETE;
                 }
                 else {
@@ -533,6 +605,8 @@ void nrf802154_setup(nrf802154_t *dev)
 static const netdev_driver_t nrf802154_netdev_driver = {
     .send = _send,
     .recv = _recv,
+    .rx_buf_push = _rx_buf_push,
+    .recv_buf = _recv_buf,
     .init = _init,
     .isr  = _isr,
     .get  = _get,
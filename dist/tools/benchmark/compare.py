@@ -0,0 +1,91 @@
+#! /usr/bin/env python3
+#
+# Copyright (C) 2021 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+"""
+Script to compare the results of two runs of an application using
+`benchmark_run_all()` (provided by the `benchmark` module), e.g. before and
+after a change. The output of the application may be in CSV or JSON format and
+may contain other lines, which are ignored.
+
+For every benchmark case found in both runs, the change of the median runtime
+is printed. The script exits with 1 if any case got slower by more than the
+given threshold.
+"""
+
+import argparse
+import csv
+import json
+import sys
+
+FIELDS = ["name", "param", "iterations", "samples",
+          "min_ns", "median_ns", "p99_ns", "max_ns", "mean_ns"]
+
+
+def parse(lines):
+    """Returns a dict mapping (name, param) to the results of a case"""
+    results = {}
+    for line in lines:
+        line = line.strip()
+        if line.startswith("{"):
+            try:
+                res = json.loads(line)
+            except ValueError:
+                continue
+        else:
+            row = next(csv.reader([line]), [])
+            if len(row) != len(FIELDS) or row == FIELDS:
+                continue
+            res = dict(zip(FIELDS, row))
+        try:
+            results[(res["name"], res["param"])] = int(res["median_ns"])
+        except (KeyError, ValueError):
+            continue
+    return results
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("old", type=argparse.FileType("r"),
+                        help="output of the baseline run")
+    parser.add_argument("new", type=argparse.FileType("r"),
+                        help="output of the run to compare")
+    parser.add_argument("-t", "--threshold", type=float, default=5.0,
+                        help="allowed slowdown of the median in percent "
+                             "(default: %(default)s)")
+    args = parser.parse_args()
+
+    old = parse(args.old)
+    new = parse(args.new)
+    regressions = 0
+
+    print("{:<32} {:>12} {:>12} {:>8}".format("case", "old [ns]", "new [ns]",
+                                              "change"))
+    for key in old:
+        if key not in new:
+            continue
+        name = "{} {}".format(*key).strip()
+        change = ((new[key] - old[key]) * 100.0 / old[key]) if old[key] else 0
+        mark = ""
+        if change > args.threshold:
+            mark = " !"
+            regressions += 1
+        print("{:<32} {:>12} {:>12} {:>+7.1f}%{}".format(name, old[key],
+                                                         new[key], change,
+                                                         mark))
+    for key in sorted(set(old) ^ set(new)):
+        print("{:<32} only in one run".format("{} {}".format(*key).strip()))
+
+    if regressions:
+        print("{} case(s) slower by more than {}%".format(regressions,
+                                                          args.threshold))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
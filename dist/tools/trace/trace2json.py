@@ -0,0 +1,184 @@
+#! /usr/bin/env python3
+#
+# Copyright (C) 2021 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+"""
+Script to convert the binary output of `trace_dump_binary()` (provided by the
+`trace` module) into the JSON trace format of the Chrome tracing viewer
+(chrome://tracing) and Perfetto (https://ui.perfetto.dev).
+"""
+
+import argparse
+import json
+import sys
+
+MAGIC = b"RTRC"
+HDR_LEN = 8
+VERSION = 1
+REC_MINLEN = 6
+REC_MAXLEN = 6 + 5 * 3
+
+EVENT_USER = 0
+EVENT_SCHED = 1
+EVENT_DROPPED = 8
+EVENT_APP = 0x80
+
+# name and argument names of the events with arguments, see trace_event_id_t
+EVENTS = {
+    EVENT_USER: ("trace", ("val",)),
+    EVENT_SCHED: ("sched", ("pid",)),
+    2: ("msg_send", ("target", "type")),
+    3: ("mutex_lock", ("mutex", "contended")),
+    4: ("netif_rx", ("netif", "len")),
+    5: ("netif_tx", ("netif", "len")),
+    6: ("ztimer", ("clock",)),
+    7: ("ztimer_cb", ("callback",)),
+    EVENT_DROPPED: ("dropped", ("count",)),
+}
+
+# arguments printed in hex
+ADDR_ARGS = ("mutex", "clock", "callback")
+
+
+def parse_varint(data, pos):
+    val = 0
+    shift = 0
+    while True:
+        byte = data[pos]
+        pos += 1
+        val |= (byte & 0x7f) << shift
+        shift += 7
+        if not byte & 0x80:
+            return val, pos
+
+
+def parse_records(data):
+    """Yield (event id, time stamp, arguments) of all records in data.
+
+    Data outside of dumps (e.g. other output on the same UART) is skipped by
+    searching for the next header.
+    """
+    pos = data.find(MAGIC)
+    while pos >= 0:
+        if data[pos + 4] != VERSION:
+            sys.exit("unsupported trace format version {}"
+                     .format(data[pos + 4]))
+        pos += HDR_LEN
+        while pos < len(data):
+            length = data[pos]
+            if not REC_MINLEN <= length <= REC_MAXLEN or \
+               pos + length > len(data):
+                break
+            event = data[pos + 1]
+            time = int.from_bytes(data[pos + 2:pos + 6], "little")
+            args = []
+            arg_pos = pos + 6
+            try:
+                while arg_pos < pos + length:
+                    val, arg_pos = parse_varint(data, arg_pos)
+                    args.append(val)
+            except IndexError:
+                break
+            if arg_pos != pos + length:
+                break
+            yield event, time, args
+            pos += length
+        pos = data.find(MAGIC, pos)
+
+
+def sort_records(records):
+    """Return the records sorted by their unwrapped time stamps.
+
+    A record is reserved in the buffer after its time stamp was taken, so an
+    event interrupting the recording of another one may be stored first
+    despite its later time stamp.
+    """
+    unwrapped = []
+    offset = 0
+    last = None
+
+    for event, time, args in records:
+        if last is not None and time < last and last - time > (1 << 31):
+            offset += 1 << 32
+        elif last is not None and time > last and time - last > (1 << 31):
+            # recorded after the time stamps wrapped, but taken before
+            unwrapped.append((event, time + offset - (1 << 32), args))
+            continue
+        last = time
+        unwrapped.append((event, time + offset, args))
+    return sorted(unwrapped, key=lambda record: record[1])
+
+
+def convert(records):
+    events = []
+    threads = set()
+    # the currently running thread and since when
+    running = None
+    running_since = None
+
+    for event, time, args in sort_records(records):
+        tid = running if running is not None else 0
+
+        if event == EVENT_SCHED:
+            if running is not None:
+                events.append({"name": "running", "ph": "X", "pid": 0,
+                               "tid": running, "ts": running_since,
+                               "dur": time - running_since})
+            running = args[0]
+            running_since = time
+            threads.add(running)
+            continue
+
+        if event in EVENTS:
+            name, arg_names = EVENTS[event]
+        elif event >= EVENT_APP:
+            name, arg_names = "app_{:#x}".format(event), ()
+        else:
+            name, arg_names = "event_{}".format(event), ()
+
+        named = {}
+        for i, val in enumerate(args):
+            arg = arg_names[i] if i < len(arg_names) else "arg{}".format(i)
+            named[arg] = hex(val) if arg in ADDR_ARGS else val
+
+        events.append({"name": name, "ph": "i", "pid": 0, "tid": tid,
+                       "ts": time, "s": "g" if event == EVENT_DROPPED else "t",
+                       "args": named})
+
+    events.append({"name": "process_name", "ph": "M", "pid": 0,
+                   "args": {"name": "RIOT"}})
+    for tid in sorted(threads):
+        events.append({"name": "thread_name", "ph": "M", "pid": 0,
+                       "tid": tid, "args": {"name": "pid {}".format(tid)}})
+    return {"traceEvents": events, "displayTimeUnit": "ms"}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("infile", nargs="?", default="-",
+                        help="binary trace (default: stdin)")
+    parser.add_argument("-o", "--outfile", default="-",
+                        help="JSON output (default: stdout)")
+    args = parser.parse_args()
+
+    if args.infile == "-":
+        data = sys.stdin.buffer.read()
+    else:
+        with open(args.infile, "rb") as f:
+            data = f.read()
+
+    trace = convert(parse_records(data))
+
+    if args.outfile == "-":
+        json.dump(trace, sys.stdout)
+    else:
+        with open(args.outfile, "w") as f:
+            json.dump(trace, f)
+
+
+if __name__ == "__main__":
+    main()
@@ -476,6 +476,64 @@ typedef struct netdev_driver {
      */
     int (*recv)(netdev_t *dev, void *buf, size_t len, void *info);
 
+    /**
+     * @brief   Provide a buffer to receive a frame into (optional)
+     *
+     * @pre     `(dev != NULL) && (buf != NULL)`
+     *
+     * Devices that write received frames to RAM (e.g. via DMA) can receive
+     * into memory of the upper layer instead of their own, so that the
+     * frame does not need to be copied by @ref netdev_driver_t::recv. The
+     * device takes ownership of @p buf and starts using it the next time it
+     * is ready to receive a frame. The buffer is handed back by
+     * @ref netdev_driver_t::recv_buf once it holds a frame. When the device
+     * is initialized again by @ref netdev_driver_t::init or reset via
+     * @ref NETOPT_STATE_RESET, it drops all buffers it holds and their
+     * ownership returns to the caller.
+     *
+     * Drivers not supporting this set it to `NULL`.
+     *
+     * @param[in]   dev     network device descriptor. Must not be NULL.
+     * @param[in]   buf     buffer to receive into
+     * @param[in]   len     size of @p buf
+     *
+     * @retval  0           on success
+     * @retval  -EBUSY      if the device already holds all the buffers it can
+     *                      use. Ownership of @p buf stays with the caller.
+     * @retval  -ENOBUFS    if @p len is too small for a frame of the device.
+     *                      Ownership of @p buf stays with the caller.
+     */
+    int (*rx_buf_push)(netdev_t *dev, void *buf, size_t len);
+
+    /**
+     * @brief   Get a received frame without copying it (optional)
+     *
+     * @pre     `(dev != NULL) && (buf != NULL) && (offset != NULL)`
+     *
+     * Supposed to be called from
+     * @ref netdev_t::event_callback "netdev->event_callback()" instead of
+     * @ref netdev_driver_t::recv. If the frame was received into a buffer
+     * provided with @ref netdev_driver_t::rx_buf_push, ownership of that
+     * buffer passes back to the caller. Otherwise the frame is left to
+     * @ref netdev_driver_t::recv.
+     *
+     * Drivers not supporting this set it to `NULL`.
+     *
+     * @param[in]   dev     network device descriptor. Must not be NULL.
+     * @param[out]  buf     the buffer holding the frame
+     * @param[out]  offset  offset of the frame in @p buf, e.g. to skip a PHY
+     *                      header
+     * @param[out]  info    status information for the received frame. Might
+     *                      be of different type for different netdev devices.
+     *                      May be NULL if not needed or applicable.
+     *
+     * @return  number of bytes of the frame
+     * @retval  -ENOBUFS    if the frame was not received into a provided
+     *                      buffer, use @ref netdev_driver_t::recv to get it
+     * @retval  0           if there is no frame
+     */
+    int (*recv_buf)(netdev_t *dev, void **buf, size_t *offset, void *info);
+
     /**
      * @brief   the driver's initialization function
      *
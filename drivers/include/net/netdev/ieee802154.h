@@ -67,6 +67,15 @@ extern "C" {
  * @}
  */
 
+/**
+ * @brief   Size of the buffers provided to a device with
+ *          @ref netdev_driver_t::rx_buf_push
+ *
+ * Fits the PHY header, the largest PSDU and two status bytes (e.g. LQI and
+ * RSSI) the device might store next to the frame.
+ */
+#define NETDEV_IEEE802154_RX_BUF_SIZE       (1U + IEEE802154_FRAME_LEN_MAX + 2U)
+
 /**
  * @brief   Option parameter to be used with @ref NETOPT_CCA_MODE to set
  *          the mode of the clear channel assessment (CCA) defined
@@ -26,8 +26,10 @@ PSEUDOMODULES += ecc_%
 PSEUDOMODULES += event_%
 PSEUDOMODULES += evtimer_mbox
 PSEUDOMODULES += evtimer_on_ztimer
+PSEUDOMODULES += fib_trie
 PSEUDOMODULES += fmt_%
 PSEUDOMODULES += gcoap_dtls
+PSEUDOMODULES += gcoap_obs_fanout
 PSEUDOMODULES += gnrc_dhcpv6_%
 PSEUDOMODULES += gnrc_dhcpv6_client_mud_url
 PSEUDOMODULES += gnrc_ipv6_default
@@ -53,6 +55,7 @@ PSEUDOMODULES += gnrc_netif_mac
 PSEUDOMODULES += gnrc_netif_single
 PSEUDOMODULES += gnrc_netif_cmd_%
 PSEUDOMODULES += gnrc_netif_dedup
+PSEUDOMODULES += gnrc_netif_rx_buf
 PSEUDOMODULES += gnrc_nettype_%
 PSEUDOMODULES += gnrc_sixloenc
 PSEUDOMODULES += gnrc_sixlowpan_border_router_default
@@ -117,6 +120,9 @@ PSEUDOMODULES += saul_nrf_temperature
 PSEUDOMODULES += saul_pwm
 PSEUDOMODULES += scanf_float
 PSEUDOMODULES += sched_cb
+PSEUDOMODULES += sched_runnable_callback
+PSEUDOMODULES += sched_runq_callback
+PSEUDOMODULES += schedstatistics_latency
 PSEUDOMODULES += semtech_loramac_rx
 PSEUDOMODULES += shell_hooks
 PSEUDOMODULES += slipdev_stdio
@@ -142,6 +148,7 @@ PSEUDOMODULES += stm32mp1_eng_mode
 PSEUDOMODULES += suit_transport_%
 PSEUDOMODULES += suit_storage_%
 PSEUDOMODULES += sys_bus_%
+PSEUDOMODULES += trace_points
 PSEUDOMODULES += wakaama_objects_%
 PSEUDOMODULES += wifi_enterprise
 PSEUDOMODULES += xtimer_on_ztimer
@@ -288,6 +295,22 @@ PSEUDOMODULES += ds18_optimized
 PSEUDOMODULES += crypto_aes_precalculated
 # This pseudomodule causes a loop in AES to be unrolled (more flash, less CPU)
 PSEUDOMODULES += crypto_aes_unroll
+# Constant time bitsliced AES implementation instead of the T tables
+PSEUDOMODULES += crypto_aes_bitslice
+# AES implementation using the AES-NI instructions of the host (native only)
+PSEUDOMODULES += crypto_aes_ni
+
+# Lets a platform provide the SHA-224/256 block function (sha2xx_hw_transform)
+PSEUDOMODULES += hashes_sha2xx_hw
+# SHA-224/256 block function using the SHA instructions of the host (native only)
+PSEUDOMODULES += hashes_sha2xx_ni
+
+# Lookup table size of the generic CRC: 16 entries or 8 tables of 256 entries
+# instead of a single table of 256 entries
+PSEUDOMODULES += checksum_crc_nibble
+PSEUDOMODULES += checksum_crc_slice8
+# Generic CRC using the carry-less multiplication of the host (native only)
+PSEUDOMODULES += checksum_crc_pclmul
 
 # declare shell version of test_utils_interactive_sync
 PSEUDOMODULES += test_utils_interactive_sync_shell
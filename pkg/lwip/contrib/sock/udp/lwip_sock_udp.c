@@ -177,6 +177,58 @@ ssize_t sock_udp_send_aux(sock_udp_t *sock, const void *data, size_t len,
                           (struct _sock_tl_ep *)remote, NETCONN_UDP);
 }
 
+int sock_udp_recv_many(sock_udp_t *sock, sock_udp_dgram_t *dgrams,
+                       unsigned numof, uint32_t timeout)
+{
+    unsigned i = 0;
+
+    assert((sock != NULL) && (dgrams != NULL) && (numof > 0));
+    while (i < numof) {
+        /* only wait for the first datagram, the others are taken from the
+         * netconn's mbox as long as there are any */
+        ssize_t res = sock_udp_recv(sock, dgrams[i].data, dgrams[i].len,
+                                    (i == 0) ? timeout : 0, dgrams[i].remote);
+
+        if (res < 0) {
+            if (i == 0) {
+                return (int)res;
+            }
+            if ((res == -ENOBUFS) || (res == -EPROTO)) {
+                /* datagram was dropped, try the next one */
+                continue;
+            }
+            break;
+        }
+        dgrams[i++].len = res;
+    }
+    return (int)i;
+}
+
+int sock_udp_send_many(sock_udp_t *sock, const sock_udp_dgram_t *dgrams,
+                       unsigned numof)
+{
+    assert((sock != NULL) && (dgrams != NULL) && (numof > 0));
+    /* with LWIP_TCPIP_CORE_LOCKING netconn_send() does not involve the tcpip
+     * thread, so there is nothing to save by batching here */
+    for (unsigned i = 0; i < numof; i++) {
+        ssize_t res;
+
+        if ((dgrams[i].remote != NULL) && (dgrams[i].remote->port == 0)) {
+            res = -EINVAL;
+        }
+        else {
+            res = lwip_sock_send(sock->base.conn, dgrams[i].data,
+                                 dgrams[i].len, 0,
+                                 (struct _sock_tl_ep *)dgrams[i].remote,
+                                 NETCONN_UDP);
+        }
+        if (res < 0) {
+            return (i == 0) ? (int)res : (int)i;
+        }
+    }
+    return (int)numof;
+}
+
 #ifdef SOCK_HAS_ASYNC
 void sock_udp_set_cb(sock_udp_t *sock, sock_udp_cb_t cb, void *arg)
 {
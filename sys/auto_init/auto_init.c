@@ -38,12 +38,22 @@ void auto_init(void)
         void ztimer_init(void);
         ztimer_init();
     }
+    if (IS_USED(MODULE_TRACE) && IS_USED(MODULE_AUTO_INIT_ZTIMER)) {
+        LOG_DEBUG("Auto init trace.\n");
+        extern void trace_init(void);
+        trace_init();
+    }
     if (IS_USED(MODULE_AUTO_INIT_XTIMER) &&
             !IS_USED(MODULE_ZTIMER_XTIMER_COMPAT)) {
         LOG_DEBUG("Auto init xtimer.\n");
         extern void xtimer_init(void);
         xtimer_init();
     }
+    if (IS_USED(MODULE_SCHED_ROUND_ROBIN)) {
+        LOG_DEBUG("Auto init sched_round_robin.\n");
+        extern void sched_round_robin_init(void);
+        sched_round_robin_init();
+    }
     if (IS_USED(MODULE_SCHEDSTATISTICS)) {
         LOG_DEBUG("Auto init schedstatistics.\n");
         extern void init_schedstatistics(void);
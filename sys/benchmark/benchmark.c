@@ -18,9 +18,194 @@
  * @}
  */
 
+#include <inttypes.h>
+#include <stdbool.h>
 #include <stdio.h>
+#include <stdlib.h>
 
 #include "benchmark.h"
+#include "matstat.h"
+#include "timex.h"
+
+#if defined(CPU_NATIVE)
+#include <time.h>
+#include "native_internal.h"
+#elif defined(CPU_CORE_CORTEX_M3) || defined(CPU_CORE_CORTEX_M4) || \
+      defined(CPU_CORE_CORTEX_M4F) || defined(CPU_CORE_CORTEX_M7) || \
+      defined(CPU_CORE_CORTEX_M33)
+#include "cpu.h"
+#include "periph_conf.h"
+#define BENCHMARK_CLOCK_DWT
+#endif
+
+static uint32_t _samples[CONFIG_BENCHMARK_SAMPLES];
+
+/* clock overhead per sample and call overhead per iteration, in ns */
+static uint32_t _overhead_sample;
+static uint32_t _overhead_call;
+
+#if defined(CPU_NATIVE)
+static void _clock_init(void)
+{
+}
+
+static inline uint32_t _clock_now(void)
+{
+    struct timespec t;
+
+    real_clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint32_t)t.tv_sec * (uint32_t)NS_PER_SEC + t.tv_nsec;
+}
+
+static inline uint32_t _to_ns(uint32_t ticks)
+{
+    return ticks;
+}
+#elif defined(BENCHMARK_CLOCK_DWT)
+static void _clock_init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+static inline uint32_t _clock_now(void)
+{
+    return DWT->CYCCNT;
+}
+
+static inline uint32_t _to_ns(uint32_t ticks)
+{
+    return ((uint64_t)ticks * NS_PER_SEC) / CLOCK_CORECLOCK;
+}
+#else
+static void _clock_init(void)
+{
+}
+
+static inline uint32_t _clock_now(void)
+{
+    return xtimer_now_usec();
+}
+
+static inline uint32_t _to_ns(uint32_t ticks)
+{
+    return ticks * NS_PER_US;
+}
+#endif
+
+static void _empty(void *arg)
+{
+    (void)arg;
+}
+
+/* returns the time of a sample in ns minus the overhead */
+static uint32_t _sample(const benchmark_case_t *bc, uint32_t iterations)
+{
+    uint32_t start = _clock_now();
+
+    for (uint32_t i = 0; i < iterations; i++) {
+        bc->func(bc->arg);
+    }
+    uint32_t ns = _to_ns(_clock_now() - start);
+    uint32_t overhead = _overhead_sample + iterations * _overhead_call;
+
+    return (ns > overhead) ? ns - overhead : 0;
+}
+
+static int _cmp(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+static void _calibrate(void)
+{
+    static bool calibrated;
+    const benchmark_case_t empty = { .func = _empty };
+    uint32_t min_sample = UINT32_MAX, min_call = UINT32_MAX;
+
+    if (calibrated) {
+        return;
+    }
+    _clock_init();
+
+    /* the minimum of several runs, so an interrupt does not spoil it */
+    for (unsigned i = 0; i < CONFIG_BENCHMARK_WARMUP + 10; i++) {
+        uint32_t ns = _sample(&empty, 0);
+        min_sample = (ns < min_sample) ? ns : min_sample;
+    }
+    _overhead_sample = min_sample;
+    for (unsigned i = 0; i < CONFIG_BENCHMARK_WARMUP + 10; i++) {
+        uint32_t ns = _sample(&empty, 100);
+        min_call = (ns < min_call) ? ns : min_call;
+    }
+    _overhead_call = min_call / 100;
+    calibrated = true;
+}
+
+void benchmark_run(const benchmark_case_t *bc, benchmark_result_t *res)
+{
+    uint32_t iterations = bc->iterations ? bc->iterations : 1;
+    matstat_state_t stat = MATSTAT_STATE_INIT;
+
+    _calibrate();
+
+    for (unsigned i = 0; i < CONFIG_BENCHMARK_WARMUP; i++) {
+        _sample(bc, iterations);
+    }
+    for (unsigned i = 0; i < CONFIG_BENCHMARK_SAMPLES; i++) {
+        _samples[i] = _sample(bc, iterations) / iterations;
+        matstat_add(&stat, _samples[i]);
+    }
+
+    qsort(_samples, CONFIG_BENCHMARK_SAMPLES, sizeof(_samples[0]), _cmp);
+
+    res->samples = CONFIG_BENCHMARK_SAMPLES;
+    res->min = _samples[0];
+    res->median = _samples[CONFIG_BENCHMARK_SAMPLES / 2];
+    res->p99 = _samples[(CONFIG_BENCHMARK_SAMPLES * 99 + 99) / 100 - 1];
+    res->max = _samples[CONFIG_BENCHMARK_SAMPLES - 1];
+    res->mean = matstat_mean(&stat);
+}
+
+void benchmark_print_header(void)
+{
+#ifndef CONFIG_BENCHMARK_OUTPUT_JSON
+    puts("name,param,iterations,samples,min_ns,median_ns,p99_ns,max_ns,mean_ns");
+#endif
+}
+
+void benchmark_print_result(const benchmark_case_t *bc,
+                            const benchmark_result_t *res)
+{
+    const char *param = bc->param ? bc->param : "";
+
+#ifdef CONFIG_BENCHMARK_OUTPUT_JSON
+    printf("{ \"name\" : \"%s\", \"param\" : \"%s\", \"iterations\" : %" PRIu32
+           ", \"samples\" : %" PRIu32 ", \"min_ns\" : %" PRIu32
+           ", \"median_ns\" : %" PRIu32 ", \"p99_ns\" : %" PRIu32
+           ", \"max_ns\" : %" PRIu32 ", \"mean_ns\" : %" PRIu32 " }\n",
+#else
+    printf("%s,%s,%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32
+           ",%" PRIu32 ",%" PRIu32 "\n",
+#endif
+           bc->name, param, bc->iterations ? bc->iterations : 1, res->samples,
+           res->min, res->median, res->p99, res->max, res->mean);
+}
+
+void benchmark_run_all(const benchmark_case_t *cases, size_t numof)
+{
+    benchmark_print_header();
+    for (size_t i = 0; i < numof; i++) {
+        benchmark_result_t res;
+
+        benchmark_run(&cases[i], &res);
+        benchmark_print_result(&cases[i], &res);
+    }
+    printf("benchmark: %u cases run\n", (unsigned)numof);
+}
 
 void benchmark_print_time(uint32_t time, unsigned long runs, const char *name)
 {
@@ -0,0 +1,283 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_checksum_crc
+ * @{
+ *
+ * @file
+ * @brief       Generic CRC implementation
+ *
+ * Reflected CRCs are computed with the register in the lower bits, all others
+ * with the register in the upper bits of a 32 bit word. This way, the same
+ * table lookups work for every width.
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "checksum/crc.h"
+
+const crc_params_t crc_params_crc8 = {
+    .poly = 0x31, .init = 0xff, .xorout = 0, .width = 8, .reflected = false,
+};
+
+const crc_params_t crc_params_crc16_ccitt = {
+    .poly = 0x1021, .init = 0x1d0f, .xorout = 0, .width = 16,
+    .reflected = false,
+};
+
+const crc_params_t crc_params_crc16_kermit = {
+    .poly = 0x1021, .init = 0, .xorout = 0, .width = 16, .reflected = true,
+};
+
+const crc_params_t crc_params_crc32 = {
+    .poly = 0x04c11db7, .init = 0xffffffff, .xorout = 0xffffffff,
+    .width = 32, .reflected = true,
+};
+
+const crc_params_t crc_params_crc32c = {
+    .poly = 0x1edc6f41, .init = 0xffffffff, .xorout = 0xffffffff,
+    .width = 32, .reflected = true,
+};
+
+#if IS_USED(MODULE_CHECKSUM_CRC_NIBBLE)
+#define TABLE_BITS      (4U)
+#else
+#define TABLE_BITS      (8U)
+#endif
+
+static uint32_t _reflect(uint32_t value, unsigned width)
+{
+    uint32_t res = 0;
+
+    for (unsigned i = 0; i < width; i++) {
+        res = (res << 1) | (value & 1);
+        value >>= 1;
+    }
+    return res;
+}
+
+static uint32_t _table_update(const crc_engine_t *engine, uint32_t crc,
+                              const uint8_t *data, size_t len)
+{
+    const uint32_t *t = engine->table;
+
+    if (engine->params->reflected) {
+#if IS_USED(MODULE_CHECKSUM_CRC_SLICE8)
+        for (; len >= 8; len -= 8, data += 8) {
+            uint32_t a = crc ^ (data[0] | (data[1] << 8) |
+                                (data[2] << 16) | ((uint32_t)data[3] << 24));
+
+            crc = t[7 * 256 + (a & 0xff)] ^ t[6 * 256 + ((a >> 8) & 0xff)] ^
+                  t[5 * 256 + ((a >> 16) & 0xff)] ^ t[4 * 256 + (a >> 24)] ^
+                  t[3 * 256 + data[4]] ^ t[2 * 256 + data[5]] ^
+                  t[1 * 256 + data[6]] ^ t[data[7]];
+        }
+#endif
+        while (len--) {
+            crc ^= *data++;
+#if IS_USED(MODULE_CHECKSUM_CRC_NIBBLE)
+            crc = (crc >> 4) ^ t[crc & 0xf];
+            crc = (crc >> 4) ^ t[crc & 0xf];
+#else
+            crc = (crc >> 8) ^ t[crc & 0xff];
+#endif
+        }
+    }
+    else {
+#if IS_USED(MODULE_CHECKSUM_CRC_SLICE8)
+        for (; len >= 8; len -= 8, data += 8) {
+            uint32_t a = crc ^ (((uint32_t)data[0] << 24) | (data[1] << 16) |
+                                (data[2] << 8) | data[3]);
+
+            crc = t[7 * 256 + (a >> 24)] ^ t[6 * 256 + ((a >> 16) & 0xff)] ^
+                  t[5 * 256 + ((a >> 8) & 0xff)] ^ t[4 * 256 + (a & 0xff)] ^
+                  t[3 * 256 + data[4]] ^ t[2 * 256 + data[5]] ^
+                  t[1 * 256 + data[6]] ^ t[data[7]];
+        }
+#endif
+        while (len--) {
+            crc ^= (uint32_t)*data++ << 24;
+#if IS_USED(MODULE_CHECKSUM_CRC_NIBBLE)
+            crc = (crc << 4) ^ t[crc >> 28];
+            crc = (crc << 4) ^ t[crc >> 28];
+#else
+            crc = (crc << 8) ^ t[crc >> 24];
+#endif
+        }
+    }
+
+    return crc;
+}
+
+#if IS_USED(MODULE_CHECKSUM_CRC_PCLMUL)
+
+#include <immintrin.h>
+
+#define PCLMUL          __attribute__((target("pclmul,ssse3")))
+
+/* x^n mod poly, not reflected */
+static uint32_t _xpow_mod(const crc_params_t *params, unsigned n)
+{
+    uint64_t top = 1ULL << params->width;
+    uint64_t res = 1;
+
+    while (n--) {
+        res <<= 1;
+        if (res & top) {
+            res ^= top | params->poly;
+        }
+    }
+    return res;
+}
+
+static void _fold_init(crc_engine_t *engine)
+{
+    const crc_params_t *params = engine->params;
+
+    /* The 128 bit remainder V of the data so far is replaced by
+     * V_hi * (x^192 mod P) + V_lo * (x^128 mod P) before XORing the next 16
+     * bytes. Multiplying reflected values yields the product times x, which
+     * the constants compensate. */
+    if (params->reflected) {
+        engine->fold[0] = (uint64_t)_reflect(_xpow_mod(params, 191), 32) << 32;
+        engine->fold[1] = (uint64_t)_reflect(_xpow_mod(params, 127), 32) << 32;
+    }
+    else {
+        engine->fold[0] = _xpow_mod(params, 128);
+        engine->fold[1] = _xpow_mod(params, 192);
+    }
+}
+
+/* folds all full 16 byte blocks into a single block, whose CRC with zero as
+ * initial value is the CRC of all blocks */
+PCLMUL
+static uint32_t _fold(const crc_engine_t *engine, uint32_t crc,
+                      const uint8_t *data, size_t numof)
+{
+    const __m128i k = _mm_set_epi64x(engine->fold[1], engine->fold[0]);
+    /* reverses the byte order, so that bit 127 is the first bit */
+    const __m128i bswap = engine->params->reflected
+                        ? _mm_set_epi64x(0x0f0e0d0c0b0a0908ULL,
+                                         0x0706050403020100ULL)
+                        : _mm_set_epi64x(0x0001020304050607ULL,
+                                         0x08090a0b0c0d0e0fULL);
+    uint8_t block[16];
+    __m128i v;
+
+    /* the register is XORed into the first bytes */
+    memcpy(block, data, sizeof(block));
+    for (unsigned i = 0; i < 4; i++) {
+        if (engine->params->reflected) {
+            block[i] ^= crc >> (i * 8);
+        }
+        else {
+            block[i] ^= crc >> (24 - i * 8);
+        }
+    }
+    v = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)block), bswap);
+
+    while (--numof) {
+        data += 16;
+        v = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(v, k, 0x00),
+                                        _mm_clmulepi64_si128(v, k, 0x11)),
+                          _mm_shuffle_epi8(
+                              _mm_loadu_si128((const __m128i *)data), bswap));
+    }
+
+    _mm_storeu_si128((__m128i *)block, _mm_shuffle_epi8(v, bswap));
+    return _table_update(engine, 0, block, sizeof(block));
+}
+
+#endif /* MODULE_CHECKSUM_CRC_PCLMUL */
+
+void crc_engine_init(crc_engine_t *engine, const crc_params_t *params)
+{
+    unsigned width = params->width;
+    uint32_t *t = engine->table;
+
+    assert(width >= 1 && width <= 32);
+    engine->params = params;
+
+    for (unsigned i = 0; i < (1U << TABLE_BITS); i++) {
+        uint32_t r;
+
+        if (params->reflected) {
+            uint32_t poly = _reflect(params->poly, width);
+
+            r = i;
+            for (unsigned j = 0; j < TABLE_BITS; j++) {
+                r = (r & 1) ? (r >> 1) ^ poly : r >> 1;
+            }
+        }
+        else {
+            uint32_t poly = params->poly << (32 - width);
+
+            r = (uint32_t)i << (32 - TABLE_BITS);
+            for (unsigned j = 0; j < TABLE_BITS; j++) {
+                r = (r & 0x80000000) ? (r << 1) ^ poly : r << 1;
+            }
+        }
+        t[i] = r;
+    }
+
+#if IS_USED(MODULE_CHECKSUM_CRC_SLICE8)
+    /* table k holds the CRC of a byte followed by k zero bytes */
+    for (unsigned i = 256; i < CRC_TABLE_SIZE; i++) {
+        uint32_t r = t[i - 256];
+
+        t[i] = params->reflected ? (r >> 8) ^ t[r & 0xff]
+                                 : (r << 8) ^ t[r >> 24];
+    }
+#endif
+
+#if IS_USED(MODULE_CHECKSUM_CRC_PCLMUL)
+    _fold_init(engine);
+#endif
+}
+
+uint32_t crc_start(const crc_engine_t *engine)
+{
+    const crc_params_t *params = engine->params;
+
+    if (params->reflected) {
+        return _reflect(params->init, params->width);
+    }
+    return params->init << (32 - params->width);
+}
+
+uint32_t crc_update(const crc_engine_t *engine, uint32_t crc,
+                    const void *data, size_t len)
+{
+    const uint8_t *bytes = data;
+
+#if IS_USED(MODULE_CHECKSUM_CRC_PCLMUL)
+    /* folding pays off from a few blocks on */
+    if (len >= 64 && __builtin_cpu_supports("pclmul")) {
+        crc = _fold(engine, crc, bytes, len / 16);
+        bytes += len & ~(size_t)0xf;
+        len &= 0xf;
+    }
+#endif
+
+    return _table_update(engine, crc, bytes, len);
+}
+
+uint32_t crc_finish(const crc_engine_t *engine, uint32_t crc)
+{
+    const crc_params_t *params = engine->params;
+
+    if (!params->reflected) {
+        crc >>= 32 - params->width;
+    }
+    return crc ^ params->xorout;
+}
@@ -39,6 +39,7 @@
 #include <stdint.h>
 #include "crypto/aes.h"
 #include "crypto/ciphers.h"
+#include "kernel_defines.h"
 
 /**
  * Interface to the aes cipher
@@ -48,10 +49,19 @@ static const cipher_interface_t aes_interface = {
     AES_KEY_SIZE,
     aes_init,
     aes_encrypt,
-    aes_decrypt
+    aes_decrypt,
+    aes_encrypt_blocks,
+    aes_decrypt_blocks
 };
 const cipher_id_t CIPHER_AES_128 = &aes_interface;
 
+/* The T-table implementation below is used unless another backend provides
+ * the block functions */
+#if !IS_USED(MODULE_CRYPTO_AES_BITSLICE) && !IS_USED(MODULE_CRYPTO_AES_NI)
+#define AES_TTABLE
+#endif
+
+#ifdef AES_TTABLE
 static const u32 Te0[256] = {
     0xc66363a5U, 0xf87c7c84U, 0xee777799U, 0xf67b7b8dU,
     0xfff2f20dU, 0xd66b6bbdU, 0xde6f6fb1U, 0x91c5c554U,
@@ -794,6 +804,7 @@ static const u32 rcon[] = {
     0x10000000, 0x20000000, 0x40000000, 0x80000000,
     0x1B000000, 0x36000000,
 };
+#endif /* AES_TTABLE */
 
 
 int aes_init(cipher_context_t *context, const uint8_t *key, uint8_t keySize)
@@ -827,6 +838,7 @@ int aes_init(cipher_context_t *context, const uint8_t *key, uint8_t keySize)
     return CIPHER_INIT_SUCCESS;
 }
 
+#ifdef AES_TTABLE
 /**
  * Expand the cipher key into the encryption key schedule.
  */
@@ -1028,20 +1040,9 @@ static int aes_set_decrypt_key(const unsigned char *userKey, const int bits,
  * Encrypt a single block
  * in and out can overlap
  */
-int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
-                uint8_t *cipherBlock)
+static void _encrypt_block(const AES_KEY *key, const uint8_t *plainBlock,
+                           uint8_t *cipherBlock)
 {
-    /* setup AES_KEY */
-    int res;
-    AES_KEY aeskey;
-    const AES_KEY *key = &aeskey;
-
-    res = aes_set_encrypt_key((unsigned char *)context->context,
-                              AES_KEY_SIZE * 8, &aeskey);
-    if (res < 0) {
-        return res;
-    }
-
     const u32 *rk;
     u32 s0, s1, s2, s3, t0, t1, t2, t3;
 #ifndef MODULE_CRYPTO_AES_UNROLL
@@ -1289,28 +1290,40 @@ int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
         (Te4((t2) & 0xff)       & 0x000000ff) ^
         rk[3];
     PUTU32(cipherBlock + 12, s3);
-    return 1;
 }
 
-/*
- * Decrypt a single block
- * in and out can overlap
- */
-int aes_decrypt(const cipher_context_t *context, const uint8_t *cipherBlock,
-                uint8_t *plainBlock)
+int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
+                uint8_t *cipherBlock)
 {
-    /* setup AES_KEY */
-    int res;
-    AES_KEY aeskey;
-    const AES_KEY *key = &aeskey;
+    return aes_encrypt_blocks(context, plainBlock, cipherBlock, 1);
+}
 
-    res = aes_set_decrypt_key((unsigned char *)context->context,
-                              AES_KEY_SIZE * 8, &aeskey);
+int aes_encrypt_blocks(const cipher_context_t *context, const uint8_t *input,
+                       uint8_t *output, size_t numof)
+{
+    /* setup AES_KEY once for all blocks */
+    AES_KEY aeskey;
+    int res = aes_set_encrypt_key((unsigned char *)context->context,
+                                  AES_KEY_SIZE * 8, &aeskey);
 
     if (res < 0) {
         return res;
     }
 
+    for (size_t i = 0; i < numof; i++) {
+        _encrypt_block(&aeskey, input + i * AES_BLOCK_SIZE,
+                       output + i * AES_BLOCK_SIZE);
+    }
+    return 1;
+}
+
+/*
+ * Decrypt a single block
+ * in and out can overlap
+ */
+static void _decrypt_block(const AES_KEY *key, const uint8_t *cipherBlock,
+                           uint8_t *plainBlock)
+{
     const u32 *rk;
     u32 s0, s1, s2, s3, t0, t1, t2, t3;
 #ifndef MODULE_CRYPTO_AES_UNROLL
@@ -1550,7 +1563,32 @@ int aes_decrypt(const cipher_context_t *context, const uint8_t *cipherBlock,
         (Td4((t0) & 0xff)       & 0x000000ff) ^
         rk[3];
     PUTU32(plainBlock + 12, s3);
+}
+
+int aes_decrypt(const cipher_context_t *context, const uint8_t *cipherBlock,
+                uint8_t *plainBlock)
+{
+    return aes_decrypt_blocks(context, cipherBlock, plainBlock, 1);
+}
+
+int aes_decrypt_blocks(const cipher_context_t *context, const uint8_t *input,
+                       uint8_t *output, size_t numof)
+{
+    /* setup AES_KEY once for all blocks */
+    AES_KEY aeskey;
+    int res = aes_set_decrypt_key((unsigned char *)context->context,
+                                  AES_KEY_SIZE * 8, &aeskey);
+
+    if (res < 0) {
+        return res;
+    }
+
+    for (size_t i = 0; i < numof; i++) {
+        _decrypt_block(&aeskey, input + i * AES_BLOCK_SIZE,
+                       output + i * AES_BLOCK_SIZE);
+    }
     return 1;
 }
 
 #endif /* AES_ASM */
+#endif /* AES_TTABLE */
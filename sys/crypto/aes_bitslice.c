@@ -0,0 +1,481 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_crypto
+ * @{
+ *
+ * @file
+ * @brief       Constant time bitsliced implementation of the AES block
+ *              functions
+ *
+ * Two blocks are processed at once in eight 32 bit words, word i holds bit i
+ * of every byte of both blocks. The S-box is computed with the circuit by
+ * Boyar and Peralta, ShiftRows and MixColumns are rotations within the words.
+ * There are neither lookup tables nor branches depending on secret data.
+ * The layout follows the "aes_ct" implementation of BearSSL by Thomas Pornin.
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "crypto/aes.h"
+#include "crypto/ciphers.h"
+#include "crypto/helper.h"
+#include "kernel_defines.h"
+
+#if IS_USED(MODULE_CRYPTO_AES_BITSLICE)
+
+#define ROUNDS          (10U)
+
+static inline uint32_t _dec32le(const uint8_t *buf)
+{
+    return (uint32_t)buf[0] | ((uint32_t)buf[1] << 8) |
+           ((uint32_t)buf[2] << 16) | ((uint32_t)buf[3] << 24);
+}
+
+static inline void _enc32le(uint8_t *buf, uint32_t val)
+{
+    buf[0] = val;
+    buf[1] = val >> 8;
+    buf[2] = val >> 16;
+    buf[3] = val >> 24;
+}
+
+static void _sbox(uint32_t *q)
+{
+    uint32_t x0, x1, x2, x3, x4, x5, x6, x7;
+    uint32_t y1, y2, y3, y4, y5, y6, y7, y8, y9;
+    uint32_t y10, y11, y12, y13, y14, y15, y16, y17, y18, y19;
+    uint32_t y20, y21;
+    uint32_t z0, z1, z2, z3, z4, z5, z6, z7, z8, z9;
+    uint32_t z10, z11, z12, z13, z14, z15, z16, z17;
+    uint32_t t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+    uint32_t t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+    uint32_t t20, t21, t22, t23, t24, t25, t26, t27, t28, t29;
+    uint32_t t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+    uint32_t t40, t41, t42, t43, t44, t45, t46, t47, t48, t49;
+    uint32_t t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+    uint32_t t60, t61, t62, t63, t64, t65, t66, t67;
+    uint32_t s0, s1, s2, s3, s4, s5, s6, s7;
+
+    x0 = q[7];
+    x1 = q[6];
+    x2 = q[5];
+    x3 = q[4];
+    x4 = q[3];
+    x5 = q[2];
+    x6 = q[1];
+    x7 = q[0];
+
+    /* top linear transformation */
+    y14 = x3 ^ x5;
+    y13 = x0 ^ x6;
+    y9 = x0 ^ x3;
+    y8 = x0 ^ x5;
+    t0 = x1 ^ x2;
+    y1 = t0 ^ x7;
+    y4 = y1 ^ x3;
+    y12 = y13 ^ y14;
+    y2 = y1 ^ x0;
+    y5 = y1 ^ x6;
+    y3 = y5 ^ y8;
+    t1 = x4 ^ y12;
+    y15 = t1 ^ x5;
+    y20 = t1 ^ x1;
+    y6 = y15 ^ x7;
+    y10 = y15 ^ t0;
+    y11 = y20 ^ y9;
+    y7 = x7 ^ y11;
+    y17 = y10 ^ y11;
+    y19 = y10 ^ y8;
+    y16 = t0 ^ y11;
+    y21 = y13 ^ y16;
+    y18 = x0 ^ y16;
+
+    /* non-linear section */
+    t2 = y12 & y15;
+    t3 = y3 & y6;
+    t4 = t3 ^ t2;
+    t5 = y4 & x7;
+    t6 = t5 ^ t2;
+    t7 = y13 & y16;
+    t8 = y5 & y1;
+    t9 = t8 ^ t7;
+    t10 = y2 & y7;
+    t11 = t10 ^ t7;
+    t12 = y9 & y11;
+    t13 = y14 & y17;
+    t14 = t13 ^ t12;
+    t15 = y8 & y10;
+    t16 = t15 ^ t12;
+    t17 = t4 ^ t14;
+    t18 = t6 ^ t16;
+    t19 = t9 ^ t14;
+    t20 = t11 ^ t16;
+    t21 = t17 ^ y20;
+    t22 = t18 ^ y19;
+    t23 = t19 ^ y21;
+    t24 = t20 ^ y18;
+
+    t25 = t21 ^ t22;
+    t26 = t21 & t23;
+    t27 = t24 ^ t26;
+    t28 = t25 & t27;
+    t29 = t28 ^ t22;
+    t30 = t23 ^ t24;
+    t31 = t22 ^ t26;
+    t32 = t31 & t30;
+    t33 = t32 ^ t24;
+    t34 = t23 ^ t33;
+    t35 = t27 ^ t33;
+    t36 = t24 & t35;
+    t37 = t36 ^ t34;
+    t38 = t27 ^ t36;
+    t39 = t29 & t38;
+    t40 = t25 ^ t39;
+
+    t41 = t40 ^ t37;
+    t42 = t29 ^ t33;
+    t43 = t29 ^ t40;
+    t44 = t33 ^ t37;
+    t45 = t42 ^ t41;
+    z0 = t44 & y15;
+    z1 = t37 & y6;
+    z2 = t33 & x7;
+    z3 = t43 & y16;
+    z4 = t40 & y1;
+    z5 = t29 & y7;
+    z6 = t42 & y11;
+    z7 = t45 & y17;
+    z8 = t41 & y10;
+    z9 = t44 & y12;
+    z10 = t37 & y3;
+    z11 = t33 & y4;
+    z12 = t43 & y13;
+    z13 = t40 & y5;
+    z14 = t29 & y2;
+    z15 = t42 & y9;
+    z16 = t45 & y14;
+    z17 = t41 & y8;
+
+    /* bottom linear transformation */
+    t46 = z15 ^ z16;
+    t47 = z10 ^ z11;
+    t48 = z5 ^ z13;
+    t49 = z9 ^ z10;
+    t50 = z2 ^ z12;
+    t51 = z2 ^ z5;
+    t52 = z7 ^ z8;
+    t53 = z0 ^ z3;
+    t54 = z6 ^ z7;
+    t55 = z16 ^ z17;
+    t56 = z12 ^ t48;
+    t57 = t50 ^ t53;
+    t58 = z4 ^ t46;
+    t59 = z3 ^ t54;
+    t60 = t46 ^ t57;
+    t61 = z14 ^ t57;
+    t62 = t52 ^ t58;
+    t63 = t49 ^ t58;
+    t64 = z4 ^ t59;
+    t65 = t61 ^ t62;
+    t66 = z1 ^ t63;
+    s0 = t59 ^ t63;
+    s6 = t56 ^ ~t62;
+    s7 = t48 ^ ~t60;
+    t67 = t64 ^ t65;
+    s3 = t53 ^ t66;
+    s4 = t51 ^ t66;
+    s5 = t47 ^ t65;
+    s1 = t64 ^ ~s3;
+    s2 = t55 ^ ~t67;
+
+    q[7] = s0;
+    q[6] = s1;
+    q[5] = s2;
+    q[4] = s3;
+    q[3] = s4;
+    q[2] = s5;
+    q[1] = s6;
+    q[0] = s7;
+}
+
+/* B(x) = inverse of the affine transform of the S-box, with x ^ 0x63 */
+static void _inv_affine(uint32_t *q)
+{
+    uint32_t q0 = ~q[0], q1 = ~q[1], q2 = q[2], q3 = q[3];
+    uint32_t q4 = q[4], q5 = ~q[5], q6 = ~q[6], q7 = q[7];
+
+    q[7] = q1 ^ q4 ^ q6;
+    q[6] = q0 ^ q3 ^ q5;
+    q[5] = q7 ^ q2 ^ q4;
+    q[4] = q6 ^ q1 ^ q3;
+    q[3] = q5 ^ q0 ^ q2;
+    q[2] = q4 ^ q7 ^ q1;
+    q[1] = q3 ^ q6 ^ q0;
+    q[0] = q2 ^ q5 ^ q7;
+}
+
+/* S^-1(x) = B(S(B(x ^ 0x63)) ^ 0x63), as inversion is an involution */
+static void _inv_sbox(uint32_t *q)
+{
+    _inv_affine(q);
+    _sbox(q);
+    _inv_affine(q);
+}
+
+#define SWAPN(cl, ch, s, x, y) do { \
+        uint32_t a = (x), b = (y); \
+        (x) = (a & (uint32_t)(cl)) | ((b & (uint32_t)(cl)) << (s)); \
+        (y) = ((a & (uint32_t)(ch)) >> (s)) | (b & (uint32_t)(ch)); \
+    } while (0)
+
+#define SWAP2(x, y)     SWAPN(0x55555555, 0xAAAAAAAA, 1, x, y)
+#define SWAP4(x, y)     SWAPN(0x33333333, 0xCCCCCCCC, 2, x, y)
+#define SWAP8(x, y)     SWAPN(0x0F0F0F0F, 0xF0F0F0F0, 4, x, y)
+
+/* converts between the words of two blocks and the bitsliced state, this is
+ * an involution */
+static void _ortho(uint32_t *q)
+{
+    SWAP2(q[0], q[1]);
+    SWAP2(q[2], q[3]);
+    SWAP2(q[4], q[5]);
+    SWAP2(q[6], q[7]);
+
+    SWAP4(q[0], q[2]);
+    SWAP4(q[1], q[3]);
+    SWAP4(q[4], q[6]);
+    SWAP4(q[5], q[7]);
+
+    SWAP8(q[0], q[4]);
+    SWAP8(q[1], q[5]);
+    SWAP8(q[2], q[6]);
+    SWAP8(q[3], q[7]);
+}
+
+static uint32_t _sub_word(uint32_t x)
+{
+    uint32_t q[8] = { x };
+
+    _ortho(q);
+    _sbox(q);
+    _ortho(q);
+    return q[0];
+}
+
+/* expands the key into the bitsliced round keys for two blocks */
+static void _keysched(uint32_t *skey, const uint8_t *key)
+{
+    static const uint8_t rcon[] = {
+        0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1b, 0x36
+    };
+    uint32_t tmp = 0;
+
+    for (unsigned i = 0; i < 4; i++) {
+        tmp = _dec32le(&key[i * 4]);
+        skey[i * 2] = skey[i * 2 + 1] = tmp;
+    }
+    for (unsigned i = 4; i < (ROUNDS + 1) * 4; i++) {
+        if ((i % 4) == 0) {
+            tmp = (tmp << 24) | (tmp >> 8);
+            tmp = _sub_word(tmp) ^ rcon[i / 4 - 1];
+        }
+        tmp ^= skey[(i - 4) * 2];
+        skey[i * 2] = skey[i * 2 + 1] = tmp;
+    }
+    for (unsigned i = 0; i <= ROUNDS; i++) {
+        _ortho(&skey[i * 8]);
+    }
+}
+
+static inline void _add_round_key(uint32_t *q, const uint32_t *sk)
+{
+    for (unsigned i = 0; i < 8; i++) {
+        q[i] ^= sk[i];
+    }
+}
+
+static inline void _shift_rows(uint32_t *q)
+{
+    for (unsigned i = 0; i < 8; i++) {
+        uint32_t x = q[i];
+
+        q[i] = (x & 0x000000FF)
+               | ((x & 0x0000FC00) >> 2) | ((x & 0x00000300) << 6)
+               | ((x & 0x00F00000) >> 4) | ((x & 0x000F0000) << 4)
+               | ((x & 0xC0000000) >> 6) | ((x & 0x3F000000) << 2);
+    }
+}
+
+static inline void _inv_shift_rows(uint32_t *q)
+{
+    for (unsigned i = 0; i < 8; i++) {
+        uint32_t x = q[i];
+
+        q[i] = (x & 0x000000FF)
+               | ((x & 0x00003F00) << 2) | ((x & 0x0000C000) >> 6)
+               | ((x & 0x000F0000) << 4) | ((x & 0x00F00000) >> 4)
+               | ((x & 0x03000000) << 6) | ((x & 0xFC000000) >> 2);
+    }
+}
+
+static inline uint32_t _rotr8(uint32_t x)
+{
+    return (x << 24) | (x >> 8);
+}
+
+static inline uint32_t _rotr16(uint32_t x)
+{
+    return (x << 16) | (x >> 16);
+}
+
+static void _mix_columns(uint32_t *q)
+{
+    uint32_t q0 = q[0], q1 = q[1], q2 = q[2], q3 = q[3];
+    uint32_t q4 = q[4], q5 = q[5], q6 = q[6], q7 = q[7];
+    uint32_t r0 = _rotr8(q0), r1 = _rotr8(q1), r2 = _rotr8(q2);
+    uint32_t r3 = _rotr8(q3), r4 = _rotr8(q4), r5 = _rotr8(q5);
+    uint32_t r6 = _rotr8(q6), r7 = _rotr8(q7);
+
+    /* 2 * (a0 + a1) + a1 + (a2 + a3) */
+    q[0] = q7 ^ r7 ^ r0 ^ _rotr16(q0 ^ r0);
+    q[1] = q0 ^ r0 ^ q7 ^ r7 ^ r1 ^ _rotr16(q1 ^ r1);
+    q[2] = q1 ^ r1 ^ r2 ^ _rotr16(q2 ^ r2);
+    q[3] = q2 ^ r2 ^ q7 ^ r7 ^ r3 ^ _rotr16(q3 ^ r3);
+    q[4] = q3 ^ r3 ^ q7 ^ r7 ^ r4 ^ _rotr16(q4 ^ r4);
+    q[5] = q4 ^ r4 ^ r5 ^ _rotr16(q5 ^ r5);
+    q[6] = q5 ^ r5 ^ r6 ^ _rotr16(q6 ^ r6);
+    q[7] = q6 ^ r6 ^ r7 ^ _rotr16(q7 ^ r7);
+}
+
+static inline void _xtime(uint32_t *q)
+{
+    uint32_t q7 = q[7];
+
+    q[7] = q[6];
+    q[6] = q[5];
+    q[5] = q[4];
+    q[4] = q[3] ^ q7;
+    q[3] = q[2] ^ q7;
+    q[2] = q[1];
+    q[1] = q[0] ^ q7;
+    q[0] = q7;
+}
+
+/* InvMixColumns is MixColumns after multiplying every column with
+ * {04}x^2 + {05}, i.e. a_i ^= 4 * (a_i ^ a_{i + 2}) */
+static void _inv_mix_columns(uint32_t *q)
+{
+    uint32_t t[8];
+
+    for (unsigned i = 0; i < 8; i++) {
+        t[i] = q[i] ^ _rotr16(q[i]);
+    }
+    _xtime(t);
+    _xtime(t);
+    for (unsigned i = 0; i < 8; i++) {
+        q[i] ^= t[i];
+    }
+    _mix_columns(q);
+}
+
+static void _encrypt(const uint32_t *skey, uint32_t *q)
+{
+    _add_round_key(q, skey);
+    for (unsigned u = 1; u < ROUNDS; u++) {
+        _sbox(q);
+        _shift_rows(q);
+        _mix_columns(q);
+        _add_round_key(q, skey + u * 8);
+    }
+    _sbox(q);
+    _shift_rows(q);
+    _add_round_key(q, skey + ROUNDS * 8);
+}
+
+static void _decrypt(const uint32_t *skey, uint32_t *q)
+{
+    _add_round_key(q, skey + ROUNDS * 8);
+    for (unsigned u = ROUNDS - 1; u > 0; u--) {
+        _inv_shift_rows(q);
+        _inv_sbox(q);
+        _add_round_key(q, skey + u * 8);
+        _inv_mix_columns(q);
+    }
+    _inv_shift_rows(q);
+    _inv_sbox(q);
+    _add_round_key(q, skey);
+}
+
+/* runs func on up to two blocks at once */
+static void _run(const cipher_context_t *context, const uint8_t *input,
+                 uint8_t *output, size_t numof,
+                 void (*func)(const uint32_t *, uint32_t *))
+{
+    uint32_t skey[(ROUNDS + 1) * 8];
+    uint32_t q[8];
+
+    _keysched(skey, context->context);
+
+    while (numof) {
+        unsigned n = (numof > 1) ? 2 : 1;
+
+        memset(q, 0, sizeof(q));
+        for (unsigned b = 0; b < n; b++) {
+            for (unsigned i = 0; i < 4; i++) {
+                q[i * 2 + b] = _dec32le(&input[b * 16 + i * 4]);
+            }
+        }
+        _ortho(q);
+        func(skey, q);
+        _ortho(q);
+        for (unsigned b = 0; b < n; b++) {
+            for (unsigned i = 0; i < 4; i++) {
+                _enc32le(&output[b * 16 + i * 4], q[i * 2 + b]);
+            }
+        }
+        input += n * AES_BLOCK_SIZE;
+        output += n * AES_BLOCK_SIZE;
+        numof -= n;
+    }
+
+    /* do not leave the key schedule on the stack */
+    crypto_secure_wipe(skey, sizeof(skey));
+}
+
+int aes_encrypt(const cipher_context_t *context, const uint8_t *plain_block,
+                uint8_t *cipher_block)
+{
+    return aes_encrypt_blocks(context, plain_block, cipher_block, 1);
+}
+
+int aes_decrypt(const cipher_context_t *context, const uint8_t *cipher_block,
+                uint8_t *plain_block)
+{
+    return aes_decrypt_blocks(context, cipher_block, plain_block, 1);
+}
+
+int aes_encrypt_blocks(const cipher_context_t *context, const uint8_t *input,
+                       uint8_t *output, size_t numof)
+{
+    _run(context, input, output, numof, _encrypt);
+    return 1;
+}
+
+int aes_decrypt_blocks(const cipher_context_t *context, const uint8_t *input,
+                       uint8_t *output, size_t numof)
+{
+    _run(context, input, output, numof, _decrypt);
+    return 1;
+}
+
+#endif /* MODULE_CRYPTO_AES_BITSLICE */
@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_crypto
+ * @{
+ *
+ * @file
+ * @brief       Implementation of the AES block functions using the AES-NI
+ *              instructions of x86 CPUs
+ *
+ * Only built for `native`. The instructions run in constant time, four
+ * blocks are processed in parallel to hide the latency of the instructions.
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <stdint.h>
+
+#include "crypto/aes.h"
+#include "crypto/ciphers.h"
+#include "crypto/helper.h"
+#include "kernel_defines.h"
+
+#if IS_USED(MODULE_CRYPTO_AES_NI)
+
+#include <wmmintrin.h>
+
+#define ROUNDS          (10U)
+#define INTERLEAVE      (4U)
+
+#define AES_NI          __attribute__((target("aes,sse2")))
+
+AES_NI
+static inline __m128i _expand(__m128i key, __m128i assist)
+{
+    assist = _mm_shuffle_epi32(assist, 0xff);
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    return _mm_xor_si128(key, assist);
+}
+
+/* the round constant must be an immediate, hence a macro */
+#define EXPAND(rk, i, rcon) \
+    rk[i] = _expand(rk[i - 1], _mm_aeskeygenassist_si128(rk[i - 1], rcon))
+
+AES_NI
+static void _keysched(__m128i *rk, const uint8_t *key)
+{
+    rk[0] = _mm_loadu_si128((const __m128i *)key);
+    EXPAND(rk, 1, 0x01);
+    EXPAND(rk, 2, 0x02);
+    EXPAND(rk, 3, 0x04);
+    EXPAND(rk, 4, 0x08);
+    EXPAND(rk, 5, 0x10);
+    EXPAND(rk, 6, 0x20);
+    EXPAND(rk, 7, 0x40);
+    EXPAND(rk, 8, 0x80);
+    EXPAND(rk, 9, 0x1b);
+    EXPAND(rk, 10, 0x36);
+}
+
+/* equivalent inverse cipher: reversed round keys, InvMixColumns applied to
+ * the inner ones */
+AES_NI
+static void _keysched_dec(__m128i *rk, const uint8_t *key)
+{
+    __m128i ek[ROUNDS + 1];
+
+    _keysched(ek, key);
+    rk[0] = ek[ROUNDS];
+    for (unsigned i = 1; i < ROUNDS; i++) {
+        rk[i] = _mm_aesimc_si128(ek[ROUNDS - i]);
+    }
+    rk[ROUNDS] = ek[0];
+    crypto_secure_wipe(ek, sizeof(ek));
+}
+
+AES_NI
+static void _encrypt(const __m128i *rk, __m128i *b, unsigned n)
+{
+    for (unsigned j = 0; j < n; j++) {
+        b[j] = _mm_xor_si128(b[j], rk[0]);
+    }
+    for (unsigned i = 1; i < ROUNDS; i++) {
+        for (unsigned j = 0; j < n; j++) {
+            b[j] = _mm_aesenc_si128(b[j], rk[i]);
+        }
+    }
+    for (unsigned j = 0; j < n; j++) {
+        b[j] = _mm_aesenclast_si128(b[j], rk[ROUNDS]);
+    }
+}
+
+AES_NI
+static void _decrypt(const __m128i *rk, __m128i *b, unsigned n)
+{
+    for (unsigned j = 0; j < n; j++) {
+        b[j] = _mm_xor_si128(b[j], rk[0]);
+    }
+    for (unsigned i = 1; i < ROUNDS; i++) {
+        for (unsigned j = 0; j < n; j++) {
+            b[j] = _mm_aesdec_si128(b[j], rk[i]);
+        }
+    }
+    for (unsigned j = 0; j < n; j++) {
+        b[j] = _mm_aesdeclast_si128(b[j], rk[ROUNDS]);
+    }
+}
+
+AES_NI
+static void _run(const __m128i *rk, const uint8_t *input, uint8_t *output,
+                 size_t numof, void (*func)(const __m128i *, __m128i *,
+                                            unsigned))
+{
+    __m128i b[INTERLEAVE];
+
+    while (numof) {
+        unsigned n = (numof > INTERLEAVE) ? INTERLEAVE : numof;
+
+        for (unsigned j = 0; j < n; j++) {
+            b[j] = _mm_loadu_si128((const __m128i *)&input[j * AES_BLOCK_SIZE]);
+        }
+        func(rk, b, n);
+        for (unsigned j = 0; j < n; j++) {
+            _mm_storeu_si128((__m128i *)&output[j * AES_BLOCK_SIZE], b[j]);
+        }
+        input += n * AES_BLOCK_SIZE;
+        output += n * AES_BLOCK_SIZE;
+        numof -= n;
+    }
+}
+
+int aes_encrypt(const cipher_context_t *context, const uint8_t *plain_block,
+                uint8_t *cipher_block)
+{
+    return aes_encrypt_blocks(context, plain_block, cipher_block, 1);
+}
+
+int aes_decrypt(const cipher_context_t *context, const uint8_t *cipher_block,
+                uint8_t *plain_block)
+{
+    return aes_decrypt_blocks(context, cipher_block, plain_block, 1);
+}
+
+AES_NI
+int aes_encrypt_blocks(const cipher_context_t *context, const uint8_t *input,
+                       uint8_t *output, size_t numof)
+{
+    __m128i rk[ROUNDS + 1];
+
+    assert(__builtin_cpu_supports("aes"));
+
+    _keysched(rk, context->context);
+    _run(rk, input, output, numof, _encrypt);
+    crypto_secure_wipe(rk, sizeof(rk));
+    return 1;
+}
+
+AES_NI
+int aes_decrypt_blocks(const cipher_context_t *context, const uint8_t *input,
+                       uint8_t *output, size_t numof)
+{
+    __m128i rk[ROUNDS + 1];
+
+    assert(__builtin_cpu_supports("aes"));
+
+    _keysched_dec(rk, context->context);
+    _run(rk, input, output, numof, _decrypt);
+    crypto_secure_wipe(rk, sizeof(rk));
+    return 1;
+}
+
+#endif /* MODULE_CRYPTO_AES_NI */
@@ -28,6 +28,8 @@
  *  - It is implemented for little code and data size, but will likely be
  *    slower than the refenrence implementation. Optimized implementation will
  *    out-perform the code even more.
+ *  - Where SIMD instructions are available, chacha_keystream_blocks()
+ *    computes four blocks at once, one in each lane of the vectors.
  */
 
 #include "crypto/chacha.h"
@@ -40,40 +42,91 @@
 
 #include <string.h>
 
-static void _r(uint32_t *d, uint32_t *a, const uint32_t *b, unsigned c)
+#define ROTL(x, n)      (((x) << (n)) | ((x) >> (32 - (n))))
+
+#define QUARTERROUND(a, b, c, d) \
+    do { \
+        a += b; d ^= a; d = ROTL(d, 16); \
+        c += d; b ^= c; b = ROTL(b, 12); \
+        a += b; d ^= a; d = ROTL(d,  8); \
+        c += d; b ^= c; b = ROTL(b,  7); \
+    } while (0)
+
+/* the rounds on any type, a word or a vector of words from several blocks */
+#define ROUNDS(x, rounds) \
+    for (unsigned i = 0; i < (rounds); i += 2) { \
+        QUARTERROUND(x[0], x[4], x[ 8], x[12]); \
+        QUARTERROUND(x[1], x[5], x[ 9], x[13]); \
+        QUARTERROUND(x[2], x[6], x[10], x[14]); \
+        QUARTERROUND(x[3], x[7], x[11], x[15]); \
+        QUARTERROUND(x[0], x[5], x[10], x[15]); \
+        QUARTERROUND(x[1], x[6], x[11], x[12]); \
+        QUARTERROUND(x[2], x[7], x[ 8], x[13]); \
+        QUARTERROUND(x[3], x[4], x[ 9], x[14]); \
+    }
+
+static void _block(uint8_t *output, const uint32_t input[16], uint8_t rounds)
 {
-    *a += *b;
-    uint32_t tmp = *a ^ *d;
-    *d = (tmp << c) | (tmp >> (32 - c));
+    uint32_t x[16];
+
+    memcpy(x, input, 64);
+    ROUNDS(x, rounds);
+
+    for (unsigned i = 0; i < 16; ++i) {
+        x[i] += input[i];
+    }
+    memcpy(output, x, 64);
 }
 
-static void _doubleround(void *output_, const uint32_t input[16],
-                         uint8_t rounds)
+static void _inc_counter(uint32_t state[16], uint32_t n)
 {
-    uint32_t *output = (uint32_t *)output_;
-
-    memcpy(output, input, 64);
-
-    rounds *= 4;
-    for (unsigned i = 0; i < rounds; ++i) {
-        /* cppcheck-suppress duplicateExpressionTernary
-         * (reason: Externally imported code beautification) */
-        uint32_t *a = &output[((i + ((i & 4) ? 0 : 0)) & 3) + (4 * 0)];
-        uint32_t *b = &output[((i + ((i & 4) ? 1 : 0)) & 3) + (4 * 1)];
-        uint32_t *c = &output[((i + ((i & 4) ? 2 : 0)) & 3) + (4 * 2)];
-        uint32_t *d = &output[((i + ((i & 4) ? 3 : 0)) & 3) + (4 * 3)];
-
-        _r(d, a, b, 16);
-        _r(b, c, d, 12);
-        _r(d, a, b,  8);
-        _r(b, c, d,  7);
+    state[12] += n;
+    if (state[12] < n) {
+        ++state[13];
     }
+}
+
+#if CHACHA_PARALLEL_BLOCKS > 1
+
+#if defined(__i386__) || defined(__x86_64__)
+#define SIMD            __attribute__((target("sse2")))
+#else
+#define SIMD
+#endif
+
+/* word i of CHACHA_PARALLEL_BLOCKS consecutive blocks */
+typedef uint32_t lane_t
+    __attribute__((vector_size(CHACHA_PARALLEL_BLOCKS * sizeof(uint32_t))));
+
+SIMD
+static void _blocks(uint8_t *output, const uint32_t input[16], uint8_t rounds)
+{
+    lane_t in[16], x[16];
+
+    for (unsigned i = 0; i < 16; i++) {
+        for (unsigned l = 0; l < CHACHA_PARALLEL_BLOCKS; l++) {
+            in[i][l] = input[i];
+        }
+    }
+    /* the 64 bit block counter of every lane */
+    for (unsigned l = 0; l < CHACHA_PARALLEL_BLOCKS; l++) {
+        in[12][l] += l;
+        in[13][l] += (in[12][l] < input[12]);
+    }
+
+    memcpy(x, in, sizeof(x));
+    ROUNDS(x, rounds);
 
     for (unsigned i = 0; i < 16; ++i) {
-        output[i] += input[i];
+        x[i] += in[i];
+        for (unsigned l = 0; l < CHACHA_PARALLEL_BLOCKS; l++) {
+            memcpy(&output[l * 64 + i * 4], &x[i][l], 4);
+        }
     }
 }
 
+#endif /* CHACHA_PARALLEL_BLOCKS > 1 */
+
 int chacha_init(chacha_ctx *ctx,
                 unsigned rounds,
                 const uint8_t *key, uint32_t keylen,
@@ -107,11 +160,24 @@ int chacha_init(chacha_ctx *ctx,
 
 void chacha_keystream_bytes(chacha_ctx *ctx, void *x)
 {
-    _doubleround(x, ctx->state, ctx->rounds);
+    _block(x, ctx->state, ctx->rounds);
+    _inc_counter(ctx->state, 1);
+}
+
+void chacha_keystream_blocks(chacha_ctx *ctx, void *x, size_t numof)
+{
+    uint8_t *out = x;
 
-    ++ctx->state[12];
-    if (ctx->state[12] == 0) {
-        ++ctx->state[13];
+#if CHACHA_PARALLEL_BLOCKS > 1
+    for (; numof >= CHACHA_PARALLEL_BLOCKS; numof -= CHACHA_PARALLEL_BLOCKS) {
+        _blocks(out, ctx->state, ctx->rounds);
+        _inc_counter(ctx->state, CHACHA_PARALLEL_BLOCKS);
+        out += CHACHA_PARALLEL_BLOCKS * 64;
+    }
+#endif
+    for (; numof; numof--) {
+        chacha_keystream_bytes(ctx, out);
+        out += 64;
     }
 }
 
@@ -27,6 +27,7 @@
  */
 
 #include "crypto/chacha.h"
+#include "kernel_defines.h"
 #include "mutex.h"
 
 #include <string.h>
@@ -54,10 +55,14 @@ uint32_t chacha_prng_next(void)
     mutex_lock(&_chacha_prng_mutex);
 
     if (--_chacha_prng_pos < 0) {
-        _chacha_prng_pos = 15;
-        chacha_keystream_bytes(&_chacha_prng_ctx, _chacha_prng_data);
+        _chacha_prng_pos = ARRAY_SIZE(_chacha_prng_data) - 1;
+        chacha_keystream_blocks(&_chacha_prng_ctx, _chacha_prng_data,
+                                sizeof(_chacha_prng_data) / 64);
     }
-    uint32_t result = _chacha_prng_data[_chacha_prng_pos];
+    /* the blocks are used in order, the words of each block from last to
+     * first, as when generating one block at a time */
+    uint32_t result = _chacha_prng_data[((63 - _chacha_prng_pos) & ~15) +
+                                        (_chacha_prng_pos & 15)];
 
     mutex_unlock(&_chacha_prng_mutex);
     return result;
@@ -46,6 +46,48 @@ int cipher_decrypt(const cipher_t *cipher, const uint8_t *input,
 }
 
 
+int cipher_encrypt_blocks(const cipher_t *cipher, const uint8_t *input,
+                          uint8_t *output, size_t numof)
+{
+    const cipher_interface_t *interface = cipher->interface;
+
+    if (interface->encrypt_blocks) {
+        return interface->encrypt_blocks(&cipher->context, input, output,
+                                         numof);
+    }
+    for (size_t i = 0; i < numof; i++) {
+        int res = interface->encrypt(&cipher->context,
+                                     input + i * interface->block_size,
+                                     output + i * interface->block_size);
+        if (res != 1) {
+            return res;
+        }
+    }
+    return 1;
+}
+
+
+int cipher_decrypt_blocks(const cipher_t *cipher, const uint8_t *input,
+                          uint8_t *output, size_t numof)
+{
+    const cipher_interface_t *interface = cipher->interface;
+
+    if (interface->decrypt_blocks) {
+        return interface->decrypt_blocks(&cipher->context, input, output,
+                                         numof);
+    }
+    for (size_t i = 0; i < numof; i++) {
+        int res = interface->decrypt(&cipher->context,
+                                     input + i * interface->block_size,
+                                     output + i * interface->block_size);
+        if (res != 1) {
+            return res;
+        }
+    }
+    return 1;
+}
+
+
 int cipher_get_block_size(const cipher_t *cipher)
 {
     return cipher->interface->block_size;
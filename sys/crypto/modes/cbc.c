@@ -58,7 +58,7 @@ int cipher_decrypt_cbc(const cipher_t *cipher, uint8_t iv[16],
                        const uint8_t *input, size_t length, uint8_t *output)
 {
     size_t offset = 0;
-    const uint8_t *input_block, *input_block_last;
+    const uint8_t *input_block_last;
     uint8_t block_size;
 
 
@@ -67,23 +67,24 @@ int cipher_decrypt_cbc(const cipher_t *cipher, uint8_t iv[16],
         return CIPHER_ERR_INVALID_LENGTH;
     }
 
+    /* unlike encryption, all blocks can be decrypted at once */
+    if (cipher_decrypt_blocks(cipher, input, output,
+                              length / block_size) != 1) {
+        return CIPHER_ERR_DEC_FAILED;
+    }
+
     input_block_last = iv;
-    do {
-        input_block = input + offset;
+    while (offset < length) {
         uint8_t *output_block = output + offset;
 
-        if (cipher_decrypt(cipher, input_block, output_block) != 1) {
-            return CIPHER_ERR_DEC_FAILED;
-        }
-
         /* CBC-Mode: XOR plaintext with ciphertext of (n-1)-th block */
         for (uint8_t i = 0; i < block_size; ++i) {
             output_block[i] ^= input_block_last[i];
         }
 
-        input_block_last = input_block;
+        input_block_last = input + offset;
         offset += block_size;
-    } while (offset < length);
+    }
 
     return offset;
 }
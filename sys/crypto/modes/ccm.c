@@ -19,12 +19,16 @@
  */
 
 #include <assert.h>
+#include <stdbool.h>
 #include <string.h>
 #include "debug.h"
 #include "crypto/helper.h"
-#include "crypto/modes/ctr.h"
 #include "crypto/modes/ccm.h"
 
+/* the CBC-MAC block and the key stream block are encrypted together */
+#define MAC(ccm)        ((ccm)->state)
+#define STREAM(ccm)     (&(ccm)->state[CCM_BLOCK_SIZE])
+
 static inline int min(int a, int b)
 {
     if (a < b) {
@@ -35,145 +39,201 @@ static inline int min(int a, int b)
     }
 }
 
-static int ccm_compute_cbc_mac(const cipher_t *cipher, const uint8_t iv[16],
-                               const uint8_t *input, size_t length, uint8_t *mac)
+/* Check if 'value' can be stored in 'num_bytes' */
+static inline int _fits_in_nbytes(size_t value, uint8_t num_bytes)
 {
-    uint8_t block_size, mac_enc[16] = { 0 };
-    uint32_t offset;
+    /* Not allowed to shift more or equal than left operand width
+     * So we shift by maximum num bits of size_t -1 and compare to 1
+     */
+    unsigned shift = (8 * min(sizeof(size_t), num_bytes)) - 1;
 
-    block_size = cipher_get_block_size(cipher);
-    memmove(mac, iv, 16);
-    offset = 0;
+    return (value >> shift) <= 1;
+}
 
-    /* no input message */
-    if(length == 0) {
-        return 0;
+/* CBC-MAC: XOR data into the pending block, encrypt it once it is full and
+ * more data follows */
+static int _mac_update(cipher_ccm_t *ccm, const uint8_t *data, size_t len)
+{
+    while (len--) {
+        if (ccm->pos == CCM_BLOCK_SIZE) {
+            if (cipher_encrypt(ccm->cipher, MAC(ccm), MAC(ccm)) != 1) {
+                return CIPHER_ERR_ENC_FAILED;
+            }
+            ccm->pos = 0;
+        }
+        MAC(ccm)[ccm->pos++] ^= *data++;
     }
+    return 0;
+}
 
-    do {
-        uint8_t block_size_input = (length - offset > block_size) ?
-                                   block_size : length - offset;
+/* encrypt the pending CBC-MAC block together with the next counter block */
+static int _next_block(cipher_ccm_t *ccm)
+{
+    memcpy(STREAM(ccm), ccm->counter, CCM_BLOCK_SIZE);
+    if (cipher_encrypt_blocks(ccm->cipher, MAC(ccm), MAC(ccm), 2) != 1) {
+        return CIPHER_ERR_ENC_FAILED;
+    }
+    crypto_block_inc_ctr(ccm->counter, CCM_BLOCK_SIZE - ccm->nonce_len);
+    ccm->pos = 0;
+    return 0;
+}
 
-        /* CBC-Mode: XOR plaintext with ciphertext of (n-1)-th block */
-        for (int i = 0; i < block_size_input; ++i) {
-            mac[i] ^= input[offset + i];
-        }
+static int _update(cipher_ccm_t *ccm, const uint8_t *input, size_t len,
+                   uint8_t *output, bool decrypt)
+{
+    if (len > ccm->remaining) {
+        return CCM_ERR_INVALID_DATA_LENGTH;
+    }
+    ccm->remaining -= len;
 
-        if (cipher_encrypt(cipher, mac, mac_enc) != 1) {
-            return CIPHER_ERR_ENC_FAILED;
+    for (size_t i = 0; i < len; i++) {
+        if (ccm->pos == CCM_BLOCK_SIZE) {
+            if (_next_block(ccm) < 0) {
+                return CIPHER_ERR_ENC_FAILED;
+            }
         }
-
-        memcpy(mac, mac_enc, block_size);
-        offset += block_size_input;
-    } while (offset < length);
-
-    return offset;
+        /* input and output may be the same buffer */
+        uint8_t out = input[i] ^ STREAM(ccm)[ccm->pos];
+        MAC(ccm)[ccm->pos++] ^= decrypt ? out : input[i];
+        output[i] = out;
+    }
+    return len;
 }
 
+/* computes the MAC, T xor S_0, into the CBC-MAC block */
+static int _finish(cipher_ccm_t *ccm)
+{
+    if (ccm->remaining) {
+        return CCM_ERR_INVALID_DATA_LENGTH;
+    }
+    /* A_0 is the counter block with the counter set to 0 */
+    memset(&ccm->counter[CCM_BLOCK_SIZE - ccm->length_encoding], 0,
+           ccm->length_encoding);
+    if (_next_block(ccm) < 0) {
+        return CIPHER_ERR_ENC_FAILED;
+    }
+    for (uint8_t i = 0; i < ccm->mac_length; ++i) {
+        MAC(ccm)[i] ^= STREAM(ccm)[i];
+    }
+    return 0;
+}
 
-static int ccm_create_mac_iv(const cipher_t *cipher, uint8_t auth_data_len, uint8_t M,
-                             uint8_t L, const uint8_t *nonce, uint8_t nonce_len,
-                             size_t plaintext_len, uint8_t X1[16])
+int cipher_ccm_init(cipher_ccm_t *ccm, const cipher_t *cipher,
+                    const uint8_t *auth_data, uint32_t auth_data_len,
+                    uint8_t mac_length, uint8_t length_encoding,
+                    const uint8_t *nonce, size_t nonce_len, size_t input_len)
 {
-    uint8_t M_, L_;
+    size_t len = input_len;
 
-    /* ensure everything is set to zero */
-    memset(X1, 0, 16);
+    if (mac_length % 2 != 0  || mac_length < 4 || mac_length > 16) {
+        return CCM_ERR_INVALID_MAC_LENGTH;
+    }
+
+    if (length_encoding < 2 || length_encoding > 8 ||
+        !_fits_in_nbytes(input_len, length_encoding)) {
+        return CCM_ERR_INVALID_LENGTH_ENCODING;
+    }
+
+    assert(cipher_get_block_size(cipher) == CCM_BLOCK_SIZE);
+    ccm->cipher = cipher;
+    ccm->remaining = input_len;
+    ccm->mac_length = mac_length;
+    ccm->length_encoding = length_encoding;
+    ccm->nonce_len = nonce_len;
+
+    /* Create B0 and leave it pending in the CBC-MAC state */
+    memset(MAC(ccm), 0, CCM_BLOCK_SIZE);
 
     /* set flags in B[0] - bit format:
             7        6     5..3  2..0
         Reserved   Adata    M_    L_    */
-    M_ = (M - 2) / 2;
-    L_ = L - 1;
-    X1[0] = 64 * (auth_data_len > 0) + 8 * M_ + L_;
+    MAC(ccm)[0] = 64 * (auth_data_len > 0) + 8 * ((mac_length - 2) / 2) +
+                  (length_encoding - 1);
 
     /* copy nonce to B[1..15-L] */
-    memcpy(&X1[1], nonce, min(nonce_len, 15 - L));
+    memcpy(&MAC(ccm)[1], nonce, min(nonce_len, 15 - length_encoding));
 
-    /* write plaintext_len to B[15..16-L] (reverse) */
-    for (uint8_t i = 15; i > 16 - L - 1; --i) {
-        X1[i] = plaintext_len & 0xff;
-        plaintext_len >>= 8;
+    /* write input_len to B[15..16-L] (reverse) */
+    for (uint8_t i = 15; i > 16 - length_encoding - 1; --i) {
+        MAC(ccm)[i] = len & 0xff;
+        len >>= 8;
     }
 
-    /* if there is still data, plaintext_len was too big */
-    if (plaintext_len > 0) {
-        return CIPHER_ERR_INVALID_LENGTH;
+    /* if there is still data, input_len was too big */
+    if (len > 0) {
+        return CCM_ERR_INVALID_DATA_LENGTH;
     }
+    ccm->pos = CCM_BLOCK_SIZE;
 
-    if (cipher_encrypt(cipher, X1, X1) != 1) {
-        return CIPHER_ERR_ENC_FAILED;
-    }
-    return 0;
-}
+    /* First counter block A1, S_0 is computed when finishing */
+    memset(ccm->counter, 0, CCM_BLOCK_SIZE);
+    ccm->counter[0] = length_encoding - 1;
+    memcpy(&ccm->counter[1], nonce,
+           min(nonce_len, (size_t)15 - length_encoding));
+    crypto_block_inc_ctr(ccm->counter, CCM_BLOCK_SIZE - nonce_len);
 
-static int ccm_compute_adata_mac(const cipher_t *cipher, const uint8_t *auth_data,
-                                 uint32_t auth_data_len, uint8_t X1[16])
-{
     if (auth_data_len > 0) {
-        int len;
-
-        /* Create a block with the encoded length. Block length is always 16 */
-        uint8_t auth_data_encoded[CCM_BLOCK_SIZE], len_encoding = 0;
+        uint8_t len_encoded[2];
 
         /* If 0 < l(a) < (2^16 - 2^8), then the length field is encoded as two
          * octets. (RFC3610 page 2)
          */
-        if (auth_data_len <= 0xFEFF) {
-            /* length (0x0001 ... 0xFEFF)  */
-            len_encoding = 2;
-
-            auth_data_encoded[1] = auth_data_len & 0xFF;
-            auth_data_encoded[0] = (auth_data_len >> 8) & 0xFF;
-        }
-        else {
+        if (auth_data_len > 0xFEFF) {
             DEBUG("UNSUPPORTED Adata length: %" PRIu32 "\n", auth_data_len);
             return -1;
         }
+        len_encoded[0] = (auth_data_len >> 8) & 0xFF;
+        len_encoded[1] = auth_data_len & 0xFF;
 
-        uint8_t auth_data_len_in_encoded =
-            (auth_data_len >=
-             (uint32_t)CCM_BLOCK_SIZE -
-             len_encoding) ? ((uint32_t)CCM_BLOCK_SIZE -
-                              len_encoding) :
-            auth_data_len;
-        memcpy(auth_data_encoded + len_encoding, auth_data,
-               auth_data_len_in_encoded);
-        /* Calculate the MAC over the first block of AAD + heading length encoding */
-        len = ccm_compute_cbc_mac(cipher, X1, auth_data_encoded,
-                                  auth_data_len_in_encoded + len_encoding, X1);
-
-        if (len < 0) {
-            return -1;
-        }
-
-        /* Calculate the MAC for the remainder of the AAD (if there is one) */
-        if (auth_data_len_in_encoded < auth_data_len) {
-            len = ccm_compute_cbc_mac(cipher, X1,
-                                      auth_data + auth_data_len_in_encoded,
-                                      auth_data_len - auth_data_len_in_encoded,
-                                      X1);
-            if (len < 0) {
-                return -1;
-            }
+        if ((_mac_update(ccm, len_encoded, sizeof(len_encoded)) < 0) ||
+            (_mac_update(ccm, auth_data, auth_data_len) < 0)) {
+            return CIPHER_ERR_ENC_FAILED;
         }
+        /* pad the additional data with zeros to a full block */
+        ccm->pos = CCM_BLOCK_SIZE;
     }
 
     return 0;
 }
 
+int cipher_ccm_encrypt_update(cipher_ccm_t *ccm, const uint8_t *input,
+                              size_t len, uint8_t *output)
+{
+    return _update(ccm, input, len, output, false);
+}
 
-/* Check if 'value' can be stored in 'num_bytes' */
-static inline int _fits_in_nbytes(size_t value, uint8_t num_bytes)
+int cipher_ccm_decrypt_update(cipher_ccm_t *ccm, const uint8_t *input,
+                              size_t len, uint8_t *output)
 {
-    /* Not allowed to shift more or equal than left operand width
-     * So we shift by maximum num bits of size_t -1 and compare to 1
-     */
-    unsigned shift = (8 * min(sizeof(size_t), num_bytes)) - 1;
+    return _update(ccm, input, len, output, true);
+}
 
-    return (value >> shift) <= 1;
+int cipher_ccm_encrypt_finish(cipher_ccm_t *ccm, uint8_t *mac)
+{
+    int res = _finish(ccm);
+
+    if (res < 0) {
+        return res;
+    }
+    res = ccm->mac_length;
+    memcpy(mac, MAC(ccm), res);
+    crypto_secure_wipe(ccm, sizeof(*ccm));
+    return res;
 }
 
+int cipher_ccm_decrypt_finish(cipher_ccm_t *ccm, const uint8_t *mac)
+{
+    int res = _finish(ccm);
+
+    if (res < 0) {
+        return res;
+    }
+    if (!crypto_equals(mac, MAC(ccm), ccm->mac_length)) {
+        res = CCM_ERR_INVALID_CBC_MAC;
+    }
+    crypto_secure_wipe(ccm, sizeof(*ccm));
+    return res;
+}
 
 int cipher_encrypt_ccm(const cipher_t *cipher,
                        const uint8_t *auth_data, uint32_t auth_data_len,
@@ -182,62 +242,27 @@ int cipher_encrypt_ccm(const cipher_t *cipher,
                        const uint8_t *input, size_t input_len,
                        uint8_t *output)
 {
-    int len = -1;
-    uint8_t nonce_counter[16] = { 0 }, mac_iv[16] = { 0 }, mac[16] = { 0 },
-            stream_block[16] = { 0 }, zero_block[16] = { 0 }, block_size;
-
-    if (mac_length % 2 != 0  || mac_length < 4 || mac_length > 16) {
-        return CCM_ERR_INVALID_MAC_LENGTH;
-    }
-
-    if (length_encoding < 2 || length_encoding > 8 ||
-        !_fits_in_nbytes(input_len, length_encoding)) {
-        return CCM_ERR_INVALID_LENGTH_ENCODING;
-    }
-
-    /* Create B0, encrypt it (X1) and use it as mac_iv */
-    block_size = cipher_get_block_size(cipher);
-    assert(block_size == CCM_BLOCK_SIZE);
-    if (ccm_create_mac_iv(cipher, auth_data_len, mac_length, length_encoding,
-                          nonce, nonce_len, input_len, mac_iv) < 0) {
-        return CCM_ERR_INVALID_DATA_LENGTH;
-    }
-
-    /* MAC calculation (T) with additional data and plaintext */
-    len = ccm_compute_adata_mac(cipher, auth_data, auth_data_len, mac_iv);
-    if (len < 0) {
-        return len;
-    }
+    cipher_ccm_t ccm;
+    int len, res;
 
-    len = ccm_compute_cbc_mac(cipher, mac_iv, input, input_len, mac);
-    if (len < 0) {
-        return len;
-    }
-
-    /* Compute first stream block */
-    nonce_counter[0] = length_encoding - 1;
-    memcpy(&nonce_counter[1], nonce,
-           min(nonce_len, (size_t)15 - length_encoding));
-    len = cipher_encrypt_ctr(cipher, nonce_counter, block_size,
-                             zero_block, block_size, stream_block);
-    if (len < 0) {
-        return len;
+    res = cipher_ccm_init(&ccm, cipher, auth_data, auth_data_len, mac_length,
+                          length_encoding, nonce, nonce_len, input_len);
+    if (res < 0) {
+        return res;
     }
 
-    /* Encrypt message in counter mode  */
-    crypto_block_inc_ctr(nonce_counter, block_size - nonce_len);
-    len = cipher_encrypt_ctr(cipher, nonce_counter, nonce_len, input,
-                             input_len, output);
+    len = cipher_ccm_encrypt_update(&ccm, input, input_len, output);
     if (len < 0) {
         return len;
     }
 
     /* auth value: mac ^ first stream block */
-    for (uint8_t i = 0; i < mac_length; ++i) {
-        output[len + i] = mac[i] ^ stream_block[i];
+    res = cipher_ccm_encrypt_finish(&ccm, output + len);
+    if (res < 0) {
+        return res;
     }
 
-    return len + mac_length;
+    return len + res;
 }
 
 
@@ -248,12 +273,9 @@ int cipher_decrypt_ccm(const cipher_t *cipher,
                        const uint8_t *input, size_t input_len,
                        uint8_t *plain)
 {
-    int len = -1;
-    uint8_t nonce_counter[16] = { 0 }, mac_iv[16] = { 0 }, mac[16] = { 0 },
-            mac_recv[16] = { 0 }, stream_block[16] = { 0 },
-            zero_block[16] = { 0 },
-            block_size;
+    cipher_ccm_t ccm;
     size_t plain_len;
+    int len, res;
 
     if (mac_length % 2 != 0  || mac_length < 4 || mac_length > 16) {
         return CCM_ERR_INVALID_MAC_LENGTH;
@@ -264,50 +286,22 @@ int cipher_decrypt_ccm(const cipher_t *cipher,
         return CCM_ERR_INVALID_LENGTH_ENCODING;
     }
 
-    /* Compute first stream block */
-    nonce_counter[0] = length_encoding - 1;
-    block_size = cipher_get_block_size(cipher);
-    assert(block_size == CCM_BLOCK_SIZE);
-    memcpy(&nonce_counter[1], nonce, min(nonce_len,
-                                         (size_t)15 - length_encoding));
-    len = cipher_encrypt_ctr(cipher, nonce_counter, block_size, zero_block,
-                             block_size, stream_block);
-    if (len < 0) {
-        return len;
-    }
-
-    /* Decrypt message in counter mode */
     plain_len = input_len - mac_length;
-    crypto_block_inc_ctr(nonce_counter, block_size - nonce_len);
-    len = cipher_encrypt_ctr(cipher, nonce_counter, nonce_len, input,
-                             plain_len, plain);
-    if (len < 0) {
-        return len;
-    }
-
-    /* Create B0, encrypt it (X1) and use it as mac_iv */
-    if (ccm_create_mac_iv(cipher, auth_data_len, mac_length, length_encoding,
-                          nonce, nonce_len, plain_len, mac_iv) < 0) {
-        return CCM_ERR_INVALID_DATA_LENGTH;
+    res = cipher_ccm_init(&ccm, cipher, auth_data, auth_data_len, mac_length,
+                          length_encoding, nonce, nonce_len, plain_len);
+    if (res < 0) {
+        return res;
     }
 
-    /* MAC calculation (T) with additional data and plaintext */
-    len = ccm_compute_adata_mac(cipher, auth_data, auth_data_len, mac_iv);
-    if (len < 0) {
-        return len;
-    }
-    len = ccm_compute_cbc_mac(cipher, mac_iv, plain, plain_len, mac);
+    len = cipher_ccm_decrypt_update(&ccm, input, plain_len, plain);
     if (len < 0) {
         return len;
     }
 
     /* mac = input[plain_len...plain_len+mac_length] ^ first stream block */
-    for (uint8_t i = 0; i < mac_length; ++i) {
-        mac_recv[i] = input[len + i] ^ stream_block[i];
-    }
-
-    if (!crypto_equals(mac_recv, mac, mac_length)) {
-        return CCM_ERR_INVALID_CBC_MAC;
+    res = cipher_ccm_decrypt_finish(&ccm, input + len);
+    if (res < 0) {
+        return res;
     }
 
     return plain_len;
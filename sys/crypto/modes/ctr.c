@@ -18,6 +18,8 @@
  * @}
  */
 
+#include <string.h>
+
 #include "crypto/helper.h"
 #include "crypto/modes/ctr.h"
 
@@ -26,26 +28,39 @@ int cipher_encrypt_ctr(const cipher_t *cipher, uint8_t nonce_counter[16],
                        uint8_t *output)
 {
     size_t offset = 0;
-    uint8_t stream_block[16] = { 0 }, block_size;
+    uint8_t block_size;
+    /* counter blocks are encrypted in batches, in place */
+    uint8_t stream[CONFIG_CIPHER_BATCH_BLOCKS * CIPHER_MAX_BLOCK_SIZE];
 
     block_size = cipher_get_block_size(cipher);
     do {
-        uint8_t block_size_input;
+        size_t stream_len = 0;
+        unsigned numof = 0;
+
+        do {
+            memcpy(&stream[stream_len], nonce_counter, block_size);
+            crypto_block_inc_ctr(nonce_counter, block_size - nonce_len);
+            stream_len += block_size;
+            numof++;
+        } while ((numof < CONFIG_CIPHER_BATCH_BLOCKS) &&
+                 (offset + stream_len < length));
 
-        if (cipher_encrypt(cipher, nonce_counter, stream_block) != 1) {
+        if (cipher_encrypt_blocks(cipher, stream, stream, numof) != 1) {
             return CIPHER_ERR_ENC_FAILED;
         }
 
-        block_size_input = (length - offset > block_size) ?
-                           block_size : length - offset;
-        for (uint8_t i = 0; i < block_size_input; ++i) {
-            output[offset + i] = stream_block[i] ^ input[offset + i];
+        if (stream_len > length - offset) {
+            stream_len = length - offset;
+        }
+        for (size_t i = 0; i < stream_len; ++i) {
+            output[offset + i] = stream[i] ^ input[offset + i];
         }
 
-        offset += block_size_input;
-        crypto_block_inc_ctr(nonce_counter, block_size - nonce_len);
+        offset += stream_len;
     } while (offset < length);
 
+    crypto_secure_wipe(stream, sizeof(stream));
+
     return offset;
 }
 
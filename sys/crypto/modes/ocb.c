@@ -77,33 +77,43 @@ static void xor_block(const uint8_t block1[16], const uint8_t block2[16],
     }
 }
 
-static void processBlock(ocb_state_t *state, size_t blockNumber,
-                         const uint8_t input[16], uint8_t output[16],
-                         uint8_t mode)
+static void processBlocks(ocb_state_t *state, size_t blockNumber,
+                          const uint8_t *input, uint8_t *output,
+                          size_t numof, uint8_t mode)
 {
-    /* Offset_i = Offset_{i-1} xor L_{ntz(i)} */
-    uint8_t l_i[16];
-
-    calculate_l_i(state->l_zero, ntz(blockNumber + 1), l_i);
-    xor_block(state->offset, l_i, state->offset);
-    /* Sum_i = Sum_{i-1} xor ENCIPHER(K, A_i xor Offset_i) */
-    uint8_t cipher_output[16], cipher_input[16];
-    xor_block(input, state->offset, cipher_input);
-    if (mode == OCB_MODE_ENCRYPT) {
-        state->cipher->interface->encrypt(&(state->cipher->context),
-                                          cipher_input, cipher_output);
-    }
-    else if (mode == OCB_MODE_DECRYPT) {
-        state->cipher->interface->decrypt(&(state->cipher->context),
-                                          cipher_input, cipher_output);
+    uint8_t offsets[CONFIG_CIPHER_BATCH_BLOCKS][16];
+    uint8_t cipher_data[CONFIG_CIPHER_BATCH_BLOCKS][16];
+
+    for (size_t j = 0; j < numof; ++j) {
+        /* Offset_i = Offset_{i-1} xor L_{ntz(i)} */
+        uint8_t l_i[16];
+
+        calculate_l_i(state->l_zero, ntz(blockNumber + j + 1), l_i);
+        xor_block(state->offset, l_i, state->offset);
+        memcpy(offsets[j], state->offset, 16);
+        xor_block(input + j * 16, offsets[j], cipher_data[j]);
+        /* Checksum_i = Checksum_{i-1} xor P_i */
+        if (mode == OCB_MODE_ENCRYPT) {
+            xor_block(state->checksum, input + j * 16, state->checksum);
+        }
     }
-    xor_block(state->offset, cipher_output, output);
-    /* Checksum_i = Checksum_{i-1} xor P_i */
+
+    /* C_i = Offset_i xor ENCIPHER(K, P_i xor Offset_i) */
+    /* P_i = Offset_i xor DECIPHER(K, C_i xor Offset_i) */
     if (mode == OCB_MODE_ENCRYPT) {
-        xor_block(state->checksum, input, state->checksum);
+        cipher_encrypt_blocks(state->cipher, cipher_data[0], cipher_data[0],
+                              numof);
     }
     else if (mode == OCB_MODE_DECRYPT) {
-        xor_block(state->checksum, output, state->checksum);
+        cipher_decrypt_blocks(state->cipher, cipher_data[0], cipher_data[0],
+                              numof);
+    }
+
+    for (size_t j = 0; j < numof; ++j) {
+        xor_block(offsets[j], cipher_data[j], output + j * 16);
+        if (mode == OCB_MODE_DECRYPT) {
+            xor_block(state->checksum, output + j * 16, state->checksum);
+        }
     }
 }
 
@@ -237,10 +247,13 @@ static int32_t run_ocb(const cipher_t *cipher,
 
     /* Process any whole blocks */
     size_t output_pos = 0;
-    for (size_t i = 0; i < m; ++i) {
-        processBlock(&state, i, input, output + output_pos, mode);
-        output_pos += 16;
-        input += 16;
+    for (size_t i = 0; i < m; i += CONFIG_CIPHER_BATCH_BLOCKS) {
+        size_t numof = (m - i > CONFIG_CIPHER_BATCH_BLOCKS) ?
+                       CONFIG_CIPHER_BATCH_BLOCKS : m - i;
+
+        processBlocks(&state, i, input, output + output_pos, numof, mode);
+        output_pos += numof * 16;
+        input += numof * 16;
     }
 
     /* Process any final partial block and compute raw tag */
@@ -33,13 +33,77 @@
 #include "xtimer.h"
 #endif
 
+#if IS_USED(MODULE_EVENT_ORDERED)
+#include "event/ordered.h"
+
+static uint32_t _key(clist_node_t *node)
+{
+    return container_of(node, event_ordered_t, super.list_node)->key;
+}
+
+/* inserts event behind all events with a key not after its key */
+static void _insert_ordered(event_queue_t *queue, event_ordered_t *event)
+{
+    clist_node_t *last = queue->event_list.next;
+    clist_node_t *node = &event->super.list_node;
+
+    /* appending is O(1), and the common case for monotonic deadlines */
+    if (!last || !event_ordered_before(event->key, _key(last))) {
+        clist_rpush(&queue->event_list, node);
+        return;
+    }
+
+    /* the event goes before last, so this stops at last at the latest */
+    clist_node_t *prev = last;
+    while (!event_ordered_before(event->key, _key(prev->next))) {
+        prev = prev->next;
+    }
+    node->next = prev->next;
+    prev->next = node;
+}
+
+void event_post_ordered(event_queue_t *queue, event_ordered_t *event,
+                        uint32_t key)
+{
+    assert(queue && event && queue->ordered);
+
+    unsigned state = irq_disable();
+    if (event->super.list_node.next) {
+        if (!event_ordered_before(key, event->key)) {
+            irq_restore(state);
+            return;
+        }
+        clist_remove(&queue->event_list, &event->super.list_node);
+    }
+    event->key = key;
+    _insert_ordered(queue, event);
+    thread_t *waiter = queue->waiter;
+    irq_restore(state);
+
+    if (waiter) {
+        thread_flags_set(waiter, THREAD_FLAG_EVENT);
+    }
+}
+#endif
+
+static void _push(event_queue_t *queue, event_t *event)
+{
+#if IS_USED(MODULE_EVENT_ORDERED)
+    if (queue->ordered) {
+        _insert_ordered(queue, container_of(event, event_ordered_t, super));
+        return;
+    }
+#endif
+    clist_rpush(&queue->event_list, &event->list_node);
+}
+
 void event_post(event_queue_t *queue, event_t *event)
 {
     assert(queue && event);
 
     unsigned state = irq_disable();
     if (!event->list_node.next) {
-        clist_rpush(&queue->event_list, &event->list_node);
+        _push(queue, event);
     }
     thread_t *waiter = queue->waiter;
     irq_restore(state);
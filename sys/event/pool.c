@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_event
+ * @{
+ *
+ * @file
+ * @brief       Event pool implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+
+#include "event/pool.h"
+#include "irq.h"
+#include "thread.h"
+#include "thread_flags.h"
+
+/* must be called with IRQs disabled */
+static void _remove_idle(event_pool_t *pool, thread_t *me)
+{
+    for (unsigned i = 0; i < pool->idle_numof; i++) {
+        if (pool->idle[i] == me) {
+            pool->idle[i] = pool->idle[--pool->idle_numof];
+            break;
+        }
+    }
+    pool->queue.waiter = pool->idle_numof ? pool->idle[pool->idle_numof - 1]
+                                          : NULL;
+}
+
+static void *_worker(void *arg)
+{
+    event_pool_t *pool = arg;
+    thread_t *me = thread_get_active();
+
+    while (1) {
+        unsigned state = irq_disable();
+        _remove_idle(pool, me);
+        event_t *event = container_of(clist_lpop(&pool->queue.event_list),
+                                      event_t, list_node);
+        if (event == NULL) {
+            pool->idle[pool->idle_numof++] = me;
+            pool->queue.waiter = me;
+            irq_restore(state);
+            thread_flags_wait_any(THREAD_FLAG_EVENT);
+            continue;
+        }
+
+        /* let the next idle worker take care of the remaining events */
+        thread_t *next = pool->queue.event_list.next ? pool->queue.waiter
+                                                     : NULL;
+        irq_restore(state);
+        if (next) {
+            thread_flags_set(next, THREAD_FLAG_EVENT);
+        }
+
+        event->list_node.next = NULL;
+        event->handler(event);
+    }
+
+    return NULL;
+}
+
+void event_pool_init(event_pool_t *pool, char *stacks, size_t stacksize,
+                     unsigned numof, uint8_t priority)
+{
+    assert(numof && (numof <= CONFIG_EVENT_POOL_WORKERS_MAX));
+
+    event_queue_init_detached(&pool->queue);
+    pool->idle_numof = 0;
+
+    for (unsigned i = 0; i < numof; i++) {
+        thread_create(stacks + i * stacksize, stacksize, priority,
+                      THREAD_CREATE_STACKTEST, _worker, pool, "event_pool");
+    }
+}
@@ -0,0 +1,180 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_hashes
+ * @{
+ *
+ * @file
+ * @brief       SHA-256 of several messages in lockstep
+ *
+ * Four messages are hashed at once, one per 32 bit lane of a 128 bit vector.
+ * This needs SIMD instructions (SSE2 on `native`, NEON on ARM application
+ * cores) to be faster than hashing the messages one after another, which is
+ * done on all other platforms and if the block function is accelerated by
+ * `hashes_sha2xx_hw`.
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "hashes/sha256.h"
+#include "hashes/sha2xx_common.h"
+#include "kernel_defines.h"
+
+#if defined(__i386__) || defined(__x86_64__)
+#define SIMD            __attribute__((target("sse2")))
+#define HAVE_SIMD
+#elif defined(__ARM_NEON)
+#define SIMD
+#define HAVE_SIMD
+#endif
+
+#ifdef HAVE_SIMD
+
+#define LANES           (4U)
+
+typedef uint32_t lane_t __attribute__((vector_size(LANES * sizeof(uint32_t))));
+
+static const uint32_t _iv[8] = {
+    0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A,
+    0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19,
+};
+
+static inline uint32_t _be32dec(const uint8_t *buf)
+{
+    return ((uint32_t)buf[0] << 24) | ((uint32_t)buf[1] << 16) |
+           ((uint32_t)buf[2] << 8) | buf[3];
+}
+
+/* transforms one block of every lane */
+SIMD
+static void _transform(lane_t *state, const uint8_t *const block[LANES])
+{
+    lane_t W[64];
+    lane_t S[8];
+
+    for (unsigned i = 0; i < 16; i++) {
+        for (unsigned l = 0; l < LANES; l++) {
+            W[i][l] = _be32dec(&block[l][i * 4]);
+        }
+    }
+    for (unsigned i = 16; i < 64; i++) {
+        W[i] = s1(W[i - 2]) + W[i - 7] + s0(W[i - 15]) + W[i - 16];
+    }
+
+    memcpy(S, state, sizeof(S));
+
+    for (unsigned i = 0; i < 64; ++i) {
+        lane_t e = S[(68 - i) % 8], f = S[(69 - i) % 8];
+        lane_t g = S[(70 - i) % 8], h = S[(71 - i) % 8];
+        lane_t t0 = h + S1(e) + Ch(e, f, g) + W[i] + K[i];
+
+        lane_t a = S[(64 - i) % 8], b = S[(65 - i) % 8];
+        lane_t c = S[(66 - i) % 8], d = S[(67 - i) % 8];
+        lane_t t1 = S0(a) + Maj(a, b, c);
+
+        S[(67 - i) % 8] = d + t0;
+        S[(71 - i) % 8] = t0 + t1;
+    }
+
+    for (unsigned i = 0; i < 8; i++) {
+        state[i] += S[i];
+    }
+}
+
+SIMD
+static void _hash_lanes(const uint8_t *const data[LANES], size_t len,
+                        uint8_t *const digests[LANES])
+{
+    lane_t state[8];
+    const uint8_t *block[LANES];
+    /* the last one or two blocks with the padding */
+    uint8_t tail[LANES][128];
+    size_t rem = len % 64;
+    size_t tail_len = (rem < 56) ? 64 : 128;
+    uint64_t bits = (uint64_t)len * 8;
+
+    for (unsigned i = 0; i < 8; i++) {
+        for (unsigned l = 0; l < LANES; l++) {
+            state[i][l] = _iv[i];
+        }
+    }
+
+    for (size_t off = 0; off + 64 <= len; off += 64) {
+        for (unsigned l = 0; l < LANES; l++) {
+            block[l] = data[l] + off;
+        }
+        _transform(state, block);
+    }
+
+    for (unsigned l = 0; l < LANES; l++) {
+        memset(tail[l], 0, sizeof(tail[l]));
+        memcpy(tail[l], data[l] + len - rem, rem);
+        tail[l][rem] = 0x80;
+        for (unsigned i = 0; i < 8; i++) {
+            tail[l][tail_len - 1 - i] = bits >> (i * 8);
+        }
+    }
+    for (size_t off = 0; off < tail_len; off += 64) {
+        for (unsigned l = 0; l < LANES; l++) {
+            block[l] = &tail[l][off];
+        }
+        _transform(state, block);
+    }
+
+    for (unsigned l = 0; l < LANES; l++) {
+        if (digests[l] == NULL) {
+            continue;
+        }
+        for (unsigned i = 0; i < 8; i++) {
+            digests[l][i * 4] = state[i][l] >> 24;
+            digests[l][i * 4 + 1] = state[i][l] >> 16;
+            digests[l][i * 4 + 2] = state[i][l] >> 8;
+            digests[l][i * 4 + 3] = state[i][l];
+        }
+    }
+}
+
+void sha256_multi(const void *const data[], size_t len,
+                  void *const digests[], unsigned numof)
+{
+    if (IS_USED(MODULE_HASHES_SHA2XX_HW)) {
+        for (unsigned i = 0; i < numof; i++) {
+            sha256(data[i], len, digests[i]);
+        }
+        return;
+    }
+
+    for (unsigned i = 0; i < numof; i += LANES) {
+        const uint8_t *lane_data[LANES];
+        uint8_t *lane_digests[LANES];
+
+        /* unused lanes hash the last message again, but are not stored */
+        for (unsigned l = 0; l < LANES; l++) {
+            unsigned msg = (i + l < numof) ? i + l : numof - 1;
+            lane_data[l] = data[msg];
+            lane_digests[l] = (i + l < numof) ? digests[msg] : NULL;
+        }
+        _hash_lanes(lane_data, len, lane_digests);
+    }
+}
+
+#else /* HAVE_SIMD */
+
+void sha256_multi(const void *const data[], size_t len,
+                  void *const digests[], unsigned numof)
+{
+    for (unsigned i = 0; i < numof; i++) {
+        sha256(data[i], len, digests[i]);
+    }
+}
+
+#endif /* HAVE_SIMD */
@@ -50,6 +50,7 @@
 #include <assert.h>
 
 #include "hashes/sha2xx_common.h"
+#include "kernel_defines.h"
 
 
 #ifdef __BIG_ENDIAN__
@@ -101,7 +102,8 @@ static void be32enc_vect(void *dst_, const void *src_, size_t len)
  * SHA256 block compression function.  The 256-bit state is transformed via
  * the 512-bit input block to produce a new state.
  */
-static void sha2xx_transform(uint32_t *state, const unsigned char block[64])
+static void sha2xx_transform_block(uint32_t *state,
+                                   const unsigned char block[64])
 {
     uint32_t W[64];
     uint32_t S[8];
@@ -135,6 +137,21 @@ static void sha2xx_transform(uint32_t *state, const unsigned char block[64])
     }
 }
 
+/* Transforms consecutive blocks, using the accelerator if there is one */
+static void sha2xx_transform(uint32_t *state, const unsigned char *blocks,
+                             size_t numof)
+{
+#if IS_USED(MODULE_HASHES_SHA2XX_HW)
+    if (sha2xx_hw_transform(state, blocks, numof) == 0) {
+        return;
+    }
+#endif
+    while (numof--) {
+        sha2xx_transform_block(state, blocks);
+        blocks += 64;
+    }
+}
+
 static unsigned char PAD[64] = {
     0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -191,15 +208,15 @@ void sha2xx_update(sha2xx_context_t *ctx, const void *data, size_t len)
     const unsigned char *src = data;
 
     memcpy(&ctx->buf[r], src, 64 - r);
-    sha2xx_transform(ctx->state, ctx->buf);
+    sha2xx_transform(ctx->state, ctx->buf, 1);
     src += 64 - r;
     len -= 64 - r;
 
-    /* Perform complete blocks */
-    while (len >= 64) {
-        sha2xx_transform(ctx->state, src);
-        src += 64;
-        len -= 64;
+    /* Perform complete blocks at once */
+    if (len >= 64) {
+        sha2xx_transform(ctx->state, src, len / 64);
+        src += len & ~(size_t)0x3f;
+        len &= 0x3f;
     }
 
     /* Copy left over data into buffer */
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_hashes_sha2xx_common
+ * @{
+ *
+ * @file
+ * @brief       SHA-224/256 block function using the SHA instructions of x86
+ *              CPUs (SHA-NI)
+ *
+ * Only built for `native`. If the host CPU lacks the instructions, the
+ * blocks are processed in software.
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdint.h>
+
+#include "hashes/sha2xx_common.h"
+#include "kernel_defines.h"
+
+#if IS_USED(MODULE_HASHES_SHA2XX_NI)
+
+#include <immintrin.h>
+
+#define SHA_NI          __attribute__((target("sha,sse4.1")))
+
+SHA_NI
+static void _transform(uint32_t state[8], const uint8_t *data, size_t numof)
+{
+    /* swaps the bytes of every 32 bit word */
+    const __m128i bswap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL,
+                                         0x0405060700010203ULL);
+    __m128i abef, cdgh, tmp;
+
+    /* the instructions expect the state as ABEF and CDGH */
+    tmp = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&state[0]), 0xb1);
+    cdgh = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&state[4]), 0x1b);
+    abef = _mm_alignr_epi8(tmp, cdgh, 8);
+    cdgh = _mm_blend_epi16(cdgh, tmp, 0xf0);
+
+    while (numof--) {
+        __m128i abef_save = abef, cdgh_save = cdgh;
+        /* msg[i % 4] holds W[4i .. 4i + 3] in round i */
+        __m128i msg[4];
+
+        for (unsigned i = 0; i < 4; i++) {
+            msg[i] = _mm_shuffle_epi8(
+                _mm_loadu_si128((const __m128i *)&data[i * 16]), bswap);
+        }
+
+        for (unsigned i = 0; i < 16; i++) {
+            tmp = _mm_add_epi32(msg[i % 4],
+                                _mm_loadu_si128((const __m128i *)&K[i * 4]));
+            cdgh = _mm_sha256rnds2_epu32(cdgh, abef, tmp);
+            tmp = _mm_shuffle_epi32(tmp, 0x0e);
+            abef = _mm_sha256rnds2_epu32(abef, cdgh, tmp);
+
+            if (i < 12) {
+                /* W[t] = s1(W[t-2]) + W[t-7] + s0(W[t-15]) + W[t-16] */
+                tmp = _mm_sha256msg1_epu32(msg[i % 4], msg[(i + 1) % 4]);
+                tmp = _mm_add_epi32(tmp, _mm_alignr_epi8(msg[(i + 3) % 4],
+                                                         msg[(i + 2) % 4], 4));
+                msg[i % 4] = _mm_sha256msg2_epu32(tmp, msg[(i + 3) % 4]);
+            }
+        }
+
+        abef = _mm_add_epi32(abef, abef_save);
+        cdgh = _mm_add_epi32(cdgh, cdgh_save);
+        data += 64;
+    }
+
+    tmp = _mm_shuffle_epi32(abef, 0x1b);
+    cdgh = _mm_shuffle_epi32(cdgh, 0xb1);
+    _mm_storeu_si128((__m128i *)&state[0], _mm_blend_epi16(tmp, cdgh, 0xf0));
+    _mm_storeu_si128((__m128i *)&state[4], _mm_alignr_epi8(cdgh, tmp, 8));
+}
+
+int sha2xx_hw_transform(uint32_t state[8], const void *blocks, size_t numof)
+{
+    if (!__builtin_cpu_supports("sha")) {
+        return -ENOTSUP;
+    }
+    _transform(state, blocks, numof);
+    return 0;
+}
+
+#endif /* MODULE_HASHES_SHA2XX_NI */
@@ -10,6 +10,56 @@
  * @defgroup    sys_benchmark Benchmark
  * @ingroup     sys
  * @brief       Framework for running simple runtime benchmarks
+ *
+ * Benchmark cases
+ * ===============
+ *
+ * A benchmark case (@ref benchmark_case_t) calls a function with an argument
+ * @ref benchmark_case_t::iterations times per sample. @ref benchmark_run
+ * first takes @ref CONFIG_BENCHMARK_WARMUP samples that are discarded (to
+ * fill caches, let lazy initialization happen, ...) and then
+ * @ref CONFIG_BENCHMARK_SAMPLES samples, from which it calculates the minimum,
+ * median, 99th percentile, maximum and mean time per call.
+ *
+ * The time is measured with the most precise clock available:
+ *
+ * - the DWT cycle counter on Cortex-M3, M4, M7 and M33,
+ * - `clock_gettime(CLOCK_MONOTONIC)` on native,
+ * - xtimer everywhere else.
+ *
+ * The overhead of reading the clock and of calling the function is
+ * measured once with an empty function and subtracted from every sample.
+ * Interrupts stay enabled, as a lot of the benchmarked code depends on them.
+ * The median is, therefore, the figure to compare between runs.
+ *
+ * Several cases using the same function with different arguments form a
+ * parameterized benchmark, @ref benchmark_case_t::param labels the argument in
+ * the output. @ref benchmark_run_all runs an array of cases and prints a line
+ * per case, as CSV or (with `CONFIG_BENCHMARK_OUTPUT_JSON`) as JSON. The
+ * output of two runs, e.g. on different commits, can be compared with
+ * `dist/tools/benchmark/compare.py`.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * static void _encode(void *arg)
+ * {
+ *     size_t len = (uintptr_t)arg;
+ *     ...
+ * }
+ *
+ * static const benchmark_case_t _cases[] = {
+ *     { .name = "encode", .param = "16", .func = _encode,
+ *       .arg = (void *)16, .iterations = 100 },
+ *     { .name = "encode", .param = "64", .func = _encode,
+ *       .arg = (void *)64, .iterations = 100 },
+ * };
+ *
+ * int main(void)
+ * {
+ *     benchmark_run_all(_cases, ARRAY_SIZE(_cases));
+ * }
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * The older @ref BENCHMARK_FUNC only measures the mean time of a loop.
  * @{
  *
  * @file
@@ -21,6 +71,7 @@
 #ifndef BENCHMARK_H
 #define BENCHMARK_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include "irq.h"
@@ -30,6 +81,86 @@
 extern "C" {
 #endif
 
+/**
+ * @brief   Number of samples taken and discarded before measuring
+ */
+#ifndef CONFIG_BENCHMARK_WARMUP
+#define CONFIG_BENCHMARK_WARMUP     (10U)
+#endif
+
+/**
+ * @brief   Number of samples the results are calculated from
+ */
+#ifndef CONFIG_BENCHMARK_SAMPLES
+#define CONFIG_BENCHMARK_SAMPLES    (100U)
+#endif
+
+/**
+ * @brief   Print results as JSON instead of CSV
+ */
+#ifdef DOXYGEN
+#define CONFIG_BENCHMARK_OUTPUT_JSON
+#endif
+
+/**
+ * @brief   A benchmark case
+ */
+typedef struct {
+    const char *name;           /**< name of the case */
+    const char *param;          /**< label of @p arg in the output, or NULL */
+    void (*func)(void *arg);    /**< function to benchmark */
+    void *arg;                  /**< argument passed to @p func */
+    uint32_t iterations;        /**< calls of @p func per sample, 0 is
+                                     treated as 1 */
+} benchmark_case_t;
+
+/**
+ * @brief   Results of a benchmark case, all times in ns per call
+ */
+typedef struct {
+    uint32_t samples;           /**< number of samples */
+    uint32_t min;               /**< fastest sample */
+    uint32_t median;            /**< median */
+    uint32_t p99;               /**< 99th percentile */
+    uint32_t max;               /**< slowest sample */
+    uint32_t mean;              /**< mean */
+} benchmark_result_t;
+
+/**
+ * @brief   Run a benchmark case
+ *
+ * @param[in]   bc      benchmark case to run
+ * @param[out]  res     results
+ */
+void benchmark_run(const benchmark_case_t *bc, benchmark_result_t *res);
+
+/**
+ * @brief   Print the header for the output of @ref benchmark_print_result
+ *
+ * Prints nothing with `CONFIG_BENCHMARK_OUTPUT_JSON`.
+ */
+void benchmark_print_header(void);
+
+/**
+ * @brief   Print the results of a benchmark case as a line of CSV or JSON
+ *
+ * @param[in]   bc      benchmark case the results belong to
+ * @param[in]   res     results
+ */
+void benchmark_print_result(const benchmark_case_t *bc,
+                            const benchmark_result_t *res);
+
+/**
+ * @brief   Run benchmark cases and print their results
+ *
+ * Prints a header, a line per case and a closing line
+ * `benchmark: <numof> cases run`.
+ *
+ * @param[in]   cases   benchmark cases to run
+ * @param[in]   numof   number of cases in @p cases
+ */
+void benchmark_run_all(const benchmark_case_t *cases, size_t numof);
+
 /**
  * @brief   Measure the runtime of a given function call
  *
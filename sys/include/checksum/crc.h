@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_checksum_crc    Generic CRC
+ * @ingroup     sys_checksum
+ * @brief       Table driven CRC of any width up to 32 bits
+ *
+ * The CRC is described by its parameters in the usual (Rocksoft) model, see
+ * @ref crc_params_t, and computed with a lookup table that is generated for
+ * these parameters by @ref crc_engine_init. The size of the table trades RAM
+ * against speed and is selected by a module:
+ *
+ * | Module                 | Table size (bytes)  | Speed (relative)    |
+ * |:---------------------- |:------------------- |:------------------- |
+ * | `checksum_crc_nibble`  | 64                  | 1/2                 |
+ * | (none)                 | 1024                | 1                   |
+ * | `checksum_crc_slice8`  | 8192                | ~4                  |
+ *
+ * On `native`, the module `checksum_crc_pclmul` additionally folds long
+ * buffers with the carry-less multiplication instructions of the host CPU.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * static crc_engine_t crc32;
+ *
+ * crc_engine_init(&crc32, &crc_params_crc32);
+ * uint32_t crc = crc_calc(&crc32, "123456789", 9);  // 0xcbf43926
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief   Generic CRC definitions
+ */
+#ifndef CHECKSUM_CRC_H
+#define CHECKSUM_CRC_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "kernel_defines.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if IS_USED(MODULE_CHECKSUM_CRC_NIBBLE) && IS_USED(MODULE_CHECKSUM_CRC_SLICE8)
+#error "checksum_crc_nibble and checksum_crc_slice8 are mutually exclusive"
+#endif
+
+/**
+ * @brief   Number of entries of the lookup table
+ */
+#if IS_USED(MODULE_CHECKSUM_CRC_NIBBLE)
+#define CRC_TABLE_SIZE          (16U)
+#elif IS_USED(MODULE_CHECKSUM_CRC_SLICE8)
+#define CRC_TABLE_SIZE          (8U * 256U)
+#else
+#define CRC_TABLE_SIZE          (256U)
+#endif
+
+/**
+ * @brief   Parameters of a CRC
+ */
+typedef struct {
+    uint32_t poly;          /**< generator polynomial, without the x^width
+                                 term and not reflected */
+    uint32_t init;          /**< initial value, not reflected */
+    uint32_t xorout;        /**< value XORed to the final CRC */
+    uint8_t width;          /**< width in bits, 1 to 32 */
+    bool reflected;         /**< input and output are reflected, i.e. the
+                                 least significant bit comes first */
+} crc_params_t;
+
+/**
+ * @brief   CRC engine, i.e. the parameters with the generated lookup table
+ */
+typedef struct {
+    const crc_params_t *params;         /**< parameters of the CRC */
+    uint32_t table[CRC_TABLE_SIZE];     /**< lookup table */
+#if IS_USED(MODULE_CHECKSUM_CRC_PCLMUL) || defined(DOXYGEN)
+    uint64_t fold[2];                   /**< constants for folding 16 bytes */
+#endif
+} crc_engine_t;
+
+/**
+ * @name    Commonly used CRCs
+ * @{
+ */
+extern const crc_params_t crc_params_crc8;          /**< CRC-8/NRSC-5, as
+                                                         @ref crc8 with poly
+                                                         0x31 and seed 0xff */
+extern const crc_params_t crc_params_crc16_ccitt;   /**< CRC-16/AUG-CCITT, as
+                                                         @ref crc16_ccitt_calc */
+extern const crc_params_t crc_params_crc16_kermit;  /**< CRC-16/KERMIT, the
+                                                         IEEE 802.15.4 FCS */
+extern const crc_params_t crc_params_crc32;         /**< CRC-32 (ISO-HDLC) as
+                                                         used by Ethernet,
+                                                         zlib, ... */
+extern const crc_params_t crc_params_crc32c;        /**< CRC-32C
+                                                         (Castagnoli) */
+/** @} */
+
+/**
+ * @brief   Generates the lookup table for a CRC
+ *
+ * @param[out] engine   engine to initialize
+ * @param[in]  params   parameters of the CRC, must stay valid while
+ *                      @p engine is used
+ */
+void crc_engine_init(crc_engine_t *engine, const crc_params_t *params);
+
+/**
+ * @brief   Starts an incremental CRC calculation
+ *
+ * @param[in] engine    CRC engine
+ *
+ * @return  intermediate value to pass to @ref crc_update
+ */
+uint32_t crc_start(const crc_engine_t *engine);
+
+/**
+ * @brief   Adds data to an incremental CRC calculation
+ *
+ * @param[in] engine    CRC engine
+ * @param[in] crc       intermediate value from @ref crc_start or
+ *                      @ref crc_update
+ * @param[in] data      data to add
+ * @param[in] len       length of @p data in bytes
+ *
+ * @return  intermediate value to pass to @ref crc_update or @ref crc_finish
+ */
+uint32_t crc_update(const crc_engine_t *engine, uint32_t crc,
+                    const void *data, size_t len);
+
+/**
+ * @brief   Finishes an incremental CRC calculation
+ *
+ * @param[in] engine    CRC engine
+ * @param[in] crc       intermediate value from @ref crc_start or
+ *                      @ref crc_update
+ *
+ * @return  the CRC of all data added
+ */
+uint32_t crc_finish(const crc_engine_t *engine, uint32_t crc);
+
+/**
+ * @brief   Calculates the CRC of a buffer
+ *
+ * @param[in] engine    CRC engine
+ * @param[in] data      data to calculate the CRC of
+ * @param[in] len       length of @p data in bytes
+ *
+ * @return  the CRC of @p data
+ */
+static inline uint32_t crc_calc(const crc_engine_t *engine,
+                                const void *data, size_t len)
+{
+    return crc_finish(engine, crc_update(engine, crc_start(engine), data, len));
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHECKSUM_CRC_H */
+/** @} */
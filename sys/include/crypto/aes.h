@@ -13,6 +13,21 @@
  * @file
  * @brief       Headers for the implementation of the AES cipher-algorithm
  *
+ * There are three implementations (backends) of the block functions, one is
+ * chosen at build time:
+ *
+ * - By default, AES is implemented with lookup tables (T-tables). This is
+ *   fast on most MCUs, but the run time depends on the key and the data
+ *   because of the memory accesses, which may leak the key through cache
+ *   timing on cores with a data cache.
+ * - The module `crypto_aes_bitslice` provides a bitsliced implementation
+ *   that does not use any lookup tables and runs in constant time. It
+ *   processes two blocks at once, so modes passing several blocks to
+ *   @ref aes_encrypt_blocks (e.g. CTR, CCM and OCB) are faster than
+ *   modes processing one block after another (e.g. CBC encryption).
+ * - The module `crypto_aes_ni` uses the AES instructions of x86 CPUs on
+ *   `native`. The host CPU must support AES-NI.
+ *
  * @author      Freie Universitaet Berlin, Computer Systems & Telematics
  * @author      Nicolai Schmittberger <nicolai.schmittberger@fu-berlin.de>
  * @author      Fabrice Bellard
@@ -28,11 +43,16 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include "crypto/ciphers.h"
+#include "kernel_defines.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+#if IS_USED(MODULE_CRYPTO_AES_BITSLICE) && IS_USED(MODULE_CRYPTO_AES_NI)
+#error "crypto_aes_bitslice and crypto_aes_ni are mutually exclusive"
+#endif
+
 typedef uint32_t u32;
 typedef uint16_t u16;
 typedef uint8_t u8;
@@ -126,6 +146,44 @@ int aes_encrypt(const cipher_context_t *context, const uint8_t *plain_block,
 int aes_decrypt(const cipher_context_t *context, const uint8_t *cipher_block,
                 uint8_t *plain_block);
 
+/**
+ * @brief   encrypts several consecutive blocks
+ *
+ * The key schedule is only computed once for all blocks.
+ *
+ * @param       context       the cipher_context_t-struct to use for this
+ *                            encryption
+ * @param       input         @p numof plaintext blocks
+ * @param       output        where the @p numof ciphertext blocks will be
+ *                            stored, may be the same as @p input
+ * @param       numof         number of blocks
+ *
+ * @return  1 on success
+ * @return  A negative value if the cipher key cannot be expanded with the
+ *          AES key schedule
+ */
+int aes_encrypt_blocks(const cipher_context_t *context, const uint8_t *input,
+                       uint8_t *output, size_t numof);
+
+/**
+ * @brief   decrypts several consecutive blocks
+ *
+ * The key schedule is only computed once for all blocks.
+ *
+ * @param       context       the cipher_context_t-struct to use for this
+ *                            decryption
+ * @param       input         @p numof ciphertext blocks
+ * @param       output        where the @p numof plaintext blocks will be
+ *                            stored, may be the same as @p input
+ * @param       numof         number of blocks
+ *
+ * @return  1 on success
+ * @return  A negative value if the cipher key cannot be expanded with the
+ *          AES key schedule
+ */
+int aes_decrypt_blocks(const cipher_context_t *context, const uint8_t *input,
+                       uint8_t *output, size_t numof);
+
 #ifdef __cplusplus
 }
 #endif
@@ -41,6 +41,20 @@
 extern "C" {
 #endif
 
+/**
+ * @brief   Number of key stream blocks computed at once
+ *
+ * Blocks are computed four at a time in the lanes of SIMD registers on
+ * platforms with SSE2 (`native`) or NEON. Passing at least this many blocks
+ * to chacha_keystream_blocks() makes use of that.
+ */
+#if defined(__i386__) || defined(__x86_64__) || defined(__ARM_NEON) || \
+    defined(DOXYGEN)
+#define CHACHA_PARALLEL_BLOCKS  (4U)
+#else
+#define CHACHA_PARALLEL_BLOCKS  (1U)
+#endif
+
 /**
  * @brief A ChaCha cipher stream context.
  * @details Initialize with chacha_init().
@@ -81,6 +95,19 @@ int chacha_init(chacha_ctx *ctx,
  */
 void chacha_keystream_bytes(chacha_ctx *ctx, void *x);
 
+/**
+ * @brief Generate the next blocks in the keystream.
+ *
+ * @details Equivalent to calling chacha_keystream_bytes() @p numof times,
+ *          but faster on platforms that compute several blocks at once, see
+ *          @ref CHACHA_PARALLEL_BLOCKS.
+ *
+ * @param[in,out] ctx   The ChaCha context
+ * @param[out]    x     The blocks of the keystream (`64 * numof` bytes).
+ * @param[in]     numof Number of blocks.
+ */
+void chacha_keystream_blocks(chacha_ctx *ctx, void *x, size_t numof);
+
 /**
  * @brief Encode or decode a block of data.
  *
@@ -22,6 +22,7 @@
 #ifndef CRYPTO_CIPHERS_H
 #define CRYPTO_CIPHERS_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -34,6 +35,17 @@ extern "C" {
 #define CIPHERS_MAX_KEY_SIZE 20
 #define CIPHER_MAX_BLOCK_SIZE 16
 
+/**
+ * @brief   Number of blocks the block cipher modes pass to the cipher at once
+ *
+ * Ciphers providing @ref cipher_interface_st::encrypt_blocks can process
+ * several blocks faster than one block at a time. Every block costs
+ * @ref CIPHER_MAX_BLOCK_SIZE bytes of stack in the modes.
+ */
+#ifndef CONFIG_CIPHER_BATCH_BLOCKS
+#define CONFIG_CIPHER_BATCH_BLOCKS 4
+#endif
+
 /**
  * Context sizes needed for the different ciphers.
  * Always order by number of bytes descending!!! <br><br>
@@ -89,6 +101,14 @@ typedef struct cipher_interface_st {
     /** the decrypt function */
     int (*decrypt)(const cipher_context_t *ctx, const uint8_t *cipher_block,
                    uint8_t *plain_block);
+
+    /** encrypt several consecutive blocks, may be NULL */
+    int (*encrypt_blocks)(const cipher_context_t *ctx, const uint8_t *input,
+                          uint8_t *output, size_t numof);
+
+    /** decrypt several consecutive blocks, may be NULL */
+    int (*decrypt_blocks)(const cipher_context_t *ctx, const uint8_t *input,
+                          uint8_t *output, size_t numof);
 } cipher_interface_t;
 
 
@@ -162,6 +182,42 @@ int cipher_decrypt(const cipher_t *cipher, const uint8_t *input,
                    uint8_t *output);
 
 
+/**
+ * @brief Encrypt several consecutive blocks
+ *
+ * This is faster than calling @ref cipher_encrypt for every block with
+ * ciphers that process several blocks at once or have to expand the key for
+ * every call (like AES).
+ *
+ * @param cipher     Already initialized cipher struct
+ * @param input      pointer to input data to encrypt, @p numof blocks
+ * @param output     pointer to allocated memory for encrypted data, may be
+ *                   the same as @p input
+ * @param numof      number of blocks
+ *
+ * @return           1 in case of success
+ * @return           A negative value for an error
+ */
+int cipher_encrypt_blocks(const cipher_t *cipher, const uint8_t *input,
+                          uint8_t *output, size_t numof);
+
+
+/**
+ * @brief Decrypt several consecutive blocks
+ *
+ * @param cipher     Already initialized cipher struct
+ * @param input      pointer to input data to decrypt, @p numof blocks
+ * @param output     pointer to allocated memory for decrypted data, may be
+ *                   the same as @p input
+ * @param numof      number of blocks
+ *
+ * @return           1 in case of success
+ * @return           A negative value for an error
+ */
+int cipher_decrypt_blocks(const cipher_t *cipher, const uint8_t *input,
+                          uint8_t *output, size_t numof);
+
+
 /**
  * @brief Get block size of cipher
  * *
@@ -20,6 +20,9 @@
 #ifndef CRYPTO_MODES_CCM_H
 #define CRYPTO_MODES_CCM_H
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include "crypto/ciphers.h"
 
 #ifdef __cplusplus
@@ -47,6 +50,120 @@ extern "C" {
  */
 #define CCM_MAC_MAX_LEN                     16
 
+/**
+ * @brief State of an incremental CCM encryption or decryption
+ *
+ * The CBC-MAC and the key stream are computed in a single pass over the
+ * data: every block of data costs one call to @ref cipher_encrypt_blocks
+ * with two blocks, which ciphers processing several blocks at once handle
+ * in the time of one block.
+ *
+ * @note    The contents of this struct are private
+ */
+typedef struct {
+    const cipher_t *cipher;             /**< cipher in use */
+    uint8_t state[2 * CCM_BLOCK_SIZE];  /**< CBC-MAC block, key stream block */
+    uint8_t counter[CCM_BLOCK_SIZE];    /**< next counter block */
+    size_t remaining;                   /**< bytes of input still expected */
+    uint8_t pos;                        /**< bytes used of the current block */
+    uint8_t mac_length;                 /**< length of the MAC */
+    uint8_t length_encoding;            /**< length of the length field */
+    uint8_t nonce_len;                  /**< length of the nonce */
+} cipher_ccm_t;
+
+/**
+ * @brief Start an incremental encryption or decryption in ccm mode
+ *
+ * As CCM authenticates the length of the data first, the total length of
+ * the data passed to the update function must be known in advance.
+ *
+ * @param ccm              CCM state to initialize
+ * @param cipher           Already initialized cipher struct
+ * @param auth_data        Additional data to authenticate in MAC
+ * @param auth_data_len    Length of additional data, max (2^16 - 2^8)
+ * @param mac_length       length of the MAC (between 4 and 16 - only even
+ *                         values)
+ * @param length_encoding  maximal supported length of plaintext
+ *                         (2^(8*length_enc)).
+ * @param nonce            Nounce for ctr mode encryption
+ * @param nonce_len        Length of the nonce in octets
+ *                         (maximum: 15-length_encoding)
+ * @param input_len        total length of the plaintext
+ *
+ * @return                 0 on success
+ * @return                 A negative error code if something went wrong
+ */
+int cipher_ccm_init(cipher_ccm_t *ccm, const cipher_t *cipher,
+                    const uint8_t *auth_data, uint32_t auth_data_len,
+                    uint8_t mac_length, uint8_t length_encoding,
+                    const uint8_t *nonce, size_t nonce_len, size_t input_len);
+
+/**
+ * @brief Encrypt the next part of the plaintext in ccm mode
+ *
+ * Parts can be of any length, not only multiples of the block size.
+ *
+ * @param ccm              CCM state
+ * @param input            next part of the plaintext
+ * @param len              length of @p input
+ * @param output           memory for the ciphertext, @p len bytes, may be the
+ *                         same as @p input
+ *
+ * @return                 @p len on success
+ * @return                 @ref CCM_ERR_INVALID_DATA_LENGTH if the total
+ *                         length exceeds the length given on initialization
+ * @return                 A negative error code if something else went wrong
+ */
+int cipher_ccm_encrypt_update(cipher_ccm_t *ccm, const uint8_t *input,
+                              size_t len, uint8_t *output);
+
+/**
+ * @brief Decrypt the next part of the ciphertext in ccm mode
+ *
+ * @warning The plaintext must not be used before
+ *          @ref cipher_ccm_decrypt_finish verified the MAC.
+ *
+ * @param ccm              CCM state
+ * @param input            next part of the ciphertext, without the MAC
+ * @param len              length of @p input
+ * @param output           memory for the plaintext, @p len bytes, may be the
+ *                         same as @p input
+ *
+ * @return                 @p len on success
+ * @return                 @ref CCM_ERR_INVALID_DATA_LENGTH if the total
+ *                         length exceeds the length given on initialization
+ * @return                 A negative error code if something else went wrong
+ */
+int cipher_ccm_decrypt_update(cipher_ccm_t *ccm, const uint8_t *input,
+                              size_t len, uint8_t *output);
+
+/**
+ * @brief Finish an incremental encryption in ccm mode and get the MAC
+ *
+ * @param ccm              CCM state, wiped afterwards
+ * @param mac              memory for the MAC, mac_length bytes
+ *
+ * @return                 Length of the MAC on success
+ * @return                 @ref CCM_ERR_INVALID_DATA_LENGTH if less data than
+ *                         announced on initialization was encrypted
+ * @return                 A negative error code if something else went wrong
+ */
+int cipher_ccm_encrypt_finish(cipher_ccm_t *ccm, uint8_t *mac);
+
+/**
+ * @brief Finish an incremental decryption in ccm mode and verify the MAC
+ *
+ * @param ccm              CCM state, wiped afterwards
+ * @param mac              received MAC, mac_length bytes
+ *
+ * @return                 0 if the MAC is valid
+ * @return                 @ref CCM_ERR_INVALID_CBC_MAC if the MAC is invalid
+ * @return                 @ref CCM_ERR_INVALID_DATA_LENGTH if less data than
+ *                         announced on initialization was decrypted
+ * @return                 A negative error code if something else went wrong
+ */
+int cipher_ccm_decrypt_finish(cipher_ccm_t *ccm, const uint8_t *mac);
+
 /**
  * @brief Encrypt and authenticate data of arbitrary length in ccm mode.
  *
@@ -17,7 +17,8 @@
  *
  * An event queue is basically a FIFO queue of events, with some functions to
  * efficiently and safely handle adding and getting events to / from such a
- * queue.
+ * queue. With the module `event_ordered`, queues ordered by priority or
+ * deadline are available as well (see event/ordered.h).
  *
  * An event queue is bound to a thread, but any thread or ISR can put events
  * into a queue. In most cases, the owning thread of a queue is set during the
@@ -96,6 +97,7 @@
 #ifndef EVENT_H
 #define EVENT_H
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
 
@@ -151,6 +153,10 @@ struct event {
 typedef struct PTRTAG {
     clist_node_t event_list;    /**< list of queued events              */
     thread_t *waiter;           /**< thread owning event queue          */
+#if IS_USED(MODULE_EVENT_ORDERED) || defined(DOXYGEN)
+    bool ordered;               /**< events are ordered by their key,
+                                     see event/ordered.h                */
+#endif
 } event_queue_t;
 
 /**
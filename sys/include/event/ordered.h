@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_event
+ * @brief       Event queues ordered by priority or deadline
+ *
+ * By default, an event queue is a FIFO. An ordered event queue instead
+ * handles its events in the order of a key given with every event, the event
+ * with the earliest key first. Events with the same key are handled in the
+ * order they were posted. The key can be
+ *
+ * - a priority, lower values are handled first, or
+ * - an absolute deadline, e.g. from `ztimer_now(ZTIMER_USEC)`, which makes
+ *   the queue handle the event with the earliest deadline first.
+ *
+ * Keys are compared like time stamps, so deadlines may wrap around. Hence,
+ * the keys of the events in a queue must be less than 2^31 apart.
+ *
+ * Events in an ordered queue must be of type @ref event_ordered_t.
+ * @ref event_post_ordered sets the key and posts the event. Posting an event
+ * that already is in the queue coalesces both posts: the event is moved
+ * forward if the new key is earlier and stays where it is otherwise.
+ * @ref event_post, and thus an @ref event_timeout_t, posts the event with the
+ * key that is already set in the event.
+ *
+ * All functions taking events from a queue, e.g. @ref event_wait_multi or
+ * @ref event_loop, work with ordered queues as well.
+ *
+ * Events are kept in a sorted list. Posting an event with a key that is not
+ * before the key of the last event in the queue (e.g. deadlines that are
+ * always the same time in the future) and taking an event are O(1), other
+ * posts are O(n) with IRQs disabled. If only a few fixed priorities are
+ * needed, use one FIFO queue per priority with @ref event_wait_multi instead,
+ * which is O(1) in all cases.
+ *
+ * Example:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * static event_ordered_t radio_event = { .super.handler = _radio_handler };
+ * static event_ordered_t sensor_event = { .super.handler = _sensor_handler };
+ * static event_queue_t queue;
+ *
+ * [...] event_queue_init_ordered(&queue);
+ *
+ * [...] event_post_ordered(&queue, &sensor_event,
+ *                          ztimer_now(ZTIMER_USEC) + 100000);
+ * [...] event_post_ordered(&queue, &radio_event,
+ *                          ztimer_now(ZTIMER_USEC) + 500);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief       Ordered event queue API
+ */
+
+#ifndef EVENT_ORDERED_H
+#define EVENT_ORDERED_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "event.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Event of an ordered event queue
+ */
+typedef struct {
+    event_t super;              /**< event_t structure that gets extended */
+    uint32_t key;               /**< priority or deadline of the event    */
+} event_ordered_t;
+
+/**
+ * @brief   Check whether a key is before another one
+ *
+ * @param[in]   a       key to check
+ * @param[in]   b       key to compare to
+ *
+ * @return      true if @p a is before @p b
+ */
+static inline bool event_ordered_before(uint32_t a, uint32_t b)
+{
+    return (int32_t)(a - b) < 0;
+}
+
+/**
+ * @brief   Initialize an ordered event queue
+ *
+ * This will set the calling thread as owner of @p queue.
+ *
+ * @param[out]  queue   event queue object to initialize
+ */
+static inline void event_queue_init_ordered(event_queue_t *queue)
+{
+    event_queue_init(queue);
+    queue->ordered = true;
+}
+
+/**
+ * @brief   Initialize an ordered event queue not binding it to a thread
+ *
+ * @param[out]  queue   event queue object to initialize
+ */
+static inline void event_queue_init_ordered_detached(event_queue_t *queue)
+{
+    event_queue_init_detached(queue);
+    queue->ordered = true;
+}
+
+/**
+ * @brief   Queue an event with the given key
+ *
+ * If @p event is already queued in @p queue, it is moved forward if @p key
+ * is before its current key and left untouched otherwise.
+ *
+ * @pre     @p queue is an ordered queue
+ * @pre     @p event is not queued in another queue
+ *
+ * @param[in]   queue   event queue to queue event in
+ * @param[in]   event   event to queue in event queue
+ * @param[in]   key     priority or deadline of @p event
+ */
+void event_post_ordered(event_queue_t *queue, event_ordered_t *event,
+                        uint32_t key);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* EVENT_ORDERED_H */
+/** @} */
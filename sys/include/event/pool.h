@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_event
+ * @brief       Event queue handled by a pool of worker threads
+ *
+ * A regular event queue is handled by a single thread, so an event handler
+ * that blocks (e.g. waiting for a peripheral, a lock or the network) delays
+ * all events queued after it. An event pool shares one event queue between
+ * up to @ref CONFIG_EVENT_POOL_WORKERS_MAX worker threads. While one worker
+ * is blocked in a handler, the other workers keep taking events from the
+ * queue.
+ *
+ * Events are posted with @ref event_post to @ref event_pool_t::queue, so
+ * @ref event_t, @ref event_callback_t and @ref event_timeout_t are used
+ * exactly as with other queues. Idle workers wait in a stack, the most
+ * recently idle worker (whose stack is most likely still cached) is woken
+ * first. A worker taking an event from a queue with more events wakes the
+ * next idle worker.
+ *
+ * @note    RIOT runs threads on a single CPU, also on `native` and on
+ *          multi-core MCUs. Hence, a pool does not speed up handlers that
+ *          keep the CPU busy, it only allows other events to be handled
+ *          while a handler is blocked. As a consequence, handlers of the same
+ *          pool may run concurrently and must protect shared data.
+ *
+ * Example:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * static char stacks[2][THREAD_STACKSIZE_DEFAULT];
+ * static event_pool_t pool;
+ *
+ * [...] event_pool_init(&pool, &stacks[0][0], sizeof(stacks[0]),
+ *                       ARRAY_SIZE(stacks), THREAD_PRIORITY_MAIN - 1);
+ *
+ * [...] event_post(&pool.queue, &event);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief       Event pool API
+ */
+
+#ifndef EVENT_POOL_H
+#define EVENT_POOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "event.h"
+#include "thread.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Maximum number of worker threads of an event pool
+ */
+#ifndef CONFIG_EVENT_POOL_WORKERS_MAX
+#define CONFIG_EVENT_POOL_WORKERS_MAX   (4U)
+#endif
+
+/**
+ * @brief   Event pool structure
+ */
+typedef struct {
+    event_queue_t queue;        /**< queue to post events to, its waiter
+                                     is the idle worker to wake next */
+    uint8_t idle_numof;         /**< number of idle workers */
+    thread_t *idle[CONFIG_EVENT_POOL_WORKERS_MAX];  /**< idle workers,
+                                                         most recent last */
+} event_pool_t;
+
+/**
+ * @brief   Initialize an event pool and start its worker threads
+ *
+ * Events can be posted to @p pool as soon as this function returns.
+ *
+ * @pre     0 < @p numof <= @ref CONFIG_EVENT_POOL_WORKERS_MAX
+ *
+ * @param[out]  pool        event pool to initialize
+ * @param[in]   stacks      stacks of the workers, @p numof times
+ *                          @p stacksize bytes
+ * @param[in]   stacksize   size of the stack of one worker
+ * @param[in]   numof       number of workers
+ * @param[in]   priority    priority of the workers
+ */
+void event_pool_init(event_pool_t *pool, char *stacks, size_t stacksize,
+                     unsigned numof, uint8_t priority);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* EVENT_POOL_H */
+/** @} */
@@ -135,6 +135,24 @@ static inline void sha256_final(sha256_context_t *ctx, void *digest)
  */
 void *sha256(const void *data, size_t len, void *digest);
 
+/**
+ * @brief   SHA-256 of several messages of the same length
+ *
+ * On platforms with SIMD instructions (`native` and ARM cores with NEON),
+ * four messages are hashed at once in lockstep. This is faster than
+ * calling @ref sha256 for every message. All other platforms, and those
+ * whose SHA-256 block function is accelerated (module `hashes_sha2xx_hw`),
+ * hash the messages one after another.
+ *
+ * @param[in]  data     @p numof messages of @p len bytes each
+ * @param[in]  len      length of every message
+ * @param[out] digests  @p numof buffers of @ref SHA256_DIGEST_LENGTH bytes
+ *                      for the digests of the messages
+ * @param[in]  numof    number of messages
+ */
+void sha256_multi(const void *const data[], size_t len,
+                  void *const digests[], unsigned numof);
+
 /**
  * @brief hmac_sha256_init HMAC SHA-256 calculation. Initiate calculation of a HMAC
  * @param[in] ctx hmac_context_t handle to use
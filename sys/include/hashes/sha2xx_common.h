@@ -103,6 +103,29 @@ static const uint32_t K[64] = {
     0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
 };
 
+/**
+ * @brief   Accelerated SHA-224/256 block function
+ *
+ * Platforms with a hash accelerator, e.g. a crypto peripheral or the SHA
+ * instructions of x86 CPUs, implement this function and select the module
+ * `hashes_sha2xx_hw`. All SHA-224, SHA-256 and HMAC-SHA-256 computations
+ * then pass their full blocks to it, as many consecutive blocks at once as
+ * possible. The accelerator must be able to continue from the given
+ * intermediate state.
+ *
+ * An implementation may decline, e.g. while the peripheral is in use or if
+ * the CPU lacks the instructions; the blocks are then processed in software.
+ *
+ * @param[in,out] state     intermediate hash state, in host byte order
+ * @param[in]     blocks    @p numof blocks of 64 bytes to hash, not aligned
+ * @param[in]     numof     number of blocks, at least 1
+ *
+ * @return  0 if the blocks were processed
+ * @return  <0 to let the blocks be processed in software, @p state must be
+ *          untouched then
+ */
+int sha2xx_hw_transform(uint32_t state[8], const void *blocks, size_t numof);
+
 /**
  * @brief SHA-2XX initialization.  Begins a SHA-2XX operation.
  *
@@ -11,6 +11,21 @@
  * @ingroup     net
  * @brief       FIB implementation
  *
+ * By default, every lookup in a single hop table compares the destination
+ * with all entries. When the `fib_trie` module is used, a table can
+ * additionally be indexed by a path compressed binary trie over the
+ * destination prefixes by pointing fib_table_t::trie_nodes to an array of
+ * FIB_TRIE_NODES_NUMOF(size) nodes before calling fib_init(). Lookups then
+ * only visit the prefixes of the destination and always yield the longest
+ * matching prefix. With the trie, adding an entry for a prefix that is
+ * already known updates the known entry, even if the host bits differ.
+ *
+ * Expired entries are only searched for once the earliest lifetime in a
+ * table passed, not on every lookup. The first lookup after that point in
+ * time removes all expired entries, which costs O(n) once per expiry. The
+ * FIB has no thread of its own to sweep in the background, and a timer
+ * callback could not take the lock of the table.
+ *
  * @{
  *
  * @file
@@ -92,6 +92,31 @@ typedef struct {
     size_t entry_pool_size;
 } fib_sr_meta_t;
 
+#if defined(MODULE_FIB_TRIE) || defined(DOXYGEN)
+/**
+ * @brief Number of trie nodes needed to index a FIB table of @p size entries
+ */
+#define FIB_TRIE_NODES_NUMOF(size)  (2 * (size))
+
+/**
+ * @brief Node of the path compressed binary trie indexing a FIB table
+ *
+ * The key of a node is the size of the destination address in bytes,
+ * followed by the first bits of the destination address. Nodes that do not
+ * carry an entry only branch the trie and always have two children.
+ */
+typedef struct {
+    /** the entry matching this prefix, NULL for branching nodes */
+    fib_entry_t *entry;
+    /** child nodes, indexed by the first key bit following this prefix */
+    int16_t child[2];
+    /** number of significant key bits, UINT8_MAX if the node is unused */
+    uint8_t len;
+    /** address size and address prefix, bits beyond len are 0 */
+    uint8_t key[UNIVERSAL_ADDRESS_SIZE + 1];
+} fib_trie_node_t;
+#endif
+
 /**
 * @brief FIB table type for single hop entries
 */
@@ -133,6 +158,18 @@ typedef struct {
     *   e.g. when the unreachable destination is covered by the prefix
     */
     universal_address_container_t* prefix_rp[FIB_MAX_REGISTERED_RP];
+    /** absolute time-point of the earliest entry lifetime, expired entries
+    *   are only searched for once this point in time is reached
+    */
+    uint64_t next_expiry;
+#if defined(MODULE_FIB_TRIE) || defined(DOXYGEN)
+    /** optional trie index over the single hop entries.
+    *   If not NULL, it MUST hold FIB_TRIE_NODES_NUMOF(size) nodes
+    */
+    fib_trie_node_t *trie_nodes;
+    /** index of the trie root in trie_nodes, -1 if the trie is empty */
+    int16_t trie_root;
+#endif
 } fib_table_t;
 
 #ifdef __cplusplus
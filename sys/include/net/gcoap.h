@@ -100,6 +100,16 @@
  * add parameters to provide more information about the resource, as described
  * in RFC 6690. See the gcoap example for use of a custom encoder function.
  *
+ * ### Many resources ###
+ *
+ * By default, gcoap finds the resource for a request by comparing its path with
+ * each resource of a listener in turn. For listeners with many resources, use
+ * the `nanocoap_resource_tree` module and set gcoap_listener_t::resource_tree
+ * to a tree with storage for
+ * @ref COAP_RESOURCE_TREE_NODES_NUMOF(resources_len) nodes.
+ * gcoap_register_listener() builds the tree, and requests then are matched by
+ * walking the tree.
+ *
  * ## Client Operation ##
  *
  * Client operation includes two phases: creating and sending a request, and
@@ -190,6 +200,20 @@
  * Finally, call gcoap_obs_send() for the resource, with the sum of the
  * metadata length and payload length for the representation.
  *
+ * ### Notifying many observers ###
+ *
+ * gcoap_obs_send() only notifies a single observer, so by default a resource
+ * only accepts a single observer. With the module `gcoap_obs_fanout`, any
+ * number of clients (up to CONFIG_GCOAP_OBS_REGISTRATIONS_MAX) may observe a
+ * resource. Use gcoap_obs_notify_init() instead of gcoap_obs_init() to
+ * initialize the notification, then write options and payload as above and
+ * send it to all observers with gcoap_obs_notify(). The notification is
+ * encoded only once: for each observer only the message ID and the token are
+ * rewritten in front of the options. All observers receive the same Observe
+ * option value. To not overflow the queues of the network stack, gcoap pauses
+ * for CONFIG_GCOAP_OBS_NOTIFY_PAUSE_US after every
+ * CONFIG_GCOAP_OBS_NOTIFY_BURST notifications.
+ *
  * ### Other considerations ###
  *
  * By default, the value for the Observe option in a notification is three
@@ -534,6 +558,27 @@ extern "C" {
 #define CONFIG_GCOAP_OBS_REGISTRATIONS_MAX     (2)
 #endif
 
+/**
+ * @ingroup net_gcoap_conf
+ * @brief   Number of notifications gcoap_obs_notify() sends without a pause
+ *
+ * Must be at least 1.
+ */
+#ifndef CONFIG_GCOAP_OBS_NOTIFY_BURST
+#define CONFIG_GCOAP_OBS_NOTIFY_BURST       (16U)
+#endif
+
+/**
+ * @ingroup net_gcoap_conf
+ * @brief   Pause between bursts of notifications in gcoap_obs_notify()
+ *          [in usec]
+ *
+ * Set to 0 to send all notifications at once.
+ */
+#ifndef CONFIG_GCOAP_OBS_NOTIFY_PAUSE_US
+#define CONFIG_GCOAP_OBS_NOTIFY_PAUSE_US    (1000U)
+#endif
+
 /**
  * @name    States for the memo used to track Observe registrations
  * @{
@@ -688,6 +733,17 @@ struct gcoap_listener {
      * @ref resources_len fields to fit their needs.
      */
     gcoap_request_matcher_t request_matcher;
+#if IS_USED(MODULE_NANOCOAP_RESOURCE_TREE) || defined(DOXYGEN)
+    /**
+     * @brief  Prefix tree over the resources, used by the default request
+     *         matcher
+     *
+     * Only coap_resource_tree_t::nodes and coap_resource_tree_t::nodes_numof
+     * must be set, gcoap_register_listener() builds the tree. Leaving this
+     * NULL matches the resources one by one.
+     */
+    coap_resource_tree_t *resource_tree;
+#endif
 };
 
 /**
@@ -899,6 +955,55 @@ int gcoap_obs_init(coap_pkt_t *pdu, uint8_t *buf, size_t len,
 size_t gcoap_obs_send(const uint8_t *buf, size_t len,
                       const coap_resource_t *resource);
 
+#if IS_USED(MODULE_GCOAP_OBS_FANOUT) || defined(DOXYGEN)
+/**
+ * @brief   Initializes a CoAP Observe notification packet on a buffer, for
+ *          all observers registered for a resource
+ *
+ * Leaves room for the longest token in front of the options, so the
+ * notification can be sent to each observer by gcoap_obs_notify() without
+ * encoding it again.
+ *
+ * @note    Only available with module `gcoap_obs_fanout`
+ *
+ * @param[out] pdu      Notification metadata
+ * @param[out] buf      Buffer containing the PDU
+ * @param[in] len       Length of the buffer
+ * @param[in] resource  Resource for the notification
+ *
+ * @return  GCOAP_OBS_INIT_OK     on success
+ * @return  GCOAP_OBS_INIT_ERR    on error
+ * @return  GCOAP_OBS_INIT_UNUSED if no observer for resource
+ */
+int gcoap_obs_notify_init(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                          const coap_resource_t *resource);
+
+/**
+ * @brief   Sends a CoAP Observe notification to all observers registered
+ *          for a resource
+ *
+ * Rewrites the message ID and the token in front of the options for each
+ * observer, so @p pdu must have been initialized by gcoap_obs_notify_init().
+ * The observers are looked up a few at a time, so registrations and requests
+ * are not blocked while the notifications are sent, including the pauses
+ * between bursts (see @ref CONFIG_GCOAP_OBS_NOTIFY_BURST). An observer that
+ * deregisters meanwhile is not notified if it was not yet, one that registers
+ * meanwhile may be missed. No other observer is missed or notified twice.
+ *
+ * @note    Only available with module `gcoap_obs_fanout`
+ *
+ * @param[in] pdu       Notification, as initialized by
+ *                      gcoap_obs_notify_init()
+ * @param[in] len       Length of the PDU, as returned by coap_opt_finish()
+ *                      plus the payload length
+ * @param[in] resource  Resource of the notification
+ *
+ * @return  number of observers the notification was sent to
+ */
+unsigned gcoap_obs_notify(coap_pkt_t *pdu, size_t len,
+                          const coap_resource_t *resource);
+#endif
+
 /**
  * @brief   Provides important operational statistics
  *
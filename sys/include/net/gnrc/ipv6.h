@@ -149,6 +149,18 @@ extern "C" {
 #define CONFIG_GNRC_IPV6_MSG_QUEUE_SIZE_EXP    (3U)
 #endif
 
+/**
+ * @brief   Maximum number of messages the IPv6 thread takes from its message
+ *          queue at once.
+ *
+ *          With values greater than 1, the IPv6 thread handles bursts of
+ *          packets with @ref msg_receive_many(), at the cost of the stack space
+ *          for the additional messages.
+ */
+#ifndef CONFIG_GNRC_IPV6_MSG_BATCH_SIZE
+#define CONFIG_GNRC_IPV6_MSG_BATCH_SIZE        (1U)
+#endif
+
 #ifdef DOXYGEN
 /**
  * @brief   Add a static IPv6 link local address to any network interface
@@ -214,6 +214,19 @@ extern "C" {
 #ifndef CONFIG_GNRC_IPV6_NIB_MULTIHOP_DAD
 #define CONFIG_GNRC_IPV6_NIB_MULTIHOP_DAD             0
 #endif
+
+/**
+ * @brief   Hash index for on-link and off-link entries
+ *
+ * Keeps open addressing hash tables on top of the on-link and off-link
+ * entry arrays, so neighbor cache lookups and longest prefix matches do not
+ * need to scan all @ref CONFIG_GNRC_IPV6_NIB_NUMOF and
+ * @ref CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF entries. Costs 4 bytes per entry
+ * plus 17 bytes and is worth it for large NIBs, e.g. on RPL roots.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_HASH_INDEX
+#define CONFIG_GNRC_IPV6_NIB_HASH_INDEX               0
+#endif
 /** @} */
 
 /**
@@ -87,6 +87,16 @@ typedef enum {
     GNRC_NETIF_BUS_NUMOF
 } gnrc_netif_bus_t;
 
+/**
+ * @brief   Number of receive buffers an interface provides to its device
+ *
+ * Two, so that a device can receive into one buffer while the frame in the
+ * other one is being handed to the upper layer.
+ *
+ * @see gnrc_netif_t::rx_bufs
+ */
+#define GNRC_NETIF_RX_BUF_NUMOF     (2U)
+
 /**
  * @brief   Event types for GNRC_NETIF_BUS_IPV6 per-interface message bus
  */
@@ -183,6 +193,16 @@ typedef struct {
      * @note    Only available with @ref net_gnrc_netif_pktq.
      */
     gnrc_netif_pktq_t send_queue;
+#endif
+#if IS_USED(MODULE_GNRC_NETIF_RX_BUF) || defined(DOXYGEN)
+    /**
+     * @brief   Packets provided to the device to receive frames into
+     *
+     * @note    Only available with module `gnrc_netif_rx_buf`.
+     *
+     * @see     netdev_driver_t::rx_buf_push
+     */
+    gnrc_pktsnip_t *rx_bufs[GNRC_NETIF_RX_BUF_NUMOF];
 #endif
     uint8_t cur_hl;                         /**< Current hop-limit for out-going packets */
     uint8_t device_type;                    /**< Device type */
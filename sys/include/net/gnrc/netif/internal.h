@@ -63,6 +63,37 @@ void gnrc_netif_acquire(gnrc_netif_t *netif);
  */
 void gnrc_netif_release(gnrc_netif_t *netif);
 
+#if IS_USED(MODULE_GNRC_NETIF_RX_BUF) || defined(DOXYGEN)
+/**
+ * @brief   Gets a received frame from the device without copying it
+ *
+ * Keeps the device supplied with @ref GNRC_NETIF_RX_BUF_NUMOF packets of
+ * @p size bytes via @ref netdev_driver_t::rx_buf_push and hands back the one
+ * the frame was received into via @ref netdev_driver_t::recv_buf.
+ *
+ * @pre `(netif != NULL) && (netif->dev->driver->recv_buf != NULL)`
+ *
+ * @param[in] netif     the network interface
+ * @param[out] pkt      the packet holding the frame at @p offset
+ * @param[out] offset   offset of the frame in @p pkt
+ * @param[in] size      size of the packets provided to the device
+ * @param[out] info     status information for the received frame
+ *
+ * @return  number of bytes of the frame
+ * @retval  -ENOBUFS if the frame was not received into a packet, use
+ *          @ref netdev_driver_t::recv instead
+ * @retval  0 if there is no frame
+ *
+ * @note    Only available with module `gnrc_netif_rx_buf`.
+ *
+ * @internal
+ */
+int gnrc_netif_recv_buf(gnrc_netif_t *netif, gnrc_pktsnip_t **pkt,
+                        size_t *offset, size_t size, void *info);
+#else
+#define gnrc_netif_recv_buf(netif, pkt, offset, size, info)     (-ENOBUFS)
+#endif
+
 #if IS_USED(MODULE_GNRC_NETIF_IPV6) || DOXYGEN
 /**
  * @brief   Adds an IPv6 address to the interface
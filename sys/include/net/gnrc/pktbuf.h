@@ -63,6 +63,52 @@ extern "C" {
 #ifndef CONFIG_GNRC_PKTBUF_SIZE
 #define CONFIG_GNRC_PKTBUF_SIZE    (6144)
 #endif
+
+/**
+ * @brief   Number of packet snip descriptors of the `gnrc_pktbuf_slab`
+ *          implementation
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF      (32)
+#endif
+
+/**
+ * @brief   Block size of the small size class of the `gnrc_pktbuf_slab`
+ *          implementation
+ *
+ * @details Used for headers added on send and for link-layer frames of
+ *          low-power radios. Rounded up to the word size.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE
+#define CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE      (128)
+#endif
+
+/**
+ * @brief   Number of blocks in the small size class of the
+ *          `gnrc_pktbuf_slab` implementation
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF     (16)
+#endif
+
+/**
+ * @brief   Block size of the large size class of the `gnrc_pktbuf_slab`
+ *          implementation
+ *
+ * @details This is the maximum size of a single allocation. The default
+ *          fits a full Ethernet frame. Rounded up to the word size.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE
+#define CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE      (1536)
+#endif
+
+/**
+ * @brief   Number of blocks in the large size class of the
+ *          `gnrc_pktbuf_slab` implementation
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_LARGE_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_LARGE_NUMOF     (3)
+#endif
 /** @} */
 
 /**
@@ -285,11 +331,45 @@ int gnrc_pktbuf_merge(gnrc_pktsnip_t *pkt);
  *
  * @note    Only available with DEVELHELP defined.
  *
- * @details Statistics include maximum number of reserved bytes.
+ * @details Statistics include maximum number of reserved bytes. With
+ *          `gnrc_pktbuf_slab` the usage and high-water mark of each size
+ *          class are printed.
  */
 void gnrc_pktbuf_stats(void);
 #endif
 
+#if IS_USED(MODULE_GNRC_PKTBUF_SLAB) || defined(DOXYGEN)
+/**
+ * @brief   Size classes of the `gnrc_pktbuf_slab` implementation
+ */
+typedef enum {
+    GNRC_PKTBUF_SLAB_SNIP = 0,      /**< packet snip descriptors */
+    GNRC_PKTBUF_SLAB_SMALL,         /**< headers and small frames */
+    GNRC_PKTBUF_SLAB_LARGE,         /**< MTU-sized payloads */
+    GNRC_PKTBUF_SLAB_NUMOF,         /**< number of size classes */
+} gnrc_pktbuf_slab_class_t;
+
+/**
+ * @brief   Usage statistics of a size class of `gnrc_pktbuf_slab`
+ */
+typedef struct {
+    uint16_t size;                  /**< block size in bytes */
+    uint16_t numof;                 /**< number of blocks */
+    uint16_t used;                  /**< number of blocks in use */
+    uint16_t max_used;              /**< maximum number of blocks in use
+                                     *   since initialization */
+} gnrc_pktbuf_slab_stats_t;
+
+/**
+ * @brief   Gets the usage statistics of a size class of `gnrc_pktbuf_slab`
+ *
+ * @param[in] cls       A size class.
+ * @param[out] stats    The statistics of @p cls.
+ */
+void gnrc_pktbuf_slab_stats(gnrc_pktbuf_slab_class_t cls,
+                            gnrc_pktbuf_slab_stats_t *stats);
+#endif
+
 /* for testing */
 #ifdef TEST_SUITES
 /**
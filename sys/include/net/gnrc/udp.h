@@ -48,6 +48,18 @@ extern "C" {
 #define CONFIG_GNRC_UDP_MSG_QUEUE_SIZE_EXP (3U)
 #endif
 
+/**
+ * @brief   Maximum number of messages the UDP thread takes from its message
+ *          queue at once.
+ *
+ *          With values greater than 1, the UDP thread handles bursts of
+ *          packets with @ref msg_receive_many(), at the cost of the stack space
+ *          for the additional messages.
+ */
+#ifndef CONFIG_GNRC_UDP_MSG_BATCH_SIZE
+#define CONFIG_GNRC_UDP_MSG_BATCH_SIZE     (1U)
+#endif
+
 /**
  * @brief   Priority of the UDP thread
  */
@@ -44,6 +44,12 @@
  * For either API, the caller *must* write options in order by option number
  * (see "CoAP option numbers" in [CoAP defines](group__net__coap.html)).
  *
+ * To read options, coap_parse() records where each option starts in the
+ * packet. With the `nanocoap_opt_index` module, it also records where the
+ * value starts and how long it is, so the option getters neither decode the
+ * option header again nor search for options not present. This costs
+ * 4 bytes per option in coap_pkt_t.
+ *
  * ## Server path matching
  *
  * By default the URI-path of an incoming request should match exactly one of
@@ -64,6 +70,16 @@
  * and exact matching should be register, and then a second one with the path
  * `/resource01/` and subtree matching.
  *
+ * ### Resource tree
+ *
+ * Handlers are found by walking the resource array in order, which takes a
+ * string comparison per resource. For servers with many resources, the
+ * `nanocoap_resource_tree` module provides a prefix tree over the resource
+ * paths, built once by coap_resource_tree_init(). A lookup then compares each
+ * character of the URI-path at most once. The tree needs the resources sorted
+ * by path, which is required for the linear lookup anyway, and yields the same
+ * resource as the linear lookup.
+ *
  * @{
  *
  * @file
@@ -148,6 +164,20 @@ extern "C" {
 #ifndef CONFIG_NANOCOAP_QS_MAX
 #define CONFIG_NANOCOAP_QS_MAX             (64)
 #endif
+
+/**
+ * @brief    Maximum number of nodes of the resource tree built for
+ *           @ref coap_resources
+ *
+ * Only used with the `nanocoap_resource_tree` module. If the tree does not fit,
+ * coap_handle_req() logs a warning and falls back to the linear lookup. At most
+ * @ref COAP_RESOURCE_TREE_NODES_NUMOF(coap_resources_numof) nodes are needed,
+ * paths sharing long prefixes need about 1.2 nodes per resource. The default
+ * fits about 200 such resources, in 16 bytes per node on 32 bit platforms.
+ */
+#ifndef CONFIG_NANOCOAP_RESOURCE_TREE_NODES_MAX
+#define CONFIG_NANOCOAP_RESOURCE_TREE_NODES_MAX (256)
+#endif
 /** @} */
 
 /**
@@ -179,6 +209,16 @@ typedef struct {
     uint16_t offset;            /**< offset in packet           */
 } coap_optpos_t;
 
+#if defined(MODULE_NANOCOAP_OPT_INDEX) || defined(DOXYGEN)
+/**
+ * @brief   CoAP option value entry, see @ref coap_pkt_t::opt_values
+ */
+typedef struct {
+    uint16_t offset;            /**< offset of the value in packet  */
+    uint16_t len;               /**< length of the value            */
+} coap_optval_t;
+#endif
+
 /**
  * @brief   CoAP PDU parsing context structure
  */
@@ -189,6 +229,23 @@ typedef struct {
     uint16_t payload_len;                             /**< length of payload       */
     uint16_t options_len;                             /**< length of options array */
     coap_optpos_t options[CONFIG_NANOCOAP_NOPTS_MAX]; /**< option offset array     */
+#if defined(MODULE_NANOCOAP_OPT_INDEX) || defined(DOXYGEN)
+    /**
+     * @brief   Value of each entry in @ref options
+     *
+     * Lets the option getters skip decoding the option header. Only with the
+     * `nanocoap_opt_index` module.
+     */
+    coap_optval_t opt_values[CONFIG_NANOCOAP_NOPTS_MAX];
+    /**
+     * @brief   Option numbers in @ref options
+     *
+     * Bit n is set for option number n, bit 31 for all numbers from 31 on.
+     * Lets the option getters skip searching for absent options. May have
+     * more bits set than options present.
+     */
+    uint32_t opt_mask;
+#endif
 #ifdef MODULE_GCOAP
     uint32_t observe_value;                           /**< observe value           */
 #endif
@@ -227,6 +284,40 @@ typedef struct {
     void *context;                  /**< ptr to user defined context data   */
 } coap_resource_t;
 
+/**
+ * @brief   Node of a resource tree
+ *
+ * Each node stands for the path prefix made up of the labels from the root to
+ * the node. Nodes are referenced by their position in
+ * coap_resource_tree_t::nodes plus one, 0 marks no node.
+ */
+typedef struct {
+    const char *label;              /**< characters leading to this node,
+                                         points into a resource path        */
+    uint16_t label_len;             /**< length of @p label                 */
+    uint16_t child;                 /**< first child node                   */
+    uint16_t sibling;               /**< next sibling node                  */
+    uint16_t resources;             /**< first resource with this path,
+                                         position in the array plus one     */
+    uint16_t resources_numof;       /**< number of resources with this path */
+} coap_resource_tree_node_t;
+
+/**
+ * @brief   Prefix tree over the paths of a resource array
+ */
+typedef struct {
+    const coap_resource_t *resources;   /**< resources sorted by path       */
+    size_t resources_numof;             /**< number of resources            */
+    coap_resource_tree_node_t *nodes;   /**< storage for the nodes          */
+    size_t nodes_numof;                 /**< capacity of @p nodes           */
+} coap_resource_tree_t;
+
+/**
+ * @brief   Number of nodes sufficient for a resource tree over @p numof
+ *          resources
+ */
+#define COAP_RESOURCE_TREE_NODES_NUMOF(numof)   (2 * (numof) + 1)
+
 /**
  * @brief   Block1 helper struct
  */
@@ -1538,6 +1629,66 @@ ssize_t coap_tree_handler(coap_pkt_t *pkt, uint8_t *resp_buf,
                           const coap_resource_t *resources,
                           size_t resources_numof);
 
+#if defined(MODULE_NANOCOAP_RESOURCE_TREE) || defined(DOXYGEN)
+/**
+ * @brief   Build a prefix tree over the paths of a resource array
+ *
+ * @p tree->nodes and @p tree->nodes_numof must be set before. The tree
+ * references @p resources and the paths in there, so they must stay valid
+ * while the tree is used.
+ *
+ * @param[in,out] tree              tree to build
+ * @param[in]     resources         array of resources, sorted by path
+ * @param[in]     resources_numof   number of entries in @p resources
+ *
+ * @returns     0 on success
+ * @returns     -EINVAL if @p resources are not sorted by path
+ * @returns     -ENOMEM if @p tree->nodes is too small
+ */
+int coap_resource_tree_init(coap_resource_tree_t *tree,
+                            const coap_resource_t *resources,
+                            size_t resources_numof);
+
+/**
+ * @brief   Find the resource for a URI-path in a resource tree
+ *
+ * Yields the same resource as walking the sorted resource array with
+ * coap_match_path(): the first resource in the array that matches @p uri and
+ * allows @p method_flag.
+ *
+ * @param[in]  tree         tree to search
+ * @param[in]  uri          null-terminated URI-path
+ * @param[in]  method_flag  @ref nanocoap_method_flags "method flag" of the
+ *                          request
+ * @param[out] resource     matching resource
+ *
+ * @returns     0 if a resource was found
+ * @returns     -EPERM if resources match @p uri, but none allows @p method_flag
+ * @returns     -ENOENT if no resource matches @p uri
+ */
+int coap_resource_tree_find(const coap_resource_tree_t *tree, const char *uri,
+                            coap_method_flags_t method_flag,
+                            const coap_resource_t **resource);
+
+/**
+ * @brief   Pass a coap request to the matching handler in a resource tree
+ *
+ * Same as coap_tree_handler(), but finds the handler with
+ * coap_resource_tree_find().
+ *
+ * @param[in]   pkt             pointer to (parsed) CoAP packet
+ * @param[out]  resp_buf        buffer for response
+ * @param[in]   resp_buf_len    size of response buffer
+ * @param[in]   tree            tree over the coap endpoint resources
+ *
+ * @returns     size of the reply packet on success
+ * @returns     <0 on error
+ */
+ssize_t coap_resource_tree_handler(coap_pkt_t *pkt, uint8_t *resp_buf,
+                                   unsigned resp_buf_len,
+                                   const coap_resource_tree_t *tree);
+#endif /* MODULE_NANOCOAP_RESOURCE_TREE */
+
 /**
  * @brief   Convert message code (request method) into a corresponding bit field
  *
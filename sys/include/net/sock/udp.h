@@ -352,6 +352,29 @@ typedef struct {
     sock_aux_flags_t flags; /**< Flags used request information */
 } sock_udp_aux_tx_t;
 
+/**
+ * @brief   A datagram sent with @ref sock_udp_send_many() or received with
+ *          @ref sock_udp_recv_many()
+ */
+typedef struct {
+    void *data;             /**< payload of the datagram */
+    /**
+     * @brief   length of the payload
+     *
+     * When receiving, this is the space available at
+     * sock_udp_dgram_t::data and is set to the length of the received
+     * payload.
+     */
+    size_t len;
+    /**
+     * @brief   remote end point of the datagram
+     *
+     * May be `NULL`, if the remote end point of the sock object is to be used
+     * for sending or if it is not required when receiving.
+     */
+    sock_udp_ep_t *remote;
+} sock_udp_dgram_t;
+
 /**
  * @brief   Creates a new UDP sock object
  *
@@ -682,6 +705,57 @@ static inline ssize_t sock_udp_send(sock_udp_t *sock,
     return sock_udp_send_aux(sock, data, len, remote, NULL);
 }
 
+/**
+ * @brief   Receives multiple UDP messages with one call
+ *
+ * @pre `(sock != NULL) && (dgrams != NULL) && (numof > 0)`
+ *
+ * Waits up to @p timeout for the first datagram, like @ref sock_udp_recv()
+ * would, and then takes as many of the datagrams already received by
+ * @p sock as fit into @p dgrams without waiting again.
+ *
+ * Datagrams after the first that do not fit into the space provided by
+ * their sock_udp_dgram_t::data or that are not from the remote of @p sock
+ * are dropped.
+ *
+ * @param[in] sock      A UDP sock object.
+ * @param[in,out] dgrams    Datagrams to receive into. sock_udp_dgram_t::len
+ *                      is set to the length of the received payload.
+ * @param[in] numof     Number of entries in @p dgrams.
+ * @param[in] timeout   Timeout for the first datagram in microseconds.
+ *                      If 0 and no data is available, the function returns
+ *                      immediately.
+ *                      May be @ref SOCK_NO_TIMEOUT for no timeout (wait until
+ *                      data is available).
+ *
+ * @return  The number of datagrams received on success.
+ * @return  Any of the negative return values of @ref sock_udp_recv(), if
+ *          receiving the first datagram failed.
+ */
+int sock_udp_recv_many(sock_udp_t *sock, sock_udp_dgram_t *dgrams,
+                       unsigned numof, uint32_t timeout);
+
+/**
+ * @brief   Sends multiple UDP messages with one call
+ *
+ * @pre `(sock != NULL) && (dgrams != NULL) && (numof > 0)`
+ *
+ * Stacks may hand the datagrams down more efficiently than with one call of
+ * @ref sock_udp_send() each, e.g. by saving on inter-thread communication.
+ * Sending stops at the first datagram that fails.
+ *
+ * @param[in] sock      A UDP sock object.
+ * @param[in] dgrams    Datagrams to send. sock_udp_dgram_t::data may be
+ *                      `NULL` if sock_udp_dgram_t::len is 0.
+ * @param[in] numof     Number of entries in @p dgrams.
+ *
+ * @return  The number of datagrams sent on success.
+ * @return  Any of the negative return values of @ref sock_udp_send(), if
+ *          sending the first datagram failed.
+ */
+int sock_udp_send_many(sock_udp_t *sock, const sock_udp_dgram_t *dgrams,
+                       unsigned numof);
+
 #include "sock_types.h"
 
 #ifdef __cplusplus
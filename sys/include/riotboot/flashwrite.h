@@ -50,6 +50,11 @@
  * fit into this and FLASHPAGE_SIZE must be a multiple of
  * RIOTBOOT_FLASHPAGE_BUFFER_SIZE
  *
+ * With the module `riotboot_flashwrite_verify_sha256`, the SHA-256 of the
+ * image is calculated while it is written, see
+ * riotboot_flashwrite_get_sha256(). This avoids reading the whole slot back
+ * after the download.
+ *
  * @author      Kaspar Schleiser <kaspar@schleiser.de>
  * @author      Koen Zandberg <koen@bergzand.net>
  *
@@ -63,8 +68,12 @@
 extern "C" {
 #endif
 
+#include "kernel_defines.h"
 #include "riotboot/slot.h"
 #include "periph/flashpage.h"
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_VERIFY_SHA256)
+#include "hashes/sha256.h"
+#endif
 
 /**
  * @brief Enable/disable raw writes to flash
@@ -121,6 +130,13 @@ typedef struct {
     uint8_t RIOTBOOT_FLASHPAGE_BUFFER_ATTRS
         firstblock_buf[RIOTBOOT_FLASHPAGE_BUFFER_SIZE];
 #endif
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_VERIFY_SHA256) || defined(DOXYGEN)
+    /**
+     * @brief SHA-256 of the image written so far, updated as the data is
+     *        passed in
+     */
+    sha256_context_t sha256;
+#endif
 } riotboot_flashwrite_t;
 
 /**
@@ -273,6 +289,25 @@ size_t riotboot_flashwrite_slotsize(const riotboot_flashwrite_t *state);
 int riotboot_flashwrite_verify_sha256(const uint8_t *sha256_digest,
                                       size_t img_size, int target_slot);
 
+/**
+ * @brief       Get the digest of the image written so far
+ *
+ * The digest is calculated while the image is passed to
+ * @ref riotboot_flashwrite_putbytes(), so unlike
+ * @ref riotboot_flashwrite_verify_sha256() this does not read the slot back.
+ * Every block is compared to the flash right after writing it instead. If the
+ * update has been initialized via @ref riotboot_flashwrite_init(), the
+ * skipped magic number ("RIOT") is included, so that the digest is the one of
+ * the whole image.
+ *
+ * @note    The update can be continued afterwards.
+ *
+ * @param[in]   state       ptr to state structure
+ * @param[out]  digest      the digest, @ref SHA256_DIGEST_LENGTH bytes
+ */
+void riotboot_flashwrite_get_sha256(const riotboot_flashwrite_t *state,
+                                    uint8_t *digest);
+
 #ifdef __cplusplus
 }
 #endif
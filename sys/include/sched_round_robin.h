@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_sched_round_robin Round Robin Scheduling
+ * @ingroup     sys
+ * @brief       Time slices for threads of the same priority
+ *
+ * Without this module, a thread keeps the CPU until it blocks or yields, or
+ * until a thread of higher priority becomes runnable. Threads of the same
+ * priority that do not block (e.g. doing compression or crypto) thus delay
+ * each other for the whole time of their work.
+ *
+ * With this module, a thread that runs for @ref CONFIG_SCHED_RR_QUANTUM_US
+ * while other threads of its priority are runnable is moved to the end of the
+ * runqueue of its priority, so the next of them gets the CPU.
+ *
+ * The timer for the time slice is only set while more than one thread of the
+ * running priority is runnable, so a system without such threads stays
+ * tickless. If the thread is preempted by a thread of higher priority, its
+ * time slice keeps going. If it blocks or yields, the next thread starts a new
+ * time slice.
+ *
+ * @note    If auto_init is disabled, @ref sched_round_robin_init needs to be
+ *          called after ztimer was initialized.
+ * @{
+ *
+ * @file
+ * @brief       Round robin scheduling within a priority
+ */
+
+#ifndef SCHED_ROUND_ROBIN_H
+#define SCHED_ROUND_ROBIN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Time a thread may run before the next thread of the same priority
+ *          gets the CPU, in µs
+ */
+#ifndef CONFIG_SCHED_RR_QUANTUM_US
+#define CONFIG_SCHED_RR_QUANTUM_US      (10000U)
+#endif
+
+/**
+ * @brief   Start round robin scheduling
+ */
+void sched_round_robin_init(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHED_ROUND_ROBIN_H */
+/** @} */
@@ -16,6 +16,23 @@
  *
  * @note        If auto_init is disabled `init_schedstatistics()` needs to be
  *              called as well as xtimer_init().
+ *
+ * Scheduling latency
+ * ==================
+ *
+ * With the `schedstatistics_latency` module, the statistics additionally
+ * include for every thread
+ *
+ * - a histogram of the time from becoming runnable (woken up, or preempted
+ *   while running) to running again,
+ * - the maximum of that time, and
+ * - the maximum time the thread ran without being switched out, i.e. for how
+ *   long it kept threads of lower priority (or of the same priority) from
+ *   running.
+ *
+ * All of these are measured with @ref ZTIMER_USEC in microseconds. The
+ * `ps` command prints them, @ref schedstatistics_dump writes them in a binary
+ * format for processing on a host.
  * @{
  *
  * @file
@@ -29,12 +46,27 @@
 #ifndef SCHEDSTATISTICS_H
 #define SCHEDSTATISTICS_H
 
+#include <stddef.h>
 #include <stdint.h>
 
+#include "kernel_defines.h"
+#include "sched.h"
+
 #ifdef __cplusplus
  extern "C" {
 #endif
 
+/**
+ * @brief   Number of buckets of the scheduling latency histogram
+ *
+ * Bucket `n` counts latencies from 2^n µs up to 2^(n+1) µs (excluding), the
+ * first bucket additionally counts latencies below 1 µs and the last one all
+ * latencies above.
+ */
+#ifndef CONFIG_SCHEDSTATISTICS_LATENCY_BUCKETS
+#define CONFIG_SCHEDSTATISTICS_LATENCY_BUCKETS  (12U)
+#endif
+
 /**
  *  Scheduler statistics
  */
@@ -43,8 +75,43 @@ typedef struct {
                                   scheduled to run */
     unsigned int schedules;  /**< How often the thread was scheduled to run */
     uint64_t runtime_ticks;  /**< The total runtime of this thread in ticks */
+#if IS_USED(MODULE_SCHEDSTATISTICS_LATENCY) || defined(DOXYGEN)
+    uint32_t runnable_since; /**< Time stamp in µs of the last time this thread
+                                  became runnable */
+    uint32_t running_since;  /**< Time stamp in µs of the last time this thread
+                                  was scheduled to run */
+    uint32_t latency_max;    /**< Longest time in µs from becoming runnable to
+                                  running */
+    uint32_t running_max;    /**< Longest time in µs running without being
+                                  switched out */
+    /** Histogram of the time from becoming runnable to running, the counts
+        saturate at `UINT16_MAX` */
+    uint16_t latency_hist[CONFIG_SCHEDSTATISTICS_LATENCY_BUCKETS];
+#endif
 } schedstat_t;
 
+/**
+ * @brief   Size of the header of @ref schedstatistics_dump
+ */
+#define SCHEDSTATISTICS_DUMP_HDR_LEN    (8U)
+
+/**
+ * @brief   Size of a record of @ref schedstatistics_dump
+ */
+#if IS_USED(MODULE_SCHEDSTATISTICS_LATENCY) || defined(DOXYGEN)
+#define SCHEDSTATISTICS_DUMP_REC_LEN    (22U + \
+                                         2U * CONFIG_SCHEDSTATISTICS_LATENCY_BUCKETS)
+#else
+#define SCHEDSTATISTICS_DUMP_REC_LEN    (14U)
+#endif
+
+/**
+ * @brief   Buffer size sufficient for @ref schedstatistics_dump
+ */
+#define SCHEDSTATISTICS_DUMP_MAXLEN     (SCHEDSTATISTICS_DUMP_HDR_LEN + \
+                                         (KERNEL_PID_LAST + 1) * \
+                                         SCHEDSTATISTICS_DUMP_REC_LEN)
+
 /**
  *  Thread statistics table
  */
@@ -56,6 +123,38 @@ extern schedstat_t sched_pidlist[KERNEL_PID_LAST + 1];
  */
 void init_schedstatistics(void);
 
+/**
+ * @brief   Write the statistics of all threads to a buffer in binary format
+ *
+ * All values are in little endian. The header is
+ *
+ * | Offset | Size | Content                                                 |
+ * |-------:|-----:|:--------------------------------------------------------|
+ * |      0 |    4 | `"SCHS"`                                                |
+ * |      4 |    1 | Format version, currently 1                             |
+ * |      5 |    1 | Number of histogram buckets, 0 without latency data     |
+ * |      6 |    2 | Number of records following                             |
+ *
+ * followed by one record per thread:
+ *
+ * | Offset | Size | Content                                                 |
+ * |-------:|-----:|:--------------------------------------------------------|
+ * |      0 |    2 | PID (@ref KERNEL_PID_UNDEF for the time spent idle)     |
+ * |      2 |    4 | @ref schedstat_t::schedules                             |
+ * |      6 |    8 | @ref schedstat_t::runtime_ticks                         |
+ * |     14 |    4 | @ref schedstat_t::latency_max (only with latency data)  |
+ * |     18 |    4 | @ref schedstat_t::running_max (only with latency data)  |
+ * |     22 |  2*n | @ref schedstat_t::latency_hist (only with latency data) |
+ *
+ * @param[out]  buf     Buffer to write to
+ * @param[in]   len     Size of @p buf, @ref SCHEDSTATISTICS_DUMP_MAXLEN is
+ *                      always sufficient
+ *
+ * @return  number of bytes written
+ * @return  -ENOBUFS if @p buf is too small
+ */
+int schedstatistics_dump(void *buf, size_t len);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,313 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_spscrb Lock-free single producer single consumer ringbuffer
+ * @ingroup     sys
+ * @brief       Ringbuffer for one writer and one reader without disabling
+ *              IRQs
+ *
+ * This ringbuffer can be used like @ref sys_tsrb, but it never disables
+ * IRQs (as long as @ref sys_atomic_utils can access `uint32_t` lock-free on
+ * the platform) and copies data with `memcpy()`. This makes it suitable for
+ * streaming data at high rates from an ISR to a thread, or vice versa.
+ *
+ * In exchange, only one context may add data (the producer) and only one
+ * context may take data (the consumer) at any time, e.g. a UART ISR and a
+ * thread reading from it. If more than one thread reads from or writes to the
+ * ringbuffer, use @ref sys_tsrb or serialize the access with a mutex.
+ *
+ * The producer uses the functions `spscrb_add*()`, @ref spscrb_reserve and
+ * @ref spscrb_commit. The consumer uses the functions `spscrb_get*()`,
+ * @ref spscrb_drop, @ref spscrb_peek and @ref spscrb_consume. Both may use
+ * the functions telling the fill level.
+ *
+ * Migrating from @ref sys_tsrb
+ * ============================
+ *
+ * The functions have the same signatures as their tsrb counterparts, so users
+ * with one producer and one consumer (like @ref sys_isrpipe) can switch by
+ * replacing `tsrb` with `spscrb`. Note that @ref tsrb_drop called by the
+ * producer to make room for new data does not fit this ringbuffer.
+ *
+ * Zero-copy access
+ * ================
+ *
+ * @ref spscrb_reserve gives the producer the contiguous free space at the
+ * write position, e.g. for a DMA transfer. @ref spscrb_commit then makes the
+ * data written there available. Accordingly, @ref spscrb_peek gives the
+ * consumer the contiguous data at the read position, and @ref spscrb_consume
+ * frees it. At the end of the buffer, two steps are needed for the full
+ * space or data.
+ *
+ * Elements
+ * ========
+ *
+ * `spscrb_add_elem*()` and `spscrb_get_elem*()` add and take elements of a
+ * fixed size as a whole. A ringbuffer should only be used with elements of a
+ * single size, and not with the byte-wise functions at the same time.
+ *
+ * @{
+ *
+ * @attention   Buffer size must be a power of two!
+ *
+ * @file
+ * @brief       Lock-free single producer single consumer ringbuffer
+ */
+
+#ifndef SPSCRB_H
+#define SPSCRB_H
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "atomic_utils.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Lock-free single producer single consumer ringbuffer struct
+ */
+typedef struct {
+    uint8_t *buf;               /**< Buffer to operate on */
+    uint32_t size;              /**< Size of buffer, must be power of 2 */
+    uint32_t reads;             /**< total number of bytes read, only
+                                     changed by the consumer */
+    uint32_t writes;            /**< total number of bytes written, only
+                                     changed by the producer */
+} spscrb_t;
+
+/**
+ * @brief   Static initializer
+ */
+#define SPSCRB_INIT(BUF) { (BUF), sizeof(BUF), 0, 0 }
+
+/**
+ * @brief       Initialize a spscrb
+ *
+ * @param[out]  rb          Datum to initialize
+ * @param[in]   buffer      Buffer to use by spscrb
+ * @param[in]   bufsize     `sizeof (buffer)`, must be power of 2
+ */
+static inline void spscrb_init(spscrb_t *rb, uint8_t *buffer, unsigned bufsize)
+{
+    assert((bufsize != 0) && ((bufsize & (bufsize - 1)) == 0));
+
+    rb->buf = buffer;
+    rb->size = bufsize;
+    rb->reads = 0;
+    rb->writes = 0;
+}
+
+/**
+ * @brief       Get number of bytes available for reading
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ *
+ * @return      nr of available bytes
+ */
+static inline unsigned int spscrb_avail(const spscrb_t *rb)
+{
+    return atomic_load_u32(&rb->writes) - atomic_load_u32(&rb->reads);
+}
+
+/**
+ * @brief       Get free space in ringbuffer
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ *
+ * @return      nr of free bytes
+ */
+static inline unsigned int spscrb_free(const spscrb_t *rb)
+{
+    return rb->size - spscrb_avail(rb);
+}
+
+/**
+ * @brief       Test if the spscrb is empty
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ *
+ * @return      0   if not empty
+ * @return      1   otherwise
+ */
+static inline int spscrb_empty(const spscrb_t *rb)
+{
+    return spscrb_avail(rb) == 0;
+}
+
+/**
+ * @brief       Test if the spscrb is full
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ *
+ * @return      0   if not full
+ * @return      1   otherwise
+ */
+static inline int spscrb_full(const spscrb_t *rb)
+{
+    return spscrb_avail(rb) == rb->size;
+}
+
+/**
+ * @brief       Get a byte from ringbuffer (consumer)
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ *
+ * @return      >=0 byte that has been read
+ * @return      -1  if no byte available
+ */
+int spscrb_get_one(spscrb_t *rb);
+
+/**
+ * @brief       Get bytes from ringbuffer (consumer)
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[out]  dst buffer to write to
+ * @param[in]   n   max number of bytes to write to @p dst
+ *
+ * @return      nr of bytes written to @p dst
+ */
+int spscrb_get(spscrb_t *rb, uint8_t *dst, size_t n);
+
+/**
+ * @brief       Drop bytes from ringbuffer (consumer)
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   n   max number of bytes to drop
+ *
+ * @return      nr of bytes dropped
+ */
+int spscrb_drop(spscrb_t *rb, size_t n);
+
+/**
+ * @brief       Add a byte to ringbuffer (producer)
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   c   Character to add to ringbuffer
+ *
+ * @return      0   on success
+ * @return      -1  if no space available
+ */
+int spscrb_add_one(spscrb_t *rb, uint8_t c);
+
+/**
+ * @brief       Add bytes to ringbuffer (producer)
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   src buffer to read from
+ * @param[in]   n   max number of bytes to read from @p src
+ *
+ * @return      nr of bytes read from @p src
+ */
+int spscrb_add(spscrb_t *rb, const uint8_t *src, size_t n);
+
+/**
+ * @brief       Get the contiguous free space at the write position (producer)
+ *
+ * The space is not added to the ringbuffer until @ref spscrb_commit is
+ * called.
+ *
+ * @param[in]   rb      Ringbuffer to operate on
+ * @param[out]  data    Start of the free space
+ *
+ * @return      nr of bytes that can be written to @p data
+ */
+size_t spscrb_reserve(spscrb_t *rb, uint8_t **data);
+
+/**
+ * @brief       Add bytes written to the space from @ref spscrb_reserve
+ *              (producer)
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   n   nr of bytes written, at most the size returned by
+ *                  @ref spscrb_reserve
+ */
+void spscrb_commit(spscrb_t *rb, size_t n);
+
+/**
+ * @brief       Get the contiguous data at the read position (consumer)
+ *
+ * The data stays in the ringbuffer until @ref spscrb_consume is called.
+ *
+ * @param[in]   rb      Ringbuffer to operate on
+ * @param[out]  data    Start of the data
+ *
+ * @return      nr of bytes that can be read from @p data
+ */
+size_t spscrb_peek(spscrb_t *rb, uint8_t **data);
+
+/**
+ * @brief       Free bytes read from the data from @ref spscrb_peek
+ *              (consumer)
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   n   nr of bytes read, at most the size returned by
+ *                  @ref spscrb_peek
+ */
+void spscrb_consume(spscrb_t *rb, size_t n);
+
+/**
+ * @brief       Add an element to ringbuffer (producer)
+ *
+ * @param[in]   rb          Ringbuffer to operate on
+ * @param[in]   elem        Element to add
+ * @param[in]   elem_size   Size of the element
+ *
+ * @return      0   on success
+ * @return      -1  if no space available for the whole element
+ */
+int spscrb_add_elem(spscrb_t *rb, const void *elem, size_t elem_size);
+
+/**
+ * @brief       Add elements to ringbuffer (producer)
+ *
+ * @param[in]   rb          Ringbuffer to operate on
+ * @param[in]   src         Elements to add
+ * @param[in]   num         max number of elements to add
+ * @param[in]   elem_size   Size of one element
+ *
+ * @return      nr of elements added
+ */
+unsigned spscrb_add_elems(spscrb_t *rb, const void *src, unsigned num,
+                          size_t elem_size);
+
+/**
+ * @brief       Get an element from ringbuffer (consumer)
+ *
+ * @param[in]   rb          Ringbuffer to operate on
+ * @param[out]  elem        Element read
+ * @param[in]   elem_size   Size of the element
+ *
+ * @return      0   on success
+ * @return      -1  if no whole element available
+ */
+int spscrb_get_elem(spscrb_t *rb, void *elem, size_t elem_size);
+
+/**
+ * @brief       Get elements from ringbuffer (consumer)
+ *
+ * @param[in]   rb          Ringbuffer to operate on
+ * @param[out]  dst         Elements read
+ * @param[in]   num         max number of elements to read
+ * @param[in]   elem_size   Size of one element
+ *
+ * @return      nr of elements read
+ */
+unsigned spscrb_get_elems(spscrb_t *rb, void *dst, unsigned num,
+                          size_t elem_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SPSCRB_H */
+/** @} */
@@ -59,7 +59,10 @@
  * data and check the digest of the payload. @ref suit_storage_driver_t::read
  * must be implemented, providing piecewise reading of the data. @ref
  * suit_storage_driver_t::read_ptr is optional to implement, it can provide
- * direct read access on memory-mapped storage.
+ * direct read access on memory-mapped storage. @ref
+ * suit_storage_driver_t::get_sha256 is optional as well, it can provide the
+ * digest calculated while the payload was written, which saves reading the
+ * payload back.
  *
  * As the storage backend provides a mechanism to store persistent data,
  * functions are added to set and retrieve the manifest sequence number. While
@@ -82,9 +85,10 @@
  * 6.  At least one @ref suit_storage_driver_t::write calls to write the payload
  *     data.
  * 7.  @ref suit_storage_driver_t::finish to mark the end of the payload write.
- * 8.  @ref suit_storage_driver_t::read or @ref suit_storage_driver_t::read_ptr
- *     to read back the written payload. This to verify the digest of the
- *     payload with what is provided in the manifest.
+ * 8.  @ref suit_storage_driver_t::get_sha256, @ref suit_storage_driver_t::read
+ *     or @ref suit_storage_driver_t::read_ptr to get the digest of or read
+ *     back the written payload. This to verify the digest of the payload with
+ *     what is provided in the manifest.
  * 9.  @ref suit_storage_driver_t::install if the digest matches with what is
  *     expected and the payload can be installed or marked as valid, or:
  * 10. @ref suit_storage_driver_t::erase if the digest does not match with what
@@ -189,6 +193,22 @@ typedef struct suit_storage_driver {
     int (*read_ptr)(suit_storage_t *storage,
                     const uint8_t **buf, size_t *len);
 
+    /**
+     * @brief Retrieve the SHA-256 digest of the written payload, calculated
+     *        while writing it
+     *
+     * @note Optional to implement
+     *
+     * @param[in]   storage     Storage context
+     * @param[in]   len         Expected length of the payload
+     * @param[out]  digest      The digest, @ref SHA256_DIGEST_LENGTH bytes
+     *
+     * @returns     @ref SUIT_OK on successfully providing the digest
+     * @returns     @ref suit_error_t if the digest is not available, e.g. if
+     *              not exactly @p len bytes were written
+     */
+    int (*get_sha256)(suit_storage_t *storage, size_t len, uint8_t *digest);
+
     /**
      * @brief Install the payload or mark the payload as valid
      *
@@ -376,6 +396,20 @@ static inline bool suit_storage_has_readptr(const suit_storage_t *storage)
     return (storage->driver->read_ptr);
 }
 
+/**
+ * @brief Check if the storage backend implements the @ref
+ * suit_storage_driver_t::get_sha256 function
+ *
+ * @param[in]   storage     Storage context
+ *
+ * @returns     True if the function is implemented,
+ * @returns     False otherwise
+ */
+static inline bool suit_storage_has_sha256(const suit_storage_t *storage)
+{
+    return (storage->driver->get_sha256);
+}
+
 /**
  * @brief Check if the storage backend implements the @ref
  * suit_storage_driver_t::match_offset function
@@ -487,6 +521,22 @@ static inline int suit_storage_read_ptr(suit_storage_t *storage, const uint8_t
     return storage->driver->read_ptr(storage, buf, len);
 }
 
+/**
+ * @brief Retrieve the SHA-256 digest of the written payload
+ *
+ * @param[in]   storage     Storage context
+ * @param[in]   len         Expected length of the payload
+ * @param[out]  digest      The digest, @ref SHA256_DIGEST_LENGTH bytes
+ *
+ * @returns     @ref SUIT_OK on successfully providing the digest
+ * @returns     @ref suit_error_t on error
+ */
+static inline int suit_storage_get_sha256(suit_storage_t *storage, size_t len,
+                                          uint8_t *digest)
+{
+    return storage->driver->get_sha256(storage, len, digest);
+}
+
 /**
  * @brief Install the payload or mark the payload as valid
  *
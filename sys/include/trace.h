@@ -21,15 +21,19 @@
  *
  * At any point, `trace_dump()` can be used to print the trace buffer.
  *
- * The buffer has a default size of 512 entries, which can be overridden by
+ * The buffer has a default size of 4096 bytes, which can be overridden by
  * defining CONFIG_TRACE_BUFSIZE. It can be cleared using `trace_reset()`.
- * The trace buffer works like a ring-buffer. If it is full, it will start
- * overwriting from the beginning.
+ * If the buffer is full, new events are dropped (and counted) until it is
+ * emptied by `trace_dump_binary()` or `trace_reset()`.
  *
- * Tracing is made thread safe by disabling interrupts for critical sections.
+ * Recording events does not disable interrupts: space for an event is
+ * reserved with an atomic compare and swap, so events from threads and ISRs
+ * interrupting each other end up in the buffer without locking. As RIOT
+ * schedules a single CPU, there is only one buffer.
  *
  * It does incur some overhead (at least a function call, getting the current
- * time, a pair of enable/disable interrupts and a couple of memory accesses).
+ * time with @ref ZTIMER_USEC, an atomic operation and a couple of memory
+ * accesses).
  *
  * Example:
  *
@@ -41,6 +45,43 @@
  * trace_dump();
  * ~~~~~~~~~~~~~~~~~~~~~~~~
  *
+ * Events and trace points
+ * =======================
+ *
+ * Besides the user values passed to `trace()`, `trace_event()` records an
+ * event ID with up to @ref TRACE_ARGS_MAX arguments. With the `trace_points`
+ * module, RIOT records the events listed in @ref trace_event_id_t, e.g. every
+ * context switch and every message sent.
+ *
+ * Binary streaming
+ * ================
+ *
+ * `trace_dump_binary()` writes all recorded events in a compact binary format
+ * via @ref stdio_write and removes them from the buffer. Calling it
+ * periodically (e.g. from a low priority thread) streams the trace to a host.
+ * There, `dist/tools/trace/trace2json.py` converts the stream into the JSON
+ * format of the Chrome tracing viewer and Perfetto.
+ *
+ * The stream consists of a header `"RTRC"` followed by the format version
+ * (one byte, currently 1) and three reserved bytes, followed by the records.
+ * Each record consists of
+ *
+ * | Size     | Content                                                       |
+ * |---------:|:--------------------------------------------------------------|
+ * |        1 | Length of the record in bytes, including this byte            |
+ * |        1 | Event ID (@ref trace_event_id_t)                              |
+ * |        4 | Time stamp in µs, little endian                               |
+ * | variable | Arguments, each encoded as unsigned LEB128 (1 to 5 bytes)     |
+ *
+ * The header is repeated at the start of the output of every call to
+ * `trace_dump_binary()`.
+ *
+ * The time stamp is taken before the record is reserved in the buffer. If an
+ * ISR records an event in between, its record precedes the interrupted one
+ * despite the later time stamp, so decoders have to sort the records by time
+ * stamp. `trace2json.py` does so, `trace_dump()` prints the records in buffer
+ * order.
+ *
  * @{
  *
  * @brief       Execution tracing module API
@@ -55,15 +96,86 @@
 
 #include <stdint.h>
 
+#include "kernel_defines.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @brief   Size of the trace buffer in bytes, must be a power of two
+ */
+#ifndef CONFIG_TRACE_BUFSIZE
+#define CONFIG_TRACE_BUFSIZE    4096
+#endif
+
+/**
+ * @brief   Maximum number of arguments of an event
+ */
+#define TRACE_ARGS_MAX          (3U)
+
+/**
+ * @brief   Maximum size of a record in bytes
+ */
+#define TRACE_RECORD_MAXLEN     (6U + 5U * TRACE_ARGS_MAX)
+
+/**
+ * @brief   Event IDs
+ */
+typedef enum {
+    TRACE_EVENT_USER = 0,       /**< `trace()` was called, argument: the
+                                     value */
+    TRACE_EVENT_SCHED,          /**< a thread was scheduled to run,
+                                     argument: its PID */
+    TRACE_EVENT_MSG_SEND,       /**< a message is sent, arguments: target
+                                     PID, message type */
+    TRACE_EVENT_MUTEX_LOCK,     /**< a mutex is locked, arguments: address
+                                     of the mutex, 1 if it was locked before */
+    TRACE_EVENT_NETIF_RX,       /**< a network interface received a packet,
+                                     arguments: PID of the interface, length */
+    TRACE_EVENT_NETIF_TX,       /**< a network interface sends a packet,
+                                     arguments: PID of the interface, length */
+    TRACE_EVENT_ZTIMER,         /**< a ztimer clock fired, argument: address
+                                     of the clock */
+    TRACE_EVENT_ZTIMER_CB,      /**< a ztimer callback is run, argument:
+                                     address of the callback */
+    TRACE_EVENT_DROPPED,        /**< events were dropped because the buffer
+                                     was full, argument: number of events */
+    TRACE_EVENT_APP = 0x80,     /**< first ID for use by applications */
+} trace_event_id_t;
+
+/**
+ * @brief   Record an event at a predefined trace point
+ *
+ * Expands to nothing unless the `trace_points` module is used.
+ *
+ * @param[in]   id      ID of the event (@ref trace_event_id_t)
+ * @param[in]   ...     arguments of the event (1 to @ref TRACE_ARGS_MAX)
+ */
+#define TRACE_POINT(id, ...) \
+    do { \
+        if (IS_USED(MODULE_TRACE_POINTS)) { \
+            const uint32_t _trace_argv[] = { __VA_ARGS__ }; \
+            trace_event(id, ARRAY_SIZE(_trace_argv), _trace_argv); \
+        } \
+    } while (0)
+
+/**
+ * @brief   Start taking time stamps of events
+ *
+ * Trace points run before @ref ZTIMER_USEC is initialized, e.g. on the first
+ * context switch. Until this function is called, events are recorded with a
+ * time stamp of 0. It is called by auto_init after `ztimer_init()`,
+ * applications not using `auto_init_ztimer` must call it after initializing
+ * ztimer themselves.
+ */
+void trace_init(void);
+
 /**
  * @brief   Add entry to trace buffer
  *
- * Adds the current time (e.g., xtimer_now_usec()) and @p val to the trace
- * buffer.
+ * Adds the current time (e.g., ztimer_now(ZTIMER_USEC)) and @p val to the
+ * trace buffer.
  *
  * The value parameter is not used by the trace module itself. The caller is
  * supposed to provide a meaningful value.
@@ -73,20 +185,38 @@ extern "C" {
  */
 void trace(uint32_t val);
 
+/**
+ * @brief   Add an event to the trace buffer
+ *
+ * @param[in]   id      ID of the event (@ref trace_event_id_t)
+ * @param[in]   argc    number of arguments (at most @ref TRACE_ARGS_MAX)
+ * @param[in]   argv    arguments
+ */
+void trace_event(uint8_t id, unsigned argc, const uint32_t *argv);
+
 /**
  * @brief   Print the current trace buffer
  *
  * Will print the number of the trace log entry, the timestamp (first entry) or
  * relative time since last entry, and the value supplied to the `trace()` call
- * of each entry.
+ * of each entry. Other events are printed with their ID and arguments.
  *
  * Example output (after adding two traces, 3us apart, with values 0 and 1):
  *
  *     n=   0 t=  1815312 v=0x00000000
  *     n=   1 t=+       3 v=0x00000001
+ *
+ * The entries stay in the trace buffer.
  */
 void trace_dump(void);
 
+/**
+ * @brief   Write the trace buffer in binary format to stdio and empty it
+ *
+ * Only one thread may call this function (or @ref trace_reset) at a time.
+ */
+void trace_dump_binary(void);
+
 /**
  * @brief   Empty the trace buffer
  */
@@ -135,10 +135,9 @@
  * made a constant operation, at the price of another pointer per timer object
  * (for "previous" element).
  *
- * If deemed necessary, the linked list can be exchanged our augmented with
- * another data structure providing better algorithmic guarantees. It remains
- * to be shown whether the increased complexity would lead to better
- * performance for any reasonable amount of active timers.
+ * For clocks that need to handle many concurrently active timers, the list
+ * can be augmented with a hashed timer wheel (see @ref sys_ztimer_wheel),
+ * which keeps only the timers expiring soon in the sorted list.
  *
  *
  * ## Clock extension
@@ -257,6 +256,11 @@ typedef struct ztimer_base ztimer_base_t;
  */
 typedef struct ztimer_clock ztimer_clock_t;
 
+/**
+ * @brief ztimer_wheel_t forward declaration
+ */
+typedef struct ztimer_wheel ztimer_wheel_t;
+
 /**
  * @brief   Minimum information for each timer
  */
@@ -323,6 +327,9 @@ struct ztimer_clock {
     uint32_t lower_last;            /**< timer value at last now() call     */
     ztimer_now_t checkpoint;        /**< cumulated time at last now() call  */
 #endif
+#if MODULE_ZTIMER_WHEEL || DOXYGEN
+    ztimer_wheel_t *wheel;          /**< optional timer wheel, or NULL      */
+#endif
 #if MODULE_PM_LAYERED || DOXYGEN
     uint8_t required_pm_mode;       /**< min. pm mode required for the clock to run */
 #endif
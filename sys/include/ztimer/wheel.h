@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+/**
+ * @defgroup    sys_ztimer_wheel ztimer hashed timer wheel
+ * @ingroup     sys_ztimer
+ * @brief       Optional hashed timer wheel backend for ztimer clocks
+ *
+ * By default, every ztimer clock keeps its timers in a single sorted,
+ * delta-encoded linked list. Setting a timer has to walk that list, which is
+ * fine for a handful of timers but grows linearly with the number of armed
+ * timers.
+ *
+ * When the `ztimer_wheel` module is used, a clock can optionally be given a
+ * hashed timer wheel. The wheel splits time into slots of `2^shift` ticks
+ * and keeps `nbuckets` (unsorted) buckets, indexed by the slot number of a
+ * timer's target time. The clock's sorted list then only holds the timers
+ * expiring within the current slot, plus one internal timer that fires at the
+ * start of the next non-empty slot. When that internal timer fires, the
+ * matching bucket's timers are moved over into the sorted list.
+ *
+ * This gives O(1) insertion into the wheel and expected O(n / nbuckets)
+ * removal, while the callbacks are still executed by ztimer_handler() in the
+ * very same order and with the very same timing as without the wheel.
+ * The wheel does not cause periodic wake-ups: the internal timer is only set
+ * when at least one timer is stored in a bucket.
+ *
+ * A slot should be chosen considerably larger than the typical timer
+ * interval granularity, and `nbuckets << shift` should cover the typical
+ * timeout range. `nbuckets << shift` must not exceed 2^30.
+ *
+ * Example:
+ *
+ * ```
+ * #include "ztimer/wheel.h"
+ *
+ * static ztimer_wheel_t wheel;
+ * static ztimer_base_t *buckets[64];
+ *
+ * int main(void)
+ * {
+ *     // 64 slots of 128ms each
+ *     ztimer_wheel_init(ZTIMER_MSEC, &wheel, buckets, ARRAY_SIZE(buckets), 7);
+ * }
+ * ```
+ *
+ * @{
+ *
+ * @file
+ * @brief       ztimer hashed timer wheel API
+ */
+
+#ifndef ZTIMER_WHEEL_H
+#define ZTIMER_WHEEL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ztimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   ztimer hashed timer wheel structure
+ */
+struct ztimer_wheel {
+    ztimer_t slot_timer;        /**< fires at the start of the next used slot */
+    ztimer_base_t **buckets;    /**< bucket heads, NULL if empty            */
+    uint32_t horizon;           /**< start of the next used slot (if armed) */
+    uint16_t mask;              /**< number of buckets - 1                  */
+    uint8_t shift;              /**< log2 of the slot length in ticks       */
+    bool armed;                 /**< true if @p slot_timer is set           */
+};
+
+/**
+ * @brief   Attach a hashed timer wheel to a clock
+ *
+ * Must be called before any timer is set on @p clock.
+ *
+ * @param[in]   clock       clock to attach the wheel to
+ * @param[out]  wheel       wheel to initialize
+ * @param[in]   buckets     bucket array, @p nbuckets entries long
+ * @param[in]   nbuckets    number of buckets, must be a power of two
+ * @param[in]   shift       log2 of the slot length in ticks
+ */
+void ztimer_wheel_init(ztimer_clock_t *clock, ztimer_wheel_t *wheel,
+                       ztimer_base_t **buckets, unsigned nbuckets,
+                       unsigned shift);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZTIMER_WHEEL_H */
+/** @} */
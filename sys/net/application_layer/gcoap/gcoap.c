@@ -29,6 +29,7 @@
 #include "net/gcoap.h"
 #include "net/sock/async/event.h"
 #include "net/sock/util.h"
+#include "log.h"
 #include "mutex.h"
 #include "random.h"
 #include "thread.h"
@@ -67,11 +68,18 @@ static void _find_req_memo(gcoap_request_memo_t **memo_ptr, coap_pkt_t *pdu,
 static int _find_resource(const coap_pkt_t *pdu,
                           const coap_resource_t **resource_ptr,
                           gcoap_listener_t **listener_ptr);
-static int _find_observer(sock_udp_ep_t **observer, sock_udp_ep_t *remote);
-static int _find_obs_memo(gcoap_observe_memo_t **memo, sock_udp_ep_t *remote,
-                                                       coap_pkt_t *pdu);
-static void _find_obs_memo_resource(gcoap_observe_memo_t **memo,
+static void _init_obs(void);
+static sock_udp_ep_t *_find_observer(const sock_udp_ep_t *remote);
+static sock_udp_ep_t *_add_observer(const sock_udp_ep_t *remote);
+static gcoap_observe_memo_t *_find_obs_memo(const sock_udp_ep_t *remote,
+                                            const coap_pkt_t *pdu);
+static gcoap_observe_memo_t *_add_obs_memo(sock_udp_ep_t *observer);
+static void _set_obs_memo_resource(gcoap_observe_memo_t *memo,
                                    const coap_resource_t *resource);
+static void _remove_obs_memo(gcoap_observe_memo_t *memo);
+static gcoap_observe_memo_t *_find_obs_memo_resource(
+                                    const coap_resource_t *resource,
+                                    const sock_udp_ep_t *remote);
 
 static int _request_matcher_default(gcoap_listener_t *listener,
                                     const coap_resource_t **resource,
@@ -83,11 +91,9 @@ const coap_resource_t _default_resources[] = {
 };
 
 static gcoap_listener_t _default_listener = {
-    &_default_resources[0],
-    ARRAY_SIZE(_default_resources),
-    NULL,
-    NULL,
-    _request_matcher_default
+    .resources = &_default_resources[0],
+    .resources_len = ARRAY_SIZE(_default_resources),
+    .request_matcher = _request_matcher_default,
 };
 
 /* Container for the state of gcoap itself */
@@ -104,6 +110,27 @@ typedef struct {
                                            observe memos */
     gcoap_observe_memo_t observe_memos[CONFIG_GCOAP_OBS_REGISTRATIONS_MAX];
                                         /* Observed resource registrations */
+    /* Lists indexing observers and observe_memos; an entry is the position
+     * in the respective array plus one, 0 ends a list */
+    uint16_t obs_buckets[CONFIG_GCOAP_OBS_CLIENTS_MAX];
+                                        /* Observers by endpoint hash */
+    uint16_t obs_next[CONFIG_GCOAP_OBS_CLIENTS_MAX];
+                                        /* Next observer in bucket or free */
+    uint16_t obs_memos[CONFIG_GCOAP_OBS_CLIENTS_MAX];
+                                        /* Observe memos of an observer */
+    uint16_t obs_free;                  /* Unused observers */
+    uint16_t memo_buckets[CONFIG_GCOAP_OBS_REGISTRATIONS_MAX];
+                                        /* First observe memo of each
+                                           resource by resource hash */
+    uint16_t memo_res_next[CONFIG_GCOAP_OBS_REGISTRATIONS_MAX];
+                                        /* First memo of the next resource
+                                           in bucket, or next free memo */
+    uint16_t memo_same_next[CONFIG_GCOAP_OBS_REGISTRATIONS_MAX];
+                                        /* Next memo of the same resource,
+                                           sorted by position */
+    uint16_t memo_obs_next[CONFIG_GCOAP_OBS_REGISTRATIONS_MAX];
+                                        /* Next memo of the same observer */
+    uint16_t memo_free;                 /* Unused observe memos */
     uint8_t resend_bufs[CONFIG_GCOAP_RESEND_BUFS_MAX][CONFIG_GCOAP_PDU_BUF_SIZE];
                                         /* Buffers for PDU for request resends;
                                            if first byte of an entry is zero,
@@ -515,7 +542,7 @@ static size_t _handle_req(coap_pkt_t *pdu, uint8_t *buf, size_t len,
     gcoap_listener_t *listener          = NULL;
     sock_udp_ep_t *observer             = NULL;
     gcoap_observe_memo_t *memo          = NULL;
-    gcoap_observe_memo_t *resource_memo = NULL;
+    gcoap_observe_memo_t *resource_memo;
 
     switch (_find_resource((const coap_pkt_t *)pdu, &resource, &listener)) {
         case GCOAP_RESOURCE_WRONG_METHOD:
@@ -523,8 +550,6 @@ static size_t _handle_req(coap_pkt_t *pdu, uint8_t *buf, size_t len,
         case GCOAP_RESOURCE_NO_PATH:
             return gcoap_response(pdu, buf, len, COAP_CODE_PATH_NOT_FOUND);
         case GCOAP_RESOURCE_FOUND:
-            /* find observe registration for resource */
-            _find_obs_memo_resource(&resource_memo, resource);
             break;
         case GCOAP_RESOURCE_ERROR:
         default:
@@ -532,9 +557,15 @@ static size_t _handle_req(coap_pkt_t *pdu, uint8_t *buf, size_t len,
             break;
     }
 
+    mutex_lock(&_coap_state.lock);
+    /* find observe registration for resource; if the resource may have
+     * several observers, only the one of this remote is of interest */
+    resource_memo = _find_obs_memo_resource(resource,
+                        IS_USED(MODULE_GCOAP_OBS_FANOUT) ? remote : NULL);
+
     if (coap_get_observe(pdu) == COAP_OBS_REGISTER) {
         /* lookup remote+token */
-        int empty_slot = _find_obs_memo(&memo, remote, pdu);
+        memo = _find_obs_memo(remote, pdu);
         /* validate re-registration request */
         if (resource_memo != NULL) {
             if (memo != NULL) {
@@ -554,20 +585,17 @@ static size_t _handle_req(coap_pkt_t *pdu, uint8_t *buf, size_t len,
         /* initialize new registration request */
         if ((memo == NULL) && coap_has_observe(pdu)) {
             /* verify resource not already registered (for another endpoint) */
-            if ((empty_slot >= 0) && (resource_memo == NULL)) {
-                int obs_slot = _find_observer(&observer, remote);
+            if ((_coap_state.memo_free != 0) && (resource_memo == NULL)) {
+                observer = _find_observer(remote);
                 /* cache new observer */
                 if (observer == NULL) {
-                    if (obs_slot >= 0) {
-                        observer = &_coap_state.observers[obs_slot];
-                        memcpy(observer, remote, sizeof(sock_udp_ep_t));
-                    } else {
+                    observer = _add_observer(remote);
+                    if (observer == NULL) {
                         DEBUG("gcoap: can't register observer\n");
                     }
                 }
                 if (observer != NULL) {
-                    memo = &_coap_state.observe_memos[empty_slot];
-                    memo->observer = observer;
+                    memo = _add_obs_memo(observer);
                 }
             }
             if (memo == NULL) {
@@ -578,7 +606,7 @@ static size_t _handle_req(coap_pkt_t *pdu, uint8_t *buf, size_t len,
         /* finish registration */
         if (memo != NULL) {
             /* resource may be assigned here if it is not already registered */
-            memo->resource = resource;
+            _set_obs_memo_resource(memo, resource);
             memo->token_len = coap_get_token_len(pdu);
             if (memo->token_len) {
                 memcpy(&memo->token[0], pdu->token, memo->token_len);
@@ -587,27 +615,21 @@ static size_t _handle_req(coap_pkt_t *pdu, uint8_t *buf, size_t len,
         }
 
     } else if (coap_get_observe(pdu) == COAP_OBS_DEREGISTER) {
-        _find_obs_memo(&memo, remote, pdu);
+        memo = _find_obs_memo(remote, pdu);
         /* clear memo, and clear observer if no other memos */
         if (memo != NULL) {
             DEBUG("gcoap: Deregistering observer for: %s\n", memo->resource->path);
-            memo->observer = NULL;
-            memo           = NULL;
-            _find_obs_memo(&memo, remote, NULL);
-            if (memo == NULL) {
-                _find_observer(&observer, remote);
-                if (observer != NULL) {
-                    observer->family = AF_UNSPEC;
-                }
-            }
+            _remove_obs_memo(memo);
         }
         coap_clear_observe(pdu);
 
     } else if (coap_has_observe(pdu)) {
+        mutex_unlock(&_coap_state.lock);
         /* bogus request; don't respond */
         DEBUG("gcoap: Observe value unexpected: %" PRIu32 "\n", coap_get_observe(pdu));
         return -1;
     }
+    mutex_unlock(&_coap_state.lock);
 
     ssize_t pdu_len = resource->handler(pdu, buf, len, resource->context);
     if (pdu_len < 0) {
@@ -634,6 +656,20 @@ static int _request_matcher_default(gcoap_listener_t *listener,
     coap_method_flags_t method_flag = coap_method2flag(
         coap_get_code_detail(pdu));
 
+#if IS_USED(MODULE_NANOCOAP_RESOURCE_TREE)
+    if (listener->resource_tree != NULL) {
+        switch (coap_resource_tree_find(listener->resource_tree, (char *)uri,
+                                        method_flag, resource)) {
+        case 0:
+            return GCOAP_RESOURCE_FOUND;
+        case -EPERM:
+            return GCOAP_RESOURCE_WRONG_METHOD;
+        default:
+            return GCOAP_RESOURCE_NO_PATH;
+        }
+    }
+#endif
+
     for (size_t i = 0; i < listener->resources_len; i++) {
         *resource = &listener->resources[i];
 
@@ -810,93 +846,322 @@ static ssize_t _well_known_core_handler(coap_pkt_t* pdu, uint8_t *buf, size_t le
 }
 
 /*
- * Find registered observer for a remote address and port.
+ * Remove entry from a list of array positions.
  *
- * observer[out] -- Registered observer, or NULL if not found
- * remote[in] -- Endpoint to match
- *
- * return Index of empty slot, suitable for registering new observer; or -1
- *        if no empty slots. Undefined if observer found.
+ * head[inout] -- Head of the list
+ * next[inout] -- Links of the list
+ * pos[in] -- Entry to remove, must be in the list
+ */
+static void _list_remove(uint16_t *head, uint16_t *next, unsigned pos)
+{
+    while (*head != pos) {
+        assert(*head != 0);
+        head = &next[*head - 1];
+    }
+    *head = next[pos - 1];
+}
+
+/*
+ * Clear all observe registrations, and link observers and observe memos
+ * into their free lists.
  */
-static int _find_observer(sock_udp_ep_t **observer, sock_udp_ep_t *remote)
+static void _init_obs(void)
 {
-    int empty_slot = -1;
-    *observer      = NULL;
+    memset(&_coap_state.observers[0], 0, sizeof(_coap_state.observers));
+    memset(&_coap_state.observe_memos[0], 0, sizeof(_coap_state.observe_memos));
+    memset(&_coap_state.obs_buckets[0], 0, sizeof(_coap_state.obs_buckets));
+    memset(&_coap_state.obs_memos[0], 0, sizeof(_coap_state.obs_memos));
+    memset(&_coap_state.memo_buckets[0], 0, sizeof(_coap_state.memo_buckets));
+    memset(&_coap_state.memo_obs_next[0], 0, sizeof(_coap_state.memo_obs_next));
+    memset(&_coap_state.memo_same_next[0], 0,
+           sizeof(_coap_state.memo_same_next));
     for (unsigned i = 0; i < CONFIG_GCOAP_OBS_CLIENTS_MAX; i++) {
+        _coap_state.obs_next[i] = i + 2;
+    }
+    _coap_state.obs_next[CONFIG_GCOAP_OBS_CLIENTS_MAX - 1] = 0;
+    _coap_state.obs_free = 1;
+    for (unsigned i = 0; i < CONFIG_GCOAP_OBS_REGISTRATIONS_MAX; i++) {
+        _coap_state.memo_res_next[i] = i + 2;
+    }
+    _coap_state.memo_res_next[CONFIG_GCOAP_OBS_REGISTRATIONS_MAX - 1] = 0;
+    _coap_state.memo_free = 1;
+}
+
+/*
+ * Find bucket of an observer from its address and port (FNV-1a).
+ */
+static unsigned _obs_bucket(const sock_udp_ep_t *ep)
+{
+    const uint8_t *addr = (const uint8_t *)&ep->addr;
+    unsigned addr_len = (ep->family == AF_INET) ? 4 : sizeof(ep->addr);
+    uint32_t hash = 0x811c9dc5 ^ ep->port;
+
+    for (unsigned i = 0; i < addr_len; i++) {
+        hash = (hash ^ addr[i]) * 0x01000193;
+    }
+    return hash % CONFIG_GCOAP_OBS_CLIENTS_MAX;
+}
+
+/*
+ * Find bucket of the observe memos for a resource. Resources usually are
+ * consecutive in an array, so they end up in different buckets.
+ */
+static unsigned _res_bucket(const coap_resource_t *resource)
+{
+    return ((uintptr_t)resource / sizeof(coap_resource_t))
+           % CONFIG_GCOAP_OBS_REGISTRATIONS_MAX;
+}
 
-        if (_coap_state.observers[i].family == AF_UNSPEC) {
-            empty_slot = i;
+/*
+ * Find the observe memos of a resource. A bucket only links the first memo
+ * of each resource, the other memos of a resource follow it in
+ * memo_same_next.
+ *
+ * resource[in] -- Resource to match
+ *
+ * return Link to the first memo of the resource, or NULL if not observed
+ */
+static uint16_t *_res_memos(const coap_resource_t *resource)
+{
+    for (uint16_t *i = &_coap_state.memo_buckets[_res_bucket(resource)];
+         *i != 0; i = &_coap_state.memo_res_next[*i - 1]) {
+        if (_coap_state.observe_memos[*i - 1].resource == resource) {
+            return i;
         }
-        else if (sock_udp_ep_equal(&_coap_state.observers[i], remote)) {
-            *observer = &_coap_state.observers[i];
-            break;
+    }
+    return NULL;
+}
+
+/*
+ * Add an observe memo to the memos of its resource, keeping them sorted by
+ * position.
+ */
+static void _res_memos_add(gcoap_observe_memo_t *memo)
+{
+    unsigned pos = (memo - _coap_state.observe_memos) + 1;
+    uint16_t *first = _res_memos(memo->resource);
+
+    if (first == NULL) {
+        uint16_t *bucket = &_coap_state.memo_buckets[_res_bucket(memo->resource)];
+
+        _coap_state.memo_same_next[pos - 1] = 0;
+        _coap_state.memo_res_next[pos - 1] = *bucket;
+        *bucket = pos;
+    }
+    else if (pos < *first) {
+        _coap_state.memo_same_next[pos - 1] = *first;
+        _coap_state.memo_res_next[pos - 1] = _coap_state.memo_res_next[*first - 1];
+        *first = pos;
+    }
+    else {
+        unsigned i = *first;
+
+        while ((_coap_state.memo_same_next[i - 1] != 0) &&
+               (_coap_state.memo_same_next[i - 1] < pos)) {
+            i = _coap_state.memo_same_next[i - 1];
+        }
+        _coap_state.memo_same_next[pos - 1] = _coap_state.memo_same_next[i - 1];
+        _coap_state.memo_same_next[i - 1] = pos;
+    }
+}
+
+/*
+ * Remove an observe memo from the memos of its resource.
+ */
+static void _res_memos_remove(gcoap_observe_memo_t *memo)
+{
+    unsigned pos = (memo - _coap_state.observe_memos) + 1;
+    uint16_t *first = _res_memos(memo->resource);
+
+    assert(first != NULL);
+    if (*first != pos) {
+        _list_remove(&_coap_state.memo_same_next[*first - 1],
+                     _coap_state.memo_same_next, pos);
+    }
+    else if (_coap_state.memo_same_next[pos - 1] != 0) {
+        /* the next memo of the resource takes over the place in the bucket */
+        unsigned next = _coap_state.memo_same_next[pos - 1];
+
+        _coap_state.memo_res_next[next - 1] = _coap_state.memo_res_next[pos - 1];
+        *first = next;
+    }
+    else {
+        *first = _coap_state.memo_res_next[pos - 1];
+    }
+}
+
+/*
+ * Find registered observer for a remote address and port.
+ *
+ * remote[in] -- Endpoint to match
+ *
+ * return Registered observer, or NULL if not found
+ */
+static sock_udp_ep_t *_find_observer(const sock_udp_ep_t *remote)
+{
+    for (unsigned i = _coap_state.obs_buckets[_obs_bucket(remote)]; i != 0;
+         i = _coap_state.obs_next[i - 1]) {
+        if (sock_udp_ep_equal(&_coap_state.observers[i - 1], remote)) {
+            return &_coap_state.observers[i - 1];
         }
     }
-    return empty_slot;
+    return NULL;
+}
+
+/*
+ * Register a new observer.
+ *
+ * remote[in] -- Endpoint of the observer
+ *
+ * return New observer, or NULL if no space left
+ */
+static sock_udp_ep_t *_add_observer(const sock_udp_ep_t *remote)
+{
+    unsigned pos = _coap_state.obs_free;
+    unsigned bucket = _obs_bucket(remote);
+
+    if (pos == 0) {
+        return NULL;
+    }
+    _coap_state.obs_free = _coap_state.obs_next[pos - 1];
+    memcpy(&_coap_state.observers[pos - 1], remote, sizeof(sock_udp_ep_t));
+    _coap_state.obs_next[pos - 1] = _coap_state.obs_buckets[bucket];
+    _coap_state.obs_buckets[bucket] = pos;
+    _coap_state.obs_memos[pos - 1] = 0;
+    return &_coap_state.observers[pos - 1];
 }
 
 /*
  * Find registered observe memo for a remote address and token.
  *
- * memo[out] -- Registered observe memo, or NULL if not found
  * remote[in] -- Endpoint for address to match
- * pdu[in] -- PDU for token to match, or NULL to match only on remote address
+ * pdu[in] -- PDU for token to match
  *
- * return Index of empty slot, suitable for registering new memo; or -1 if no
- *        empty slots. Undefined if memo found.
+ * return Registered observe memo, or NULL if not found
  */
-static int _find_obs_memo(gcoap_observe_memo_t **memo, sock_udp_ep_t *remote,
-                                                       coap_pkt_t *pdu)
+static gcoap_observe_memo_t *_find_obs_memo(const sock_udp_ep_t *remote,
+                                            const coap_pkt_t *pdu)
 {
-    int empty_slot = -1;
-    *memo          = NULL;
+    sock_udp_ep_t *observer = _find_observer(remote);
+    unsigned token_len = coap_get_token_len(pdu);
 
-    sock_udp_ep_t *remote_observer = NULL;
-    _find_observer(&remote_observer, remote);
+    if ((observer == NULL) || (token_len == 0)) {
+        return NULL;
+    }
+    for (unsigned i = _coap_state.obs_memos[observer - _coap_state.observers];
+         i != 0; i = _coap_state.memo_obs_next[i - 1]) {
+        gcoap_observe_memo_t *memo = &_coap_state.observe_memos[i - 1];
 
-    for (unsigned i = 0; i < CONFIG_GCOAP_OBS_REGISTRATIONS_MAX; i++) {
-        if (_coap_state.observe_memos[i].observer == NULL) {
-            empty_slot = i;
-            continue;
+        if ((memo->token_len == token_len) &&
+            (memcmp(&memo->token[0], &pdu->token[0], token_len) == 0)) {
+            return memo;
         }
+    }
+    return NULL;
+}
 
-        if (_coap_state.observe_memos[i].observer == remote_observer) {
-            if (pdu == NULL) {
-                *memo = &_coap_state.observe_memos[i];
-                break;
-            }
+/*
+ * Add an observe memo for an observer. The resource still must be set with
+ * _set_obs_memo_resource().
+ *
+ * observer[in] -- Registered observer
+ *
+ * return New observe memo, or NULL if no space left
+ */
+static gcoap_observe_memo_t *_add_obs_memo(sock_udp_ep_t *observer)
+{
+    unsigned pos = _coap_state.memo_free;
+    unsigned obs_pos = observer - _coap_state.observers;
+    gcoap_observe_memo_t *memo;
 
-            if (_coap_state.observe_memos[i].token_len == coap_get_token_len(pdu)) {
-                unsigned cmplen = _coap_state.observe_memos[i].token_len;
-                if (cmplen &&
-                        memcmp(&_coap_state.observe_memos[i].token[0], &pdu->token[0],
-                                                                       cmplen) == 0) {
-                    *memo = &_coap_state.observe_memos[i];
-                    break;
-                }
-            }
-        }
+    if (pos == 0) {
+        return NULL;
+    }
+    _coap_state.memo_free = _coap_state.memo_res_next[pos - 1];
+    memo = &_coap_state.observe_memos[pos - 1];
+    memo->observer = observer;
+    memo->resource = NULL;
+    _coap_state.memo_obs_next[pos - 1] = _coap_state.obs_memos[obs_pos];
+    _coap_state.obs_memos[obs_pos] = pos;
+    return memo;
+}
+
+/*
+ * Set the resource of an observe memo, and move the memo to the memos of
+ * the resource.
+ */
+static void _set_obs_memo_resource(gcoap_observe_memo_t *memo,
+                                   const coap_resource_t *resource)
+{
+    if (memo->resource == resource) {
+        return;
+    }
+    if (memo->resource != NULL) {
+        _res_memos_remove(memo);
+    }
+    memo->resource = resource;
+    _res_memos_add(memo);
+}
+
+/*
+ * Remove an observe memo, and its observer if it has no other memos.
+ */
+static void _remove_obs_memo(gcoap_observe_memo_t *memo)
+{
+    unsigned pos = (memo - _coap_state.observe_memos) + 1;
+    unsigned obs_pos = (memo->observer - _coap_state.observers) + 1;
+
+    if (memo->resource != NULL) {
+        _res_memos_remove(memo);
     }
-    return empty_slot;
+    _list_remove(&_coap_state.obs_memos[obs_pos - 1],
+                 _coap_state.memo_obs_next, pos);
+    if (_coap_state.obs_memos[obs_pos - 1] == 0) {
+        _list_remove(&_coap_state.obs_buckets[_obs_bucket(memo->observer)],
+                     _coap_state.obs_next, obs_pos);
+        memo->observer->family = AF_UNSPEC;
+        _coap_state.obs_next[obs_pos - 1] = _coap_state.obs_free;
+        _coap_state.obs_free = obs_pos;
+    }
+    memo->observer = NULL;
+    memo->resource = NULL;
+    _coap_state.memo_res_next[pos - 1] = _coap_state.memo_free;
+    _coap_state.memo_free = pos;
 }
 
 /*
  * Find registered observe memo for a resource.
  *
- * memo[out] -- Registered observe memo, or NULL if not found
  * resource[in] -- Resource to match
+ * remote[in] -- Observer to match, or NULL to match any observer
+ *
+ * return Registered observe memo, or NULL if not found
  */
-static void _find_obs_memo_resource(gcoap_observe_memo_t **memo,
-                                   const coap_resource_t *resource)
+static gcoap_observe_memo_t *_find_obs_memo_resource(
+                                    const coap_resource_t *resource,
+                                    const sock_udp_ep_t *remote)
 {
-    *memo = NULL;
-    for (int i = 0; i < CONFIG_GCOAP_OBS_REGISTRATIONS_MAX; i++) {
-        if (_coap_state.observe_memos[i].observer != NULL
-                && _coap_state.observe_memos[i].resource == resource) {
-            *memo = &_coap_state.observe_memos[i];
-            break;
+    if (remote == NULL) {
+        uint16_t *first = _res_memos(resource);
+
+        return (first != NULL) ? &_coap_state.observe_memos[*first - 1] : NULL;
+    }
+
+    /* an observer usually has fewer memos than a resource */
+    sock_udp_ep_t *observer = _find_observer(remote);
+
+    if (observer == NULL) {
+        return NULL;
+    }
+    for (unsigned i = _coap_state.obs_memos[observer - _coap_state.observers];
+         i != 0; i = _coap_state.memo_obs_next[i - 1]) {
+        gcoap_observe_memo_t *memo = &_coap_state.observe_memos[i - 1];
+
+        if (memo->resource == resource) {
+            return memo;
         }
     }
+    return NULL;
 }
 
 /*
@@ -919,8 +1184,7 @@ kernel_pid_t gcoap_init(void)
     mutex_init(&_coap_state.lock);
     /* Blank lists so we know if an entry is available. */
     memset(&_coap_state.open_reqs[0], 0, sizeof(_coap_state.open_reqs));
-    memset(&_coap_state.observers[0], 0, sizeof(_coap_state.observers));
-    memset(&_coap_state.observe_memos[0], 0, sizeof(_coap_state.observe_memos));
+    _init_obs();
     memset(&_coap_state.resend_bufs[0], 0, sizeof(_coap_state.resend_bufs));
     /* randomize initial value */
     atomic_init(&_coap_state.next_message_id, (unsigned)random_uint32());
@@ -944,6 +1208,16 @@ void gcoap_register_listener(gcoap_listener_t *listener)
     if (!listener->request_matcher) {
         listener->request_matcher = _request_matcher_default;
     }
+
+#if IS_USED(MODULE_NANOCOAP_RESOURCE_TREE)
+    if ((listener->resource_tree != NULL) &&
+        (coap_resource_tree_init(listener->resource_tree, listener->resources,
+                                 listener->resources_len) < 0)) {
+        LOG_WARNING("gcoap: unable to build resource tree, matching "
+                    "linearly\n");
+        listener->resource_tree = NULL;
+    }
+#endif
 }
 
 int gcoap_req_init(coap_pkt_t *pdu, uint8_t *buf, size_t len,
@@ -1111,21 +1385,13 @@ int gcoap_resp_init(coap_pkt_t *pdu, uint8_t *buf, size_t len, unsigned code)
     return 0;
 }
 
-int gcoap_obs_init(coap_pkt_t *pdu, uint8_t *buf, size_t len,
-                                                  const coap_resource_t *resource)
+static int _obs_pdu_init(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                         uint8_t *token, unsigned token_len)
 {
-    gcoap_observe_memo_t *memo = NULL;
-
-    _find_obs_memo_resource(&memo, resource);
-    if (memo == NULL) {
-        /* Unique return value to specify there is not an observer */
-        return GCOAP_OBS_INIT_UNUSED;
-    }
-
     pdu->hdr       = (coap_hdr_t *)buf;
     uint16_t msgid = (uint16_t)atomic_fetch_add(&_coap_state.next_message_id, 1);
-    ssize_t hdrlen = coap_build_hdr(pdu->hdr, COAP_TYPE_NON, &memo->token[0],
-                                    memo->token_len, COAP_CODE_CONTENT, msgid);
+    ssize_t hdrlen = coap_build_hdr(pdu->hdr, COAP_TYPE_NON, token, token_len,
+                                    COAP_CODE_CONTENT, msgid);
 
     if (hdrlen > 0) {
         coap_pkt_init(pdu, buf, len, hdrlen);
@@ -1142,21 +1408,164 @@ int gcoap_obs_init(coap_pkt_t *pdu, uint8_t *buf, size_t len,
     }
 }
 
+int gcoap_obs_init(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                                                  const coap_resource_t *resource)
+{
+    gcoap_observe_memo_t *memo;
+    uint8_t token[GCOAP_TOKENLEN_MAX];
+    unsigned token_len = 0;
+
+    mutex_lock(&_coap_state.lock);
+    memo = _find_obs_memo_resource(resource, NULL);
+    if (memo != NULL) {
+        token_len = memo->token_len;
+        memcpy(token, &memo->token[0], token_len);
+    }
+    mutex_unlock(&_coap_state.lock);
+    if (memo == NULL) {
+        /* Unique return value to specify there is not an observer */
+        return GCOAP_OBS_INIT_UNUSED;
+    }
+    return _obs_pdu_init(pdu, buf, len, token, token_len);
+}
+
 size_t gcoap_obs_send(const uint8_t *buf, size_t len,
                       const coap_resource_t *resource)
 {
-    gcoap_observe_memo_t *memo = NULL;
-
-    _find_obs_memo_resource(&memo, resource);
+    gcoap_observe_memo_t *memo;
+    sock_udp_ep_t remote;
+    ssize_t bytes = 0;
 
+    /* copy the observer, so the lock is not held while sending */
+    mutex_lock(&_coap_state.lock);
+    memo = _find_obs_memo_resource(resource, NULL);
+    if (memo) {
+        remote = *memo->observer;
+    }
+    mutex_unlock(&_coap_state.lock);
     if (memo) {
-        ssize_t bytes = _tl_send(&_sock_udp, buf, len, memo->observer, NULL);
-        return (size_t)((bytes > 0) ? bytes : 0);
+        bytes = _tl_send(&_sock_udp, buf, len, &remote, NULL);
+    }
+    return (size_t)((bytes > 0) ? bytes : 0);
+}
+
+#if IS_USED(MODULE_GCOAP_OBS_FANOUT)
+/* number of observers gcoap_obs_notify() copies at once */
+#define GCOAP_OBS_NOTIFY_BATCH      (4U)
+
+static_assert(CONFIG_GCOAP_OBS_NOTIFY_BURST > 0,
+              "CONFIG_GCOAP_OBS_NOTIFY_BURST must be at least 1");
+
+/* observer of a notification, copied to send without holding the lock */
+typedef struct {
+    sock_udp_ep_t remote;
+    uint8_t token[GCOAP_TOKENLEN_MAX];
+    uint8_t token_len;
+} _obs_target_t;
+
+int gcoap_obs_notify_init(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                          const coap_resource_t *resource)
+{
+    /* leave room for the longest token, gcoap_obs_notify() writes the actual
+     * one of each observer right in front of the options */
+    uint8_t token[GCOAP_TOKENLEN_MAX] = { 0 };
+    gcoap_observe_memo_t *memo;
+
+    mutex_lock(&_coap_state.lock);
+    memo = _find_obs_memo_resource(resource, NULL);
+    mutex_unlock(&_coap_state.lock);
+    if (memo == NULL) {
+        /* Unique return value to specify there is not an observer */
+        return GCOAP_OBS_INIT_UNUSED;
+    }
+    return _obs_pdu_init(pdu, buf, len, token, sizeof(token));
+}
+
+/*
+ * Copy the observers of a resource, behind the observe memo at cursor.
+ *
+ * cursor[inout] -- Position of the last memo copied, 0 to start
+ *
+ * return number of observers copied
+ */
+static unsigned _copy_observers(const coap_resource_t *resource,
+                                unsigned *cursor,
+                                _obs_target_t *targets, unsigned numof)
+{
+    unsigned n = 0, i;
+
+    mutex_lock(&_coap_state.lock);
+    if ((*cursor != 0) &&
+        (_coap_state.observe_memos[*cursor - 1].resource == resource)) {
+        i = _coap_state.memo_same_next[*cursor - 1];
     }
     else {
-        return 0;
+        /* the memo at cursor was removed meanwhile, so look for the first
+         * one behind it; the memos of a resource are sorted by position */
+        uint16_t *first = _res_memos(resource);
+
+        i = (first != NULL) ? *first : 0;
+        while ((i != 0) && (i <= *cursor)) {
+            i = _coap_state.memo_same_next[i - 1];
+        }
     }
+    for (; (i != 0) && (n < numof); i = _coap_state.memo_same_next[i - 1]) {
+        gcoap_observe_memo_t *memo = &_coap_state.observe_memos[i - 1];
+
+        *cursor = i;
+        targets[n].remote = *memo->observer;
+        memcpy(targets[n].token, &memo->token[0], memo->token_len);
+        targets[n].token_len = memo->token_len;
+        n++;
+    }
+    mutex_unlock(&_coap_state.lock);
+    return n;
+}
+
+unsigned gcoap_obs_notify(coap_pkt_t *pdu, size_t len,
+                          const coap_resource_t *resource)
+{
+    uint8_t *buf = (uint8_t *)pdu->hdr;
+    uint8_t *opts = buf + GCOAP_HEADER_MAXLEN;
+    unsigned code = coap_get_code_raw(pdu);
+    _obs_target_t targets[GCOAP_OBS_NOTIFY_BATCH];
+    unsigned sent = 0, count = 0, cursor = 0, numof;
+
+    assert(coap_get_token_len(pdu) == GCOAP_TOKENLEN_MAX);
+    assert(len >= GCOAP_HEADER_MAXLEN);
+
+    /* The observers are copied a few at a time and the lock is released
+     * while sending and pausing. The cursor keeps the position in the memos
+     * of the resource, so observers that register or deregister meanwhile
+     * do not make others be missed or notified twice. A new registration
+     * may be missed, like with a notification that crosses the
+     * registration on the network. */
+    do {
+        numof = _copy_observers(resource, &cursor, targets,
+                                ARRAY_SIZE(targets));
+        for (unsigned j = 0; j < numof; j++) {
+            if ((CONFIG_GCOAP_OBS_NOTIFY_PAUSE_US > 0) && (sent > 0) &&
+                ((sent % CONFIG_GCOAP_OBS_NOTIFY_BURST) == 0)) {
+                xtimer_usleep(CONFIG_GCOAP_OBS_NOTIFY_PAUSE_US);
+            }
+            /* only the header and the token differ between observers */
+            uint8_t *hdr = opts - sizeof(coap_hdr_t) - targets[j].token_len;
+            uint16_t msgid = (uint16_t)atomic_fetch_add(
+                                &_coap_state.next_message_id, 1);
+
+            coap_build_hdr((coap_hdr_t *)hdr, COAP_TYPE_NON, targets[j].token,
+                           targets[j].token_len, code, msgid);
+            sent++;
+            if (_tl_send(&_sock_udp, hdr, len - (hdr - buf),
+                         &targets[j].remote, NULL) > 0) {
+                count++;
+            }
+        }
+    } while (numof == ARRAY_SIZE(targets));
+
+    return count;
 }
+#endif /* MODULE_GCOAP_OBS_FANOUT */
 
 uint8_t gcoap_op_state(void)
 {
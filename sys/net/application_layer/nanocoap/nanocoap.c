@@ -27,6 +27,8 @@
 #include <string.h>
 
 #include "bitarithm.h"
+#include "kernel_defines.h"
+#include "log.h"
 #include "net/nanocoap.h"
 
 #define ENABLE_DEBUG 0
@@ -45,6 +47,14 @@ static int _decode_value(unsigned val, uint8_t **pkt_pos_ptr, uint8_t *pkt_end);
 static uint32_t _decode_uint(uint8_t *pkt_pos, unsigned nbytes);
 static size_t _encode_uint(uint32_t *val);
 
+#if IS_USED(MODULE_NANOCOAP_OPT_INDEX)
+/* bit of an option number in coap_pkt_t::opt_mask */
+static inline uint32_t _opt_bit(unsigned opt_num)
+{
+    return 1UL << ((opt_num < 31) ? opt_num : 31);
+}
+#endif
+
 /* http://tools.ietf.org/html/rfc7252#section-3
  *  0                   1                   2                   3
  *  0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1
@@ -95,6 +105,9 @@ int coap_parse(coap_pkt_t *pkt, uint8_t *buf, size_t len)
     coap_optpos_t *optpos = pkt->options;
     unsigned option_count = 0;
     unsigned option_nr = 0;
+#if IS_USED(MODULE_NANOCOAP_OPT_INDEX)
+    pkt->opt_mask = 0;
+#endif
 
     /* parse options */
     while (pkt_pos < pkt_end) {
@@ -129,6 +142,11 @@ int coap_parse(coap_pkt_t *pkt, uint8_t *buf, size_t len)
                 optpos->opt_num = option_nr;
                 optpos->offset = (uintptr_t)option_start - (uintptr_t)hdr;
                 DEBUG("optpos option_nr=%u %u\n", (unsigned)option_nr, (unsigned)optpos->offset);
+#if IS_USED(MODULE_NANOCOAP_OPT_INDEX)
+                pkt->opt_values[option_count].offset = pkt_pos - buf;
+                pkt->opt_values[option_count].len = option_len;
+                pkt->opt_mask |= _opt_bit(option_nr);
+#endif
                 optpos++;
                 option_count++;
             }
@@ -176,18 +194,35 @@ int coap_match_path(const coap_resource_t *resource, uint8_t *uri)
     return res;
 }
 
+/*
+ * Find option in the option offset array
+ *
+ * return         position in the array
+ * return         -1 if not found
+ */
+static int _find_option(const coap_pkt_t *pkt, unsigned opt_num)
+{
+#if IS_USED(MODULE_NANOCOAP_OPT_INDEX)
+    if (!(pkt->opt_mask & _opt_bit(opt_num))) {
+        return -1;
+    }
+#endif
+    for (unsigned i = 0; i < pkt->options_len; i++) {
+        if (pkt->options[i].opt_num == opt_num) {
+            return i;
+        }
+    }
+    return -1;
+}
+
 uint8_t *coap_find_option(const coap_pkt_t *pkt, unsigned opt_num)
 {
-    const coap_optpos_t *optpos = pkt->options;
-    unsigned opt_count = pkt->options_len;
+    int pos = _find_option(pkt, opt_num);
 
-    while (opt_count--) {
-        if (optpos->opt_num == opt_num) {
-            return (uint8_t*)pkt->hdr + optpos->offset;
-        }
-        optpos++;
+    if (pos < 0) {
+        return NULL;
     }
-    return NULL;
+    return (uint8_t*)pkt->hdr + pkt->options[pos].offset;
 }
 
 /*
@@ -219,47 +254,67 @@ static uint8_t *_parse_option(const coap_pkt_t *pkt,
     return pkt_pos;
 }
 
-ssize_t coap_opt_get_opaque(const coap_pkt_t *pkt, unsigned opt_num, uint8_t **value)
+/*
+ * Find value of the first instance of an option
+ *
+ * pkt[in]        coap_pkt_t for buffer
+ * opt_num[in]    option number to find
+ * value[out]     first byte of the option value
+ *
+ * return         length of the option value
+ * return         -ENOENT if option not found
+ * return         -EINVAL if option header invalid
+ */
+static int _get_option_value(const coap_pkt_t *pkt, unsigned opt_num,
+                             uint8_t **value)
 {
-    uint8_t *start = coap_find_option(pkt, opt_num);
-    if (!start) {
+    int pos = _find_option(pkt, opt_num);
+    if (pos < 0) {
         return -ENOENT;
     }
 
+#if IS_USED(MODULE_NANOCOAP_OPT_INDEX)
+    *value = (uint8_t *)pkt->hdr + pkt->opt_values[pos].offset;
+    return pkt->opt_values[pos].len;
+#else
     uint16_t delta;
     int len;
 
-    *value = _parse_option(pkt, start, &delta, &len);
-    if (!*value) {
+    *value = _parse_option(pkt, (uint8_t *)pkt->hdr + pkt->options[pos].offset,
+                           &delta, &len);
+    if (!*value || (len < 0)) {
         return -EINVAL;
     }
-
     return len;
+#endif
+}
+
+ssize_t coap_opt_get_opaque(const coap_pkt_t *pkt, unsigned opt_num, uint8_t **value)
+{
+    return _get_option_value(pkt, opt_num, value);
 }
 
 int coap_opt_get_uint(const coap_pkt_t *pkt, uint16_t opt_num, uint32_t *target)
 {
     assert(target);
 
-    uint8_t *opt_pos = coap_find_option(pkt, opt_num);
-    if (opt_pos) {
-        uint16_t delta;
-        int option_len = 0;
-        uint8_t *pkt_pos = _parse_option(pkt, opt_pos, &delta, &option_len);
-        if (option_len >= 0) {
-            if (option_len > 4) {
-                DEBUG("nanocoap: uint option with len > 4 (unsupported).\n");
-                return -ENOSPC;
-            }
-            *target = _decode_uint(pkt_pos, option_len);
-            return 0;
-        }
-        else {
-            DEBUG("nanocoap: discarding packet with invalid option length.\n");
-            return -EBADMSG;
+    uint8_t *pkt_pos;
+    int option_len = _get_option_value(pkt, opt_num, &pkt_pos);
+    if (option_len >= 0) {
+        if (option_len > 4) {
+            DEBUG("nanocoap: uint option with len > 4 (unsupported).\n");
+            return -ENOSPC;
         }
+        *target = _decode_uint(pkt_pos, option_len);
+        return 0;
+    }
+    else if (option_len == -ENOENT) {
+        return -ENOENT;
+    }
+    else {
+        DEBUG("nanocoap: discarding packet with invalid option length.\n");
+        return -EBADMSG;
     }
-    return -ENOENT;
 }
 
 uint8_t *coap_iterate_option(const coap_pkt_t *pkt, uint8_t **optpos,
@@ -281,13 +336,10 @@ uint8_t *coap_iterate_option(const coap_pkt_t *pkt, uint8_t **optpos,
 
 unsigned coap_get_content_type(coap_pkt_t *pkt)
 {
-    uint8_t *opt_pos = coap_find_option(pkt, COAP_OPT_CONTENT_FORMAT);
+    uint8_t *pkt_pos;
+    int option_len = _get_option_value(pkt, COAP_OPT_CONTENT_FORMAT, &pkt_pos);
     unsigned content_type = COAP_FORMAT_NONE;
-    if (opt_pos) {
-        uint16_t delta;
-        int option_len = 0;
-        uint8_t *pkt_pos = _parse_option(pkt, opt_pos, &delta, &option_len);
-
+    if (option_len >= 0) {
         if (option_len == 0) {
             content_type = 0;
         } else if (option_len == 1) {
@@ -361,18 +413,14 @@ ssize_t coap_opt_get_string(const coap_pkt_t *pkt, uint16_t optnum,
 
 int coap_get_blockopt(coap_pkt_t *pkt, uint16_t option, uint32_t *blknum, unsigned *szx)
 {
-    uint8_t *optpos = coap_find_option(pkt, option);
-    if (!optpos) {
+    uint8_t *data_start;
+    int option_len = _get_option_value(pkt, option, &data_start);
+    if (option_len == -ENOENT) {
         *blknum = 0;
         *szx = 0;
         return -1;
     }
-
-    int option_len;
-    uint16_t delta;
-
-    uint8_t *data_start = _parse_option(pkt, optpos, &delta, &option_len);
-    if (!data_start) {
+    else if (option_len < 0) {
         DEBUG("nanocoap: invalid start data\n");
         return -1;
     }
@@ -402,6 +450,28 @@ ssize_t coap_handle_req(coap_pkt_t *pkt, uint8_t *resp_buf, unsigned resp_buf_le
     if (pkt->hdr->code == 0) {
         return coap_build_reply(pkt, COAP_CODE_EMPTY, resp_buf, resp_buf_len, 0);
     }
+#if IS_USED(MODULE_NANOCOAP_RESOURCE_TREE)
+    static coap_resource_tree_node_t nodes[CONFIG_NANOCOAP_RESOURCE_TREE_NODES_MAX];
+    static coap_resource_tree_t tree = {
+        .nodes = nodes,
+        .nodes_numof = ARRAY_SIZE(nodes),
+    };
+    static int tree_res = 1;
+
+    /* build the tree with the first request, coap_resources is not known
+     * at compile time */
+    if (tree_res > 0) {
+        tree_res = coap_resource_tree_init(&tree, coap_resources,
+                                           coap_resources_numof);
+        if (tree_res < 0) {
+            LOG_WARNING("nanocoap: no resource tree (%d), matching linearly\n",
+                        tree_res);
+        }
+    }
+    if (tree_res == 0) {
+        return coap_resource_tree_handler(pkt, resp_buf, resp_buf_len, &tree);
+    }
+#endif
     return coap_tree_handler(pkt, resp_buf, resp_buf_len, coap_resources,
                              coap_resources_numof);
 }
@@ -822,6 +892,12 @@ static ssize_t _add_opt_pkt(coap_pkt_t *pkt, uint16_t optnum, const uint8_t *val
 
     pkt->options[pkt->options_len].opt_num = optnum;
     pkt->options[pkt->options_len].offset = pkt->payload - (uint8_t *)pkt->hdr;
+#if IS_USED(MODULE_NANOCOAP_OPT_INDEX)
+    pkt->opt_values[pkt->options_len].offset = pkt->options[pkt->options_len].offset
+                                               + optlen - val_len;
+    pkt->opt_values[pkt->options_len].len = val_len;
+    pkt->opt_mask |= _opt_bit(optnum);
+#endif
     pkt->options_len++;
     pkt->payload += optlen;
     pkt->payload_len -= optlen;
@@ -0,0 +1,207 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_nanocoap
+ * @{
+ *
+ * @file
+ * @brief       Prefix tree over resource paths
+ *
+ * The tree is a radix tree on the characters of the paths: each edge is
+ * labeled with a string, and siblings differ in the first character of their
+ * labels. A resource is attached to the node its path ends in.
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <string.h>
+
+#include "net/nanocoap.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/*
+ * Take a new node from the tree's storage.
+ *
+ * return Position of the node plus one, or 0 if no node left
+ */
+static unsigned _new_node(coap_resource_tree_t *tree, unsigned *used,
+                          const char *label, size_t label_len)
+{
+    coap_resource_tree_node_t *node;
+
+    if (*used >= tree->nodes_numof) {
+        return 0;
+    }
+    node = &tree->nodes[*used];
+    memset(node, 0, sizeof(*node));
+    node->label = label;
+    node->label_len = label_len;
+    return ++(*used);
+}
+
+/*
+ * Find child of a node whose label starts with a character.
+ *
+ * return Position of the child plus one, or 0 if none
+ */
+static unsigned _find_child(const coap_resource_tree_t *tree,
+                            const coap_resource_tree_node_t *node, char c)
+{
+    for (unsigned i = node->child; i != 0; i = tree->nodes[i - 1].sibling) {
+        if (tree->nodes[i - 1].label[0] == c) {
+            return i;
+        }
+    }
+    return 0;
+}
+
+static int _insert(coap_resource_tree_t *tree, unsigned *used, unsigned pos)
+{
+    const char *path = tree->resources[pos].path;
+    coap_resource_tree_node_t *node = &tree->nodes[0];
+
+    while (*path != '\0') {
+        unsigned child = _find_child(tree, node, *path);
+        size_t common = 0;
+
+        if (child == 0) {
+            /* append, so that children stay sorted by path */
+            child = _new_node(tree, used, path, strlen(path));
+            if (child == 0) {
+                return -ENOMEM;
+            }
+            uint16_t *link = &node->child;
+            while (*link != 0) {
+                link = &tree->nodes[*link - 1].sibling;
+            }
+            *link = child;
+            node = &tree->nodes[child - 1];
+            break;
+        }
+        node = &tree->nodes[child - 1];
+        while ((common < node->label_len) &&
+               (node->label[common] == path[common])) {
+            common++;
+        }
+        if (common < node->label_len) {
+            /* path leaves the label: split the node, its tail moves into a
+             * new child */
+            unsigned tail = _new_node(tree, used, node->label + common,
+                                      node->label_len - common);
+            if (tail == 0) {
+                return -ENOMEM;
+            }
+            coap_resource_tree_node_t *split = &tree->nodes[tail - 1];
+
+            split->child = node->child;
+            split->resources = node->resources;
+            split->resources_numof = node->resources_numof;
+            node->label_len = common;
+            node->child = tail;
+            node->resources = 0;
+            node->resources_numof = 0;
+        }
+        path += common;
+    }
+
+    if (node->resources_numof == 0) {
+        node->resources = pos + 1;
+    }
+    /* resources are sorted, so the ones of a path are next to each other */
+    assert(node->resources + node->resources_numof == pos + 1);
+    node->resources_numof++;
+    return 0;
+}
+
+int coap_resource_tree_init(coap_resource_tree_t *tree,
+                            const coap_resource_t *resources,
+                            size_t resources_numof)
+{
+    unsigned used = 0;
+
+    tree->resources = resources;
+    tree->resources_numof = resources_numof;
+    if (_new_node(tree, &used, "", 0) == 0) {
+        return -ENOMEM;
+    }
+    for (unsigned i = 0; i < resources_numof; i++) {
+        if ((i > 0) && (strcmp(resources[i - 1].path, resources[i].path) > 0)) {
+            DEBUG("nanocoap: resource %s not sorted\n", resources[i].path);
+            return -EINVAL;
+        }
+        int res = _insert(tree, &used, i);
+        if (res < 0) {
+            return res;
+        }
+    }
+    DEBUG("nanocoap: %u nodes for %u resources\n", used,
+          (unsigned)resources_numof);
+    return 0;
+}
+
+int coap_resource_tree_find(const coap_resource_tree_t *tree, const char *uri,
+                            coap_method_flags_t method_flag,
+                            const coap_resource_t **resource)
+{
+    const coap_resource_tree_node_t *node = &tree->nodes[0];
+    int res = -ENOENT;
+
+    while (1) {
+        /* resources of the nodes on the way are prefixes of the URI, so they
+         * come first in the array */
+        for (unsigned i = 0; i < node->resources_numof; i++) {
+            const coap_resource_t *r = &tree->resources[node->resources - 1 + i];
+
+            if (!(r->methods & COAP_MATCH_SUBTREE) && (*uri != '\0')) {
+                continue;
+            }
+            if (r->methods & method_flag) {
+                *resource = r;
+                return 0;
+            }
+            res = -EPERM;
+        }
+        if (*uri == '\0') {
+            break;
+        }
+        unsigned child = _find_child(tree, node, *uri);
+        if (child == 0) {
+            break;
+        }
+        node = &tree->nodes[child - 1];
+        if (strncmp(uri, node->label, node->label_len) != 0) {
+            break;
+        }
+        uri += node->label_len;
+    }
+    return res;
+}
+
+ssize_t coap_resource_tree_handler(coap_pkt_t *pkt, uint8_t *resp_buf,
+                                   unsigned resp_buf_len,
+                                   const coap_resource_tree_t *tree)
+{
+    coap_method_flags_t method_flag = coap_method2flag(coap_get_code_detail(pkt));
+    const coap_resource_t *resource;
+
+    uint8_t uri[CONFIG_NANOCOAP_URI_MAX];
+    if (coap_get_uri_path(pkt, uri) <= 0) {
+        return -EBADMSG;
+    }
+    DEBUG("nanocoap: URI path: \"%s\"\n", uri);
+
+    if (coap_resource_tree_find(tree, (char *)uri, method_flag, &resource) == 0) {
+        return resource->handler(pkt, resp_buf, resp_buf_len, resource->context);
+    }
+    return coap_build_reply(pkt, COAP_CODE_404, resp_buf, resp_buf_len, 0);
+}
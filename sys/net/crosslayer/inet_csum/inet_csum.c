@@ -13,13 +13,102 @@
  */
 
 #include <inttypes.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include "od.h"
 #include "net/inet_csum.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+/* returns the byte at @p ptr shifted to where it ends up when loading 16 bit
+ * words in host byte order from even addresses */
+static inline uint32_t _byte_in_lane(const uint8_t *ptr)
+{
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    return (uint32_t)*ptr << (((uintptr_t)ptr & 1) << 3);
+#else
+    return (uint32_t)*ptr << ((~(uintptr_t)ptr & 1) << 3);
+#endif
+}
+
+/**
+ * @brief   Sums up @p len bytes at @p buf as 16 bit words in network byte
+ *          order, @p len must be even
+ *
+ * The words are read in host byte order, 32 bits (or a SIMD register) at a
+ * time and from aligned addresses only. Carries are collected in a 64 bit
+ * accumulator and only folded in at the end, which results in the same
+ * one's complement sum (see RFC 1071, section 2).
+ */
+static uint16_t _csum_words(const uint8_t *buf, size_t len)
+{
+    const uint8_t *end = buf + len;
+    uint64_t acc = 0;
+    /* the lanes are determined by the address, if buf is odd or the host is
+     * little endian, the bytes of the sum are swapped */
+    bool swap = ((uintptr_t)buf & 1) ^
+                (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__);
+
+    while (((uintptr_t)buf & 0x3) && (buf < end)) {
+        acc += _byte_in_lane(buf++);
+    }
+
+#if defined(__SSE2__)
+    __m128i vacc = _mm_setzero_si128();
+    const __m128i zero = _mm_setzero_si128();
+    /* every 32 bit lane gets at most 2 * 0xffff per 16 bytes, which can't
+     * overflow for len <= UINT16_MAX */
+    while ((end - buf) >= 16) {
+        __m128i data = _mm_loadu_si128((const __m128i *)(uintptr_t)buf);
+        vacc = _mm_add_epi32(vacc, _mm_unpacklo_epi16(data, zero));
+        vacc = _mm_add_epi32(vacc, _mm_unpackhi_epi16(data, zero));
+        buf += 16;
+    }
+    uint32_t lanes[4];
+    _mm_storeu_si128((__m128i *)lanes, vacc);
+    acc += (uint64_t)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#elif defined(__ARM_NEON)
+    uint32x4_t vacc = vdupq_n_u32(0);
+    while ((end - buf) >= 16) {
+        vacc = vpadalq_u16(vacc, vreinterpretq_u16_u8(vld1q_u8(buf)));
+        buf += 16;
+    }
+    acc += (uint64_t)vgetq_lane_u32(vacc, 0) + vgetq_lane_u32(vacc, 1) +
+           vgetq_lane_u32(vacc, 2) + vgetq_lane_u32(vacc, 3);
+#endif
+
+    const uint32_t *words = (const uint32_t *)(uintptr_t)buf;
+    while ((end - buf) >= 16) {
+        acc += words[0];
+        acc += words[1];
+        acc += words[2];
+        acc += words[3];
+        words += 4;
+        buf += 16;
+    }
+    while ((end - buf) >= 4) {
+        acc += *(words++);
+        buf += 4;
+    }
+
+    while (buf < end) {
+        acc += _byte_in_lane(buf++);
+    }
+
+    while (acc >> 16) {
+        acc = (acc & 0xffff) + (acc >> 16);
+    }
+
+    return (swap) ? (uint16_t)((acc << 8) | (acc >> 8)) : (uint16_t)acc;
+}
+
 uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t accum_len)
 {
     uint32_t csum = sum;
@@ -45,13 +134,11 @@ uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t
         accum_len++;
     }
 
-    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
-        csum += (uint16_t)(*buf << 8) + *(buf + 1); /* group bytes by 16-byte words */
-                                                    /* and add them */
-    }
+    csum += _csum_words(buf, len & ~1);    /* group bytes by 16-byte words */
+                                            /* and add them */
 
     if ((accum_len + len) & 1)          /* if accumulated length is odd */
-        csum += (uint16_t)(*buf << 8);  /* add last byte as top half of 16-byte word */
+        csum += (uint16_t)(buf[len - 1] << 8);  /* add last byte as top half of 16-byte word */
 
     while (csum >> 16) {
         uint16_t carry = csum >> 16;
@@ -18,9 +18,11 @@
 #include <assert.h>
 #include <string.h>
 
+#include "net/ethernet.h"
 #include "net/ethernet/hdr.h"
 #include "net/gnrc.h"
 #include "net/gnrc/netif/ethernet.h"
+#include "net/gnrc/netif/internal.h"
 #include "net/netdev/eth.h"
 #ifdef MODULE_GNRC_IPV6
 #include "net/ipv6/hdr.h"
@@ -172,9 +174,24 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
     netdev_t *dev = netif->dev;
     gnrc_pktsnip_t *pkt = NULL;
     netdev_eth_rx_info_t rx_info = { .flags = 0 };
-    int bytes_expected = dev->driver->recv(dev, NULL, 0, NULL);
+    /* offset of the frame in pkt, for frames received without copying */
+    size_t offset = 0;
+    int nread = -ENOBUFS;
+
+    if (dev->driver->recv_buf != NULL) {
+        nread = gnrc_netif_recv_buf(netif, &pkt, &offset, ETHERNET_FRAME_LEN,
+                                    &rx_info);
+        if (nread > 0) {
+            /* free the unused space behind the frame */
+            gnrc_pktbuf_realloc_data(pkt, offset + nread);
+        }
+    }
+    if (nread == -ENOBUFS) {
+        int bytes_expected = dev->driver->recv(dev, NULL, 0, NULL);
 
-    if (bytes_expected > 0) {
+        if (bytes_expected <= 0) {
+            goto out;
+        }
         pkt = gnrc_pktbuf_add(NULL, NULL,
                               bytes_expected,
                               GNRC_NETTYPE_UNDEF);
@@ -188,15 +205,11 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
             goto out;
         }
 
-        int nread = dev->driver->recv(dev, pkt->data, bytes_expected, &rx_info);
+        nread = dev->driver->recv(dev, pkt->data, bytes_expected, &rx_info);
         if (nread <= 0) {
             DEBUG("gnrc_netif_ethernet: read error.\n");
             goto safe_out;
         }
-#ifdef MODULE_NETSTATS_L2
-        netif->stats.rx_count++;
-        netif->stats.rx_bytes += nread;
-#endif
 
         if (nread < bytes_expected) {
             /* we've got less than the expected packet size,
@@ -205,56 +218,66 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
             DEBUG("gnrc_netif_ethernet: reallocating.\n");
             gnrc_pktbuf_realloc_data(pkt, nread);
         }
+    }
+    if (nread <= 0) {
+        goto out;
+    }
+#ifdef MODULE_NETSTATS_L2
+    netif->stats.rx_count++;
+    netif->stats.rx_bytes += nread;
+#endif
 
-        DEBUG("gnrc_netif_ethernet: received packet from %s of length %d\n",
-              gnrc_netif_addr_to_str(pkt->data, ETHERNET_ADDR_LEN, addr_str),
-              nread);
+    DEBUG("gnrc_netif_ethernet: received packet from %s of length %d\n",
+          gnrc_netif_addr_to_str((uint8_t *)pkt->data + offset,
+                                 ETHERNET_ADDR_LEN, addr_str),
+          nread);
 #if defined(MODULE_OD) && ENABLE_DEBUG
-        od_hex_dump(pkt->data, nread, OD_WIDTH_DEFAULT);
+    od_hex_dump((uint8_t *)pkt->data + offset, nread, OD_WIDTH_DEFAULT);
 #endif
-        /* mark ethernet header */
-        gnrc_pktsnip_t *eth_hdr = gnrc_pktbuf_mark(pkt, sizeof(ethernet_hdr_t), GNRC_NETTYPE_UNDEF);
-        if (!eth_hdr) {
-            DEBUG("gnrc_netif_ethernet: no space left in packet buffer\n");
-            goto safe_out;
-        }
+    /* mark ethernet header, along with anything in front of it */
+    gnrc_pktsnip_t *eth_hdr = gnrc_pktbuf_mark(pkt,
+                                               offset + sizeof(ethernet_hdr_t),
+                                               GNRC_NETTYPE_UNDEF);
+    if (!eth_hdr) {
+        DEBUG("gnrc_netif_ethernet: no space left in packet buffer\n");
+        goto safe_out;
+    }
 
-        ethernet_hdr_t *hdr = (ethernet_hdr_t *)eth_hdr->data;
+    ethernet_hdr_t *hdr = (ethernet_hdr_t *)((uint8_t *)eth_hdr->data + offset);
 
 #ifdef MODULE_L2FILTER
-        if (!l2filter_pass(dev->filter, hdr->src, ETHERNET_ADDR_LEN)) {
-            DEBUG("gnrc_netif_ethernet: incoming packet filtered by l2filter\n");
-            goto safe_out;
-        }
+    if (!l2filter_pass(dev->filter, hdr->src, ETHERNET_ADDR_LEN)) {
+        DEBUG("gnrc_netif_ethernet: incoming packet filtered by l2filter\n");
+        goto safe_out;
+    }
 #endif
 
-        /* set payload type from ethertype */
-        pkt->type = gnrc_nettype_from_ethertype(byteorder_ntohs(hdr->type));
+    /* set payload type from ethertype */
+    pkt->type = gnrc_nettype_from_ethertype(byteorder_ntohs(hdr->type));
 
-        /* create netif header */
-        gnrc_pktsnip_t *netif_hdr;
-        netif_hdr = gnrc_pktbuf_add(NULL, NULL,
-                                    sizeof(gnrc_netif_hdr_t) + (2 * ETHERNET_ADDR_LEN),
-                                    GNRC_NETTYPE_NETIF);
+    /* create netif header */
+    gnrc_pktsnip_t *netif_hdr;
+    netif_hdr = gnrc_pktbuf_add(NULL, NULL,
+                                sizeof(gnrc_netif_hdr_t) + (2 * ETHERNET_ADDR_LEN),
+                                GNRC_NETTYPE_NETIF);
 
-        if (netif_hdr == NULL) {
-            DEBUG("gnrc_netif_ethernet: no space left in packet buffer\n");
-            pkt = eth_hdr;
-            goto safe_out;
-        }
-
-        gnrc_netif_hdr_init(netif_hdr->data, ETHERNET_ADDR_LEN, ETHERNET_ADDR_LEN);
-        gnrc_netif_hdr_set_src_addr(netif_hdr->data, hdr->src, ETHERNET_ADDR_LEN);
-        gnrc_netif_hdr_set_dst_addr(netif_hdr->data, hdr->dst, ETHERNET_ADDR_LEN);
-        gnrc_netif_hdr_set_netif(netif_hdr->data, netif);
-        if (rx_info.flags & NETDEV_ETH_RX_INFO_FLAG_TIMESTAMP) {
-            gnrc_netif_hdr_set_timestamp(netif_hdr->data, rx_info.timestamp);
-        }
+    if (netif_hdr == NULL) {
+        DEBUG("gnrc_netif_ethernet: no space left in packet buffer\n");
+        pkt = eth_hdr;
+        goto safe_out;
+    }
 
-        gnrc_pktbuf_remove_snip(pkt, eth_hdr);
-        pkt = gnrc_pkt_append(pkt, netif_hdr);
+    gnrc_netif_hdr_init(netif_hdr->data, ETHERNET_ADDR_LEN, ETHERNET_ADDR_LEN);
+    gnrc_netif_hdr_set_src_addr(netif_hdr->data, hdr->src, ETHERNET_ADDR_LEN);
+    gnrc_netif_hdr_set_dst_addr(netif_hdr->data, hdr->dst, ETHERNET_ADDR_LEN);
+    gnrc_netif_hdr_set_netif(netif_hdr->data, netif);
+    if (rx_info.flags & NETDEV_ETH_RX_INFO_FLAG_TIMESTAMP) {
+        gnrc_netif_hdr_set_timestamp(netif_hdr->data, rx_info.timestamp);
     }
 
+    gnrc_pktbuf_remove_snip(pkt, eth_hdr);
+    pkt = gnrc_pkt_append(pkt, netif_hdr);
+
 out:
     return pkt;
 
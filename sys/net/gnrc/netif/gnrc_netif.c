@@ -41,6 +41,7 @@
 #include "fmt.h"
 #include "log.h"
 #include "sched.h"
+#include "trace.h"
 #if (CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US > 0U)
 #include "xtimer.h"
 #endif
@@ -55,6 +56,7 @@ static void _update_l2addr_from_dev(gnrc_netif_t *netif);
 static void _configure_netdev(netdev_t *dev);
 static void *_gnrc_netif_thread(void *args);
 static void _event_cb(netdev_t *dev, netdev_event_t event);
+static void _rx_bufs_release(gnrc_netif_t *netif);
 
 int gnrc_netif_create(gnrc_netif_t *netif, char *stack, int stacksize,
                       char priority, const char *name, netdev_t *netdev,
@@ -410,6 +412,7 @@ int gnrc_netif_set_from_netdev(gnrc_netif_t *netif,
                     break;
                 case NETOPT_STATE:
                     if (*((netopt_state_t *)opt->data) == NETOPT_STATE_RESET) {
+                        _rx_bufs_release(netif);
                         _configure_netdev(netif->dev);
                     }
                     break;
@@ -448,6 +451,66 @@ void gnrc_netif_release(gnrc_netif_t *netif)
     }
 }
 
+static void _rx_bufs_release(gnrc_netif_t *netif)
+{
+#if IS_USED(MODULE_GNRC_NETIF_RX_BUF)
+    /* the device does not know about the buffers anymore */
+    for (unsigned i = 0; i < GNRC_NETIF_RX_BUF_NUMOF; i++) {
+        if (netif->rx_bufs[i] != NULL) {
+            gnrc_pktbuf_release(netif->rx_bufs[i]);
+            netif->rx_bufs[i] = NULL;
+        }
+    }
+#else
+    (void)netif;
+#endif
+}
+
+#if IS_USED(MODULE_GNRC_NETIF_RX_BUF)
+int gnrc_netif_recv_buf(gnrc_netif_t *netif, gnrc_pktsnip_t **pkt,
+                        size_t *offset, size_t size, void *info)
+{
+    netdev_t *dev = netif->dev;
+    void *buf;
+    int res;
+
+    assert(dev->driver->rx_buf_push && dev->driver->recv_buf);
+    /* provide the buffer for the next frame before taking the current one,
+     * so the device can restart reception into it right away */
+    for (unsigned i = 0; i < GNRC_NETIF_RX_BUF_NUMOF; i++) {
+        gnrc_pktsnip_t *snip;
+
+        if (netif->rx_bufs[i] != NULL) {
+            continue;
+        }
+        snip = gnrc_pktbuf_add(NULL, NULL, size, GNRC_NETTYPE_UNDEF);
+        if (snip == NULL) {
+            DEBUG("gnrc_netif: unable to allocate receive buffer\n");
+            break;
+        }
+        if (dev->driver->rx_buf_push(dev, snip->data, size) < 0) {
+            gnrc_pktbuf_release(snip);
+            break;
+        }
+        netif->rx_bufs[i] = snip;
+    }
+    res = dev->driver->recv_buf(dev, &buf, offset, info);
+    if (res <= 0) {
+        return res;
+    }
+    for (unsigned i = 0; i < GNRC_NETIF_RX_BUF_NUMOF; i++) {
+        if ((netif->rx_bufs[i] != NULL) && (netif->rx_bufs[i]->data == buf)) {
+            *pkt = netif->rx_bufs[i];
+            netif->rx_bufs[i] = NULL;
+            return res;
+        }
+    }
+    /* device handed back a buffer that was not provided by this interface */
+    assert(false);
+    return -ENOBUFS;
+}
+#endif
+
 #if IS_USED(MODULE_GNRC_NETIF_IPV6)
 static int _addr_idx(const gnrc_netif_t *netif, const ipv6_addr_t *addr);
 static int _group_idx(const gnrc_netif_t *netif, const ipv6_addr_t *addr);
@@ -1514,6 +1577,8 @@ static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back)
     (void)push_back; /* only used with IS_USED(MODULE_GNRC_NETIF_PKTQ) */
     int res;
 
+    TRACE_POINT(TRACE_EVENT_NETIF_TX, netif->pid, gnrc_pkt_len(pkt));
+
 #if IS_USED(MODULE_GNRC_NETIF_PKTQ)
     /* send queued packets first to keep order */
     if (!push_back && !gnrc_netif_pktq_empty(netif)) {
@@ -1606,7 +1671,8 @@ static void *_gnrc_netif_thread(void *args)
     /* register the event callback with the device driver */
     dev->event_callback = _event_cb;
     dev->context = netif;
-    /* initialize low-level driver */
+    /* initialize low-level driver, which drops any receive buffers */
+    _rx_bufs_release(netif);
     res = dev->driver->init(dev);
     if (res < 0) {
         LOG_ERROR("gnrc_netif: netdev init failed: %d\n", res);
@@ -1745,6 +1811,10 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
         switch (event) {
             case NETDEV_EVENT_RX_COMPLETE:
                 pkt = netif->ops->recv(netif);
+                if (pkt) {
+                    TRACE_POINT(TRACE_EVENT_NETIF_RX, netif->pid,
+                                gnrc_pkt_len(pkt));
+                }
                 /* send packet previously queued within netif due to the lower
                  * layer being busy.
                  * Further packets will be sent on later TX_COMPLETE */
@@ -15,6 +15,7 @@
 
 #include "net/gnrc.h"
 #include "net/gnrc/netif/ieee802154.h"
+#include "net/gnrc/netif/internal.h"
 #include "net/netdev/ieee802154.h"
 
 #ifdef MODULE_GNRC_IPV6
@@ -90,148 +91,186 @@ static inline bool _already_received(gnrc_netif_t *netif,
 }
 #endif /* MODULE_GNRC_NETIF_DEDUP */
 
+static int _recv_copy(netdev_t *dev, gnrc_pktsnip_t **pkt,
+                      netdev_ieee802154_rx_info_t *rx_info)
+{
+    int bytes_expected = dev->driver->recv(dev, NULL, 0, NULL);
+    int nread;
+
+    if (bytes_expected < (int)IEEE802154_MIN_FRAME_LEN) {
+        if (bytes_expected > 0) {
+            DEBUG("_recv_ieee802154: received frame is too short\n");
+            dev->driver->recv(dev, NULL, bytes_expected, NULL);
+        }
+        return 0;
+    }
+    *pkt = gnrc_pktbuf_add(NULL, NULL, bytes_expected, GNRC_NETTYPE_UNDEF);
+    if (*pkt == NULL) {
+        DEBUG("_recv_ieee802154: cannot allocate pktsnip.\n");
+        /* Discard packet on netdev device */
+        dev->driver->recv(dev, NULL, bytes_expected, NULL);
+        return 0;
+    }
+    nread = dev->driver->recv(dev, (*pkt)->data, bytes_expected, rx_info);
+    if (nread <= 0) {
+        gnrc_pktbuf_release(*pkt);
+    }
+    return nread;
+}
+
 static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
 {
     netdev_t *dev = netif->dev;
     netdev_ieee802154_rx_info_t rx_info;
     gnrc_pktsnip_t *pkt = NULL;
-    int bytes_expected = dev->driver->recv(dev, NULL, 0, NULL);
+    /* offset of the frame in pkt, for frames received without copying */
+    size_t offset = 0;
+    int nread = -ENOBUFS;
 
-    if (bytes_expected >= (int)IEEE802154_MIN_FRAME_LEN) {
-        int nread;
-
-        pkt = gnrc_pktbuf_add(NULL, NULL, bytes_expected, GNRC_NETTYPE_UNDEF);
-        if (pkt == NULL) {
-            DEBUG("_recv_ieee802154: cannot allocate pktsnip.\n");
-            /* Discard packet on netdev device */
-            dev->driver->recv(dev, NULL, bytes_expected, NULL);
-            return NULL;
-        }
-        nread = dev->driver->recv(dev, pkt->data, bytes_expected, &rx_info);
-        if (nread <= 0) {
+    if (dev->driver->recv_buf != NULL) {
+        nread = gnrc_netif_recv_buf(netif, &pkt, &offset,
+                                    NETDEV_IEEE802154_RX_BUF_SIZE, &rx_info);
+        if ((nread > 0) && (nread < (int)IEEE802154_MIN_FRAME_LEN)) {
+            DEBUG("_recv_ieee802154: received frame is too short\n");
             gnrc_pktbuf_release(pkt);
             return NULL;
         }
+    }
+    if (nread == -ENOBUFS) {
+        nread = _recv_copy(dev, &pkt, &rx_info);
+    }
+    if (nread <= 0) {
+        return NULL;
+    }
 #ifdef MODULE_NETSTATS_L2
-        netif->stats.rx_count++;
-        netif->stats.rx_bytes += nread;
+    netif->stats.rx_count++;
+    netif->stats.rx_bytes += nread;
 #endif
 
-        if (netif->flags & GNRC_NETIF_FLAGS_RAWMODE) {
-            /* Raw mode, skip packet processing, but provide rx_info via
-             * GNRC_NETTYPE_NETIF */
-            gnrc_pktsnip_t *netif_snip = gnrc_netif_hdr_build(NULL, 0, NULL, 0);
-            if (netif_snip == NULL) {
+    if (netif->flags & GNRC_NETIF_FLAGS_RAWMODE) {
+        /* Raw mode, skip packet processing, but provide rx_info via
+         * GNRC_NETTYPE_NETIF */
+        gnrc_pktsnip_t *netif_snip;
+
+        if (offset > 0) {
+            gnrc_pktsnip_t *phy_hdr = gnrc_pktbuf_mark(pkt, offset,
+                                                       GNRC_NETTYPE_UNDEF);
+            if (phy_hdr == NULL) {
                 DEBUG("_recv_ieee802154: no space left in packet buffer\n");
                 gnrc_pktbuf_release(pkt);
                 return NULL;
             }
-            gnrc_netif_hdr_t *hdr = netif_snip->data;
-            hdr->lqi = rx_info.lqi;
-            hdr->rssi = rx_info.rssi;
-            gnrc_netif_hdr_set_netif(hdr, netif);
-            pkt = gnrc_pkt_append(pkt, netif_snip);
+            gnrc_pktbuf_remove_snip(pkt, phy_hdr);
         }
-        else {
-            /* Normal mode, try to parse the frame according to IEEE 802.15.4 */
-            gnrc_pktsnip_t *ieee802154_hdr, *netif_hdr;
-            gnrc_netif_hdr_t *hdr;
-            size_t mhr_len = ieee802154_get_frame_hdr_len(pkt->data);
-            uint8_t *mhr = pkt->data;
-            /* nread was checked for <= 0 before so we can safely cast it to
-             * unsigned */
-            if ((mhr_len == 0) || ((size_t)nread < mhr_len)) {
-                DEBUG("_recv_ieee802154: illegally formatted frame received\n");
-                gnrc_pktbuf_release(pkt);
-                return NULL;
-            }
-            netif_hdr = _make_netif_hdr(mhr);
-            if (netif_hdr == NULL) {
-                DEBUG("_recv_ieee802154: no space left in packet buffer\n");
-                gnrc_pktbuf_release(pkt);
-                return NULL;
-            }
-            hdr = netif_hdr->data;
+        netif_snip = gnrc_netif_hdr_build(NULL, 0, NULL, 0);
+        if (netif_snip == NULL) {
+            DEBUG("_recv_ieee802154: no space left in packet buffer\n");
+            gnrc_pktbuf_release(pkt);
+            return NULL;
+        }
+        gnrc_netif_hdr_t *hdr = netif_snip->data;
+        hdr->lqi = rx_info.lqi;
+        hdr->rssi = rx_info.rssi;
+        gnrc_netif_hdr_set_netif(hdr, netif);
+        pkt = gnrc_pkt_append(pkt, netif_snip);
+    }
+    else {
+        /* Normal mode, try to parse the frame according to IEEE 802.15.4 */
+        gnrc_pktsnip_t *ieee802154_hdr, *netif_hdr;
+        gnrc_netif_hdr_t *hdr;
+        uint8_t *mhr = (uint8_t *)pkt->data + offset;
+        size_t mhr_len = ieee802154_get_frame_hdr_len(mhr);
+        /* nread was checked for <= 0 before so we can safely cast it to
+         * unsigned */
+        if ((mhr_len == 0) || ((size_t)nread < mhr_len)) {
+            DEBUG("_recv_ieee802154: illegally formatted frame received\n");
+            gnrc_pktbuf_release(pkt);
+            return NULL;
+        }
+        netif_hdr = _make_netif_hdr(mhr);
+        if (netif_hdr == NULL) {
+            DEBUG("_recv_ieee802154: no space left in packet buffer\n");
+            gnrc_pktbuf_release(pkt);
+            return NULL;
+        }
+        hdr = netif_hdr->data;
 
 #ifdef MODULE_L2FILTER
-            if (!l2filter_pass(dev->filter, gnrc_netif_hdr_get_src_addr(hdr),
-                               hdr->src_l2addr_len)) {
-                gnrc_pktbuf_release(pkt);
-                gnrc_pktbuf_release(netif_hdr);
-                DEBUG("_recv_ieee802154: packet dropped by l2filter\n");
-                return NULL;
-            }
+        if (!l2filter_pass(dev->filter, gnrc_netif_hdr_get_src_addr(hdr),
+                           hdr->src_l2addr_len)) {
+            gnrc_pktbuf_release(pkt);
+            gnrc_pktbuf_release(netif_hdr);
+            DEBUG("_recv_ieee802154: packet dropped by l2filter\n");
+            return NULL;
+        }
 #endif
 #ifdef MODULE_GNRC_NETIF_DEDUP
-            if (_already_received(netif, hdr, mhr)) {
-                gnrc_pktbuf_release(pkt);
-                gnrc_pktbuf_release(netif_hdr);
-                DEBUG("_recv_ieee802154: packet dropped by deduplication\n");
-                return NULL;
-            }
-            memcpy(netif->last_pkt.src, gnrc_netif_hdr_get_src_addr(hdr),
-                   hdr->src_l2addr_len);
-            netif->last_pkt.src_len = hdr->src_l2addr_len;
-            netif->last_pkt.seq = ieee802154_get_seq(mhr);
+        if (_already_received(netif, hdr, mhr)) {
+            gnrc_pktbuf_release(pkt);
+            gnrc_pktbuf_release(netif_hdr);
+            DEBUG("_recv_ieee802154: packet dropped by deduplication\n");
+            return NULL;
+        }
+        memcpy(netif->last_pkt.src, gnrc_netif_hdr_get_src_addr(hdr),
+               hdr->src_l2addr_len);
+        netif->last_pkt.src_len = hdr->src_l2addr_len;
+        netif->last_pkt.seq = ieee802154_get_seq(mhr);
 #endif /* MODULE_GNRC_NETIF_DEDUP */
 #if IS_USED(MODULE_IEEE802154_SECURITY)
-            {
-                uint8_t *payload = NULL;
-                uint16_t payload_size = 0;
-                uint8_t *mic = NULL;
-                uint8_t mic_size = 0;
-                if (mhr[0] & NETDEV_IEEE802154_SECURITY_EN) {
-                    if (ieee802154_sec_decrypt_frame(&((netdev_ieee802154_t *)dev)->sec_ctx,
-                                                     nread,
-                                                     mhr, (uint8_t *)&mhr_len,
-                                                     &payload, &payload_size,
-                                                     &mic, &mic_size,
-                                                     gnrc_netif_hdr_get_src_addr(hdr)) != 0) {
-                        DEBUG("_recv_ieee802154: packet dropped by security check\n");
-                        gnrc_pktbuf_release(pkt);
-                        gnrc_pktbuf_release(netif_hdr);
-                        return NULL;
-                    }
+        {
+            uint8_t *payload = NULL;
+            uint16_t payload_size = 0;
+            uint8_t *mic = NULL;
+            uint8_t mic_size = 0;
+            if (mhr[0] & NETDEV_IEEE802154_SECURITY_EN) {
+                if (ieee802154_sec_decrypt_frame(&((netdev_ieee802154_t *)dev)->sec_ctx,
+                                                 nread,
+                                                 mhr, (uint8_t *)&mhr_len,
+                                                 &payload, &payload_size,
+                                                 &mic, &mic_size,
+                                                 gnrc_netif_hdr_get_src_addr(hdr)) != 0) {
+                    DEBUG("_recv_ieee802154: packet dropped by security check\n");
+                    gnrc_pktbuf_release(pkt);
+                    gnrc_pktbuf_release(netif_hdr);
+                    return NULL;
                 }
-                nread -= mic_size;
             }
+            nread -= mic_size;
+        }
 #endif
-            hdr->lqi = rx_info.lqi;
-            hdr->rssi = rx_info.rssi;
-            gnrc_netif_hdr_set_netif(hdr, netif);
-            dev->driver->get(dev, NETOPT_PROTO, &pkt->type, sizeof(pkt->type));
-            if (IS_ACTIVE(ENABLE_DEBUG)) {
-                char src_str[GNRC_NETIF_HDR_L2ADDR_PRINT_LEN];
+        hdr->lqi = rx_info.lqi;
+        hdr->rssi = rx_info.rssi;
+        gnrc_netif_hdr_set_netif(hdr, netif);
+        dev->driver->get(dev, NETOPT_PROTO, &pkt->type, sizeof(pkt->type));
+        if (IS_ACTIVE(ENABLE_DEBUG)) {
+            char src_str[GNRC_NETIF_HDR_L2ADDR_PRINT_LEN];
 
-                DEBUG("_recv_ieee802154: received packet from %s of length %u\n",
-                    gnrc_netif_addr_to_str(gnrc_netif_hdr_get_src_addr(hdr),
-                                            hdr->src_l2addr_len,
-                                            src_str),
-                    nread);
-                if (IS_USED(MODULE_OD)) {
-                    od_hex_dump(pkt->data, nread, OD_WIDTH_DEFAULT);
-                }
-            }
-            /* mark IEEE 802.15.4 header */
-            ieee802154_hdr = gnrc_pktbuf_mark(pkt, mhr_len, GNRC_NETTYPE_UNDEF);
-            if (ieee802154_hdr == NULL) {
-                DEBUG("_recv_ieee802154: no space left in packet buffer\n");
-                gnrc_pktbuf_release(pkt);
-                gnrc_pktbuf_release(netif_hdr);
-                return NULL;
+            DEBUG("_recv_ieee802154: received packet from %s of length %u\n",
+                gnrc_netif_addr_to_str(gnrc_netif_hdr_get_src_addr(hdr),
+                                        hdr->src_l2addr_len,
+                                        src_str),
+                nread);
+            if (IS_USED(MODULE_OD)) {
+                od_hex_dump(mhr, nread, OD_WIDTH_DEFAULT);
             }
-            nread -= ieee802154_hdr->size;
-            gnrc_pktbuf_remove_snip(pkt, ieee802154_hdr);
-            pkt = gnrc_pkt_append(pkt, netif_hdr);
         }
-
-        DEBUG("_recv_ieee802154: reallocating MAC payload for upper layer.\n");
-        gnrc_pktbuf_realloc_data(pkt, nread);
-    } else if (bytes_expected > 0) {
-        DEBUG("_recv_ieee802154: received frame is too short\n");
-        dev->driver->recv(dev, NULL, bytes_expected, NULL);
+        /* mark IEEE 802.15.4 header, along with anything in front of it */
+        ieee802154_hdr = gnrc_pktbuf_mark(pkt, offset + mhr_len,
+                                          GNRC_NETTYPE_UNDEF);
+        if (ieee802154_hdr == NULL) {
+            DEBUG("_recv_ieee802154: no space left in packet buffer\n");
+            gnrc_pktbuf_release(pkt);
+            gnrc_pktbuf_release(netif_hdr);
+            return NULL;
+        }
+        nread -= mhr_len;
+        gnrc_pktbuf_remove_snip(pkt, ieee802154_hdr);
+        pkt = gnrc_pkt_append(pkt, netif_hdr);
     }
 
+    DEBUG("_recv_ieee802154: reallocating MAC payload for upper layer.\n");
+    gnrc_pktbuf_realloc_data(pkt, nread);
+
     return pkt;
 }
 
@@ -57,6 +57,13 @@ static char _stack[GNRC_IPV6_STACK_SIZE + DEBUG_EXTRA_STACKSIZE];
  */
 static fib_entry_t _fib_entries[GNRC_IPV6_FIB_TABLE_SIZE];
 
+#ifdef MODULE_FIB_TRIE
+/**
+ * @brief buffer to store the trie nodes indexing the IPv6 forwarding table
+ */
+static fib_trie_node_t _fib_trie_nodes[FIB_TRIE_NODES_NUMOF(GNRC_IPV6_FIB_TABLE_SIZE)];
+#endif
+
 /**
  * @brief the IPv6 forwarding table
  */
@@ -92,6 +99,9 @@ kernel_pid_t gnrc_ipv6_init(void)
     gnrc_ipv6_fib_table.data.entries = _fib_entries;
     gnrc_ipv6_fib_table.table_type = FIB_TABLE_TYPE_SH;
     gnrc_ipv6_fib_table.size = GNRC_IPV6_FIB_TABLE_SIZE;
+#ifdef MODULE_FIB_TRIE
+    gnrc_ipv6_fib_table.trie_nodes = _fib_trie_nodes;
+#endif
     fib_init(&gnrc_ipv6_fib_table);
 #endif
 
@@ -170,9 +180,68 @@ static void _dispatch_next_header(gnrc_pktsnip_t *pkt, unsigned nh,
     }
 }
 
+static void _handle_msg(msg_t *msg)
+{
+    msg_t reply = { .type = GNRC_NETAPI_MSG_TYPE_ACK };
+
+    switch (msg->type) {
+        case GNRC_NETAPI_MSG_TYPE_RCV:
+            DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_RCV received\n");
+            _receive(msg->content.ptr);
+            break;
+
+        case GNRC_NETAPI_MSG_TYPE_SND:
+            DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_SND received\n");
+            _send(msg->content.ptr, true);
+            break;
+
+        case GNRC_NETAPI_MSG_TYPE_GET:
+        case GNRC_NETAPI_MSG_TYPE_SET:
+            DEBUG("ipv6: reply to unsupported get/set\n");
+            reply.content.value = -ENOTSUP;
+            msg_reply(msg, &reply);
+            break;
+
+#ifdef MODULE_GNRC_IPV6_EXT_FRAG
+        case GNRC_IPV6_EXT_FRAG_RBUF_GC:
+            gnrc_ipv6_ext_frag_rbuf_gc();
+            break;
+        case GNRC_IPV6_EXT_FRAG_CONTINUE:
+            DEBUG("ipv6: continue fragmenting packet\n");
+            gnrc_ipv6_ext_frag_send(msg->content.ptr);
+            break;
+        case GNRC_IPV6_EXT_FRAG_SEND:
+            DEBUG("ipv6: send fragment\n");
+            _send_by_netif_hdr(msg->content.ptr);
+            break;
+#endif  /* MODULE_GNRC_IPV6_EXT_FRAG */
+        case GNRC_IPV6_NIB_SND_UC_NS:
+        case GNRC_IPV6_NIB_SND_MC_NS:
+        case GNRC_IPV6_NIB_SND_NA:
+        case GNRC_IPV6_NIB_SEARCH_RTR:
+        case GNRC_IPV6_NIB_REPLY_RS:
+        case GNRC_IPV6_NIB_SND_MC_RA:
+        case GNRC_IPV6_NIB_REACH_TIMEOUT:
+        case GNRC_IPV6_NIB_DELAY_TIMEOUT:
+        case GNRC_IPV6_NIB_ADDR_REG_TIMEOUT:
+        case GNRC_IPV6_NIB_ABR_TIMEOUT:
+        case GNRC_IPV6_NIB_PFX_TIMEOUT:
+        case GNRC_IPV6_NIB_RTR_TIMEOUT:
+        case GNRC_IPV6_NIB_RECALC_REACH_TIME:
+        case GNRC_IPV6_NIB_REREG_ADDRESS:
+        case GNRC_IPV6_NIB_DAD:
+        case GNRC_IPV6_NIB_VALID_ADDR:
+            DEBUG("ipv6: NIB timer event received\n");
+            gnrc_ipv6_nib_handle_timer_event(msg->content.ptr, msg->type);
+            break;
+        default:
+            break;
+    }
+}
+
 static void *_event_loop(void *args)
 {
-    msg_t msg, reply, msg_q[GNRC_IPV6_MSG_QUEUE_SIZE];
+    msg_t msgs[CONFIG_GNRC_IPV6_MSG_BATCH_SIZE], msg_q[GNRC_IPV6_MSG_QUEUE_SIZE];
     gnrc_netreg_entry_t me_reg = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
                                                             thread_getpid());
 
@@ -186,66 +255,13 @@ static void *_event_loop(void *args)
     /* register interest in all IPv6 packets */
     gnrc_netreg_register(GNRC_NETTYPE_IPV6, &me_reg);
 
-    /* preinitialize ACK */
-    reply.type = GNRC_NETAPI_MSG_TYPE_ACK;
-
     /* start event loop */
     while (1) {
         DEBUG("ipv6: waiting for incoming message.\n");
-        msg_receive(&msg);
-
-        switch (msg.type) {
-            case GNRC_NETAPI_MSG_TYPE_RCV:
-                DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_RCV received\n");
-                _receive(msg.content.ptr);
-                break;
-
-            case GNRC_NETAPI_MSG_TYPE_SND:
-                DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_SND received\n");
-                _send(msg.content.ptr, true);
-                break;
-
-            case GNRC_NETAPI_MSG_TYPE_GET:
-            case GNRC_NETAPI_MSG_TYPE_SET:
-                DEBUG("ipv6: reply to unsupported get/set\n");
-                reply.content.value = -ENOTSUP;
-                msg_reply(&msg, &reply);
-                break;
+        unsigned num = msg_receive_many(msgs, ARRAY_SIZE(msgs));
 
-#ifdef MODULE_GNRC_IPV6_EXT_FRAG
-            case GNRC_IPV6_EXT_FRAG_RBUF_GC:
-                gnrc_ipv6_ext_frag_rbuf_gc();
-                break;
-            case GNRC_IPV6_EXT_FRAG_CONTINUE:
-                DEBUG("ipv6: continue fragmenting packet\n");
-                gnrc_ipv6_ext_frag_send(msg.content.ptr);
-                break;
-            case GNRC_IPV6_EXT_FRAG_SEND:
-                DEBUG("ipv6: send fragment\n");
-                _send_by_netif_hdr(msg.content.ptr);
-                break;
-#endif  /* MODULE_GNRC_IPV6_EXT_FRAG */
-            case GNRC_IPV6_NIB_SND_UC_NS:
-            case GNRC_IPV6_NIB_SND_MC_NS:
-            case GNRC_IPV6_NIB_SND_NA:
-            case GNRC_IPV6_NIB_SEARCH_RTR:
-            case GNRC_IPV6_NIB_REPLY_RS:
-            case GNRC_IPV6_NIB_SND_MC_RA:
-            case GNRC_IPV6_NIB_REACH_TIMEOUT:
-            case GNRC_IPV6_NIB_DELAY_TIMEOUT:
-            case GNRC_IPV6_NIB_ADDR_REG_TIMEOUT:
-            case GNRC_IPV6_NIB_ABR_TIMEOUT:
-            case GNRC_IPV6_NIB_PFX_TIMEOUT:
-            case GNRC_IPV6_NIB_RTR_TIMEOUT:
-            case GNRC_IPV6_NIB_RECALC_REACH_TIME:
-            case GNRC_IPV6_NIB_REREG_ADDRESS:
-            case GNRC_IPV6_NIB_DAD:
-            case GNRC_IPV6_NIB_VALID_ADDR:
-                DEBUG("ipv6: NIB timer event received\n");
-                gnrc_ipv6_nib_handle_timer_event(msg.content.ptr, msg.type);
-                break;
-            default:
-                break;
+        for (unsigned i = 0; i < num; i++) {
+            _handle_msg(&msgs[i]);
         }
     }
 
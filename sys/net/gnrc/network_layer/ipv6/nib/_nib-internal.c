@@ -46,6 +46,20 @@ static _nib_abr_entry_t _abrs[CONFIG_GNRC_IPV6_NIB_ABR_NUMOF];
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
 static rmutex_t _nib_mutex = RMUTEX_INIT;
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_HASH_INDEX)
+/* Open addressing hash indexes (linear probing) over _nodes and _dsts. A slot
+ * holds the array index of an entry + 1, 0 marks a free slot. Every entry is
+ * at most once in an index, so with twice as many slots as entries there are
+ * always free slots to terminate the probing. */
+#define _NODES_IDX_NUMOF    (2 * CONFIG_GNRC_IPV6_NIB_NUMOF)
+#define _DSTS_IDX_NUMOF     (2 * CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF)
+
+static uint16_t _nodes_idx[_NODES_IDX_NUMOF];
+static uint16_t _dsts_idx[_DSTS_IDX_NUMOF];
+/* prefix lengths used in _dsts, longest prefix match probes only those */
+static BITFIELD(_dsts_pfx_lens, IPV6_ADDR_BIT_LEN + 1);
+#endif  /* CONFIG_GNRC_IPV6_NIB_HASH_INDEX */
+
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 
 evtimer_msg_t _nib_evtimer;
@@ -54,6 +68,102 @@ static void _override_node(const ipv6_addr_t *addr, unsigned iface,
                            _nib_onl_entry_t *node);
 static inline bool _node_unreachable(_nib_onl_entry_t *node);
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_HASH_INDEX)
+static unsigned _idx_hash(const ipv6_addr_t *addr, unsigned numof)
+{
+    uint32_t hash = 0;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(addr->u32); i++) {
+        hash = (hash ^ addr->u32[i].u32) * 0x9e3779b1;
+    }
+    /* addresses often only differ in their last bytes, so mix those into
+     * the lower bits as well */
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6b;
+    hash ^= hash >> 13;
+    return hash % numof;
+}
+
+static const ipv6_addr_t *_nodes_key(unsigned pos)
+{
+    return &_nodes[pos].ipv6;
+}
+
+static const ipv6_addr_t *_dsts_key(unsigned pos)
+{
+    return &_dsts[pos].pfx;
+}
+
+static void _idx_add(uint16_t *idx, unsigned numof, const ipv6_addr_t *key,
+                     unsigned pos)
+{
+    unsigned i = _idx_hash(key, numof);
+
+    while (idx[i] != 0) {
+        if (idx[i] == (pos + 1)) {
+            return;
+        }
+        i = (i + 1) % numof;
+    }
+    idx[i] = pos + 1;
+}
+
+static void _idx_del(uint16_t *idx, unsigned numof,
+                     const ipv6_addr_t *(*key)(unsigned), unsigned pos)
+{
+    unsigned i = _idx_hash(key(pos), numof);
+
+    while (idx[i] != (pos + 1)) {
+        if (idx[i] == 0) {
+            /* not indexed */
+            return;
+        }
+        i = (i + 1) % numof;
+    }
+    idx[i] = 0;
+    /* move up following slots that would not be found anymore otherwise */
+    for (unsigned j = (i + 1) % numof; idx[j] != 0; j = (j + 1) % numof) {
+        unsigned home = _idx_hash(key(idx[j] - 1), numof);
+
+        if ((i < j) ? ((home <= i) || (home > j))
+                    : ((home <= i) && (home > j))) {
+            idx[i] = idx[j];
+            idx[j] = 0;
+            i = j;
+        }
+    }
+}
+
+static void _nib_onl_idx_add(const _nib_onl_entry_t *node)
+{
+    _idx_add(_nodes_idx, _NODES_IDX_NUMOF, &node->ipv6, node - _nodes);
+}
+
+void _nib_onl_idx_del(const _nib_onl_entry_t *node)
+{
+    _idx_del(_nodes_idx, _NODES_IDX_NUMOF, _nodes_key, node - _nodes);
+}
+
+static void _nib_offl_idx_add(const _nib_offl_entry_t *dst)
+{
+    _idx_add(_dsts_idx, _DSTS_IDX_NUMOF, &dst->pfx, dst - _dsts);
+    bf_set(_dsts_pfx_lens, dst->pfx_len);
+}
+
+static void _nib_offl_idx_del(const _nib_offl_entry_t *dst)
+{
+    _idx_del(_dsts_idx, _DSTS_IDX_NUMOF, _dsts_key, dst - _dsts);
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF; i++) {
+        if ((&_dsts[i] != dst) && (_dsts[i].next_hop != NULL) &&
+            (_dsts[i].pfx_len == dst->pfx_len)) {
+            /* prefix length still in use */
+            return;
+        }
+    }
+    bf_unset(_dsts_pfx_lens, dst->pfx_len);
+}
+#endif  /* CONFIG_GNRC_IPV6_NIB_HASH_INDEX */
+
 void _nib_init(void)
 {
 #ifdef TEST_SUITES
@@ -65,6 +175,11 @@ void _nib_init(void)
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C)
     memset(_abrs, 0, sizeof(_abrs));
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_HASH_INDEX)
+    memset(_nodes_idx, 0, sizeof(_nodes_idx));
+    memset(_dsts_idx, 0, sizeof(_dsts_idx));
+    memset(_dsts_pfx_lens, 0, sizeof(_dsts_pfx_lens));
+#endif  /* CONFIG_GNRC_IPV6_NIB_HASH_INDEX */
 #endif  /* TEST_SUITES */
     evtimer_init_msg(&_nib_evtimer);
     /* TODO: load ABR information from persistent memory */
@@ -214,24 +329,48 @@ _nib_onl_entry_t *_nib_onl_iter(const _nib_onl_entry_t *last)
     return NULL;
 }
 
+static inline bool _onl_matches(const _nib_onl_entry_t *node,
+                                const ipv6_addr_t *addr, unsigned iface)
+{
+    return (node->mode != _EMPTY) &&
+           /* either requested or current interface undefined or
+            * interfaces equal */
+           ((_nib_onl_get_if(node) == 0) || (iface == 0) ||
+            (_nib_onl_get_if(node) == iface)) &&
+           ipv6_addr_equal(&node->ipv6, addr);
+}
+
 _nib_onl_entry_t *_nib_onl_get(const ipv6_addr_t *addr, unsigned iface)
 {
     assert(addr != NULL);
     DEBUG("nib: Getting on-link node entry (addr = %s, iface = %u)\n",
           ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)), iface);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_HASH_INDEX)
+    _nib_onl_entry_t *res = NULL;
+
+    for (unsigned i = _idx_hash(addr, _NODES_IDX_NUMOF); _nodes_idx[i] != 0;
+         i = (i + 1) % _NODES_IDX_NUMOF) {
+        _nib_onl_entry_t *node = &_nodes[_nodes_idx[i] - 1];
+
+        /* the first match in _nodes wins, as with the linear search */
+        if (_onl_matches(node, addr, iface) && ((res == NULL) || (node < res))) {
+            res = node;
+        }
+    }
+    if (res != NULL) {
+        DEBUG("  Found %p\n", (void *)res);
+        return res;
+    }
+#else   /* CONFIG_GNRC_IPV6_NIB_HASH_INDEX */
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *node = &_nodes[i];
 
-        if ((node->mode != _EMPTY) &&
-            /* either requested or current interface undefined or
-             * interfaces equal */
-            ((_nib_onl_get_if(node) == 0) || (iface == 0) ||
-             (_nib_onl_get_if(node) == iface)) &&
-            ipv6_addr_equal(&node->ipv6, addr)) {
+        if (_onl_matches(node, addr, iface)) {
             DEBUG("  Found %p\n", (void *)node);
             return node;
         }
     }
+#endif  /* CONFIG_GNRC_IPV6_NIB_HASH_INDEX */
     DEBUG("  No suitable entry found\n");
     return NULL;
 }
@@ -493,7 +632,13 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
             /* exact match (or next hop address was previously unset) */
             DEBUG("  %p is an exact match\n", (void *)tmp);
             if (next_hop != NULL) {
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_HASH_INDEX)
+                _nib_onl_idx_del(tmp_node);
+#endif  /* CONFIG_GNRC_IPV6_NIB_HASH_INDEX */
                 memcpy(&tmp_node->ipv6, next_hop, sizeof(tmp_node->ipv6));
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_HASH_INDEX)
+                _nib_onl_idx_add(tmp_node);
+#endif  /* CONFIG_GNRC_IPV6_NIB_HASH_INDEX */
             }
             tmp->next_hop->mode |= _DST;
             return tmp;
@@ -514,6 +659,9 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
         dst->next_hop->mode |= _DST;
         ipv6_addr_init_prefix(&dst->pfx, pfx, pfx_len);
         dst->pfx_len = pfx_len;
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_HASH_INDEX)
+        _nib_offl_idx_add(dst);
+#endif  /* CONFIG_GNRC_IPV6_NIB_HASH_INDEX */
     }
     return dst;
 }
@@ -550,6 +698,9 @@ void _nib_offl_clear(_nib_offl_entry_t *dst)
             dst->next_hop->mode &= ~(_DST);
             _nib_onl_clear(dst->next_hop);
         }
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_HASH_INDEX)
+        _nib_offl_idx_del(dst);
+#endif  /* CONFIG_GNRC_IPV6_NIB_HASH_INDEX */
         memset(dst, 0, sizeof(_nib_offl_entry_t));
     }
 }
@@ -580,6 +731,32 @@ static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
 
     DEBUG("nib: get match for destination %s from NIB\n",
           ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_HASH_INDEX)
+    /* Entries are stored with all bits beyond their prefix length cleared,
+     * so the longest matching prefix is an entry equal to dst cut to the
+     * longest prefix length that has such an entry. As with the linear
+     * search below, ties are broken by the position in _dsts. */
+    (void)best_match;
+    for (int len = IPV6_ADDR_BIT_LEN; (len >= 0) && (res == NULL); len--) {
+        ipv6_addr_t pfx = IPV6_ADDR_UNSPECIFIED;
+
+        if (!bf_isset(_dsts_pfx_lens, len)) {
+            continue;
+        }
+        ipv6_addr_init_prefix(&pfx, dst, len);
+        for (unsigned i = _idx_hash(&pfx, _DSTS_IDX_NUMOF); _dsts_idx[i] != 0;
+             i = (i + 1) % _DSTS_IDX_NUMOF) {
+            _nib_offl_entry_t *entry = &_dsts[_dsts_idx[i] - 1];
+
+            if ((entry->mode != _EMPTY) && (entry->pfx_len == len) &&
+                ipv6_addr_equal(&entry->pfx, &pfx) &&
+                ((res == NULL) || (entry < res))) {
+                res = entry;
+            }
+        }
+    }
+    DEBUG("nib: best match %p\n", (void *)res);
+#else   /* CONFIG_GNRC_IPV6_NIB_HASH_INDEX */
     for (_nib_offl_entry_t *entry = _dsts; _in_dsts(entry); entry++) {
         if (entry->mode != _EMPTY) {
             uint8_t match = ipv6_addr_match_prefix(&entry->pfx, dst);
@@ -592,13 +769,16 @@ static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
                   ipv6_addr_to_str(addr_str, &entry->next_hop->ipv6,
                                    sizeof(addr_str)),
                   _nib_onl_get_if(entry->next_hop), match);
-            if ((match > best_match) && (match >= entry->pfx_len)) {
-                DEBUG("nib: best match (%u bits)\n", match);
+            /* longest prefix wins, the first one of equal length */
+            if ((match >= entry->pfx_len) &&
+                ((res == NULL) || (entry->pfx_len > best_match))) {
+                DEBUG("nib: best match (/%u)\n", entry->pfx_len);
                 res = entry;
-                best_match = match;
+                best_match = entry->pfx_len;
             }
         }
     }
+#endif  /* CONFIG_GNRC_IPV6_NIB_HASH_INDEX */
     return res;
 }
 
@@ -824,11 +1004,17 @@ _nib_offl_entry_t *_nib_pl_add(unsigned iface,
 static void _override_node(const ipv6_addr_t *addr, unsigned iface,
                            _nib_onl_entry_t *node)
 {
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_HASH_INDEX)
+    _nib_onl_idx_del(node);
+#endif  /* CONFIG_GNRC_IPV6_NIB_HASH_INDEX */
     _nib_onl_clear(node);
     if (addr != NULL) {
         memcpy(&node->ipv6, addr, sizeof(node->ipv6));
     }
     _nib_onl_set_if(node, iface);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_HASH_INDEX)
+    _nib_onl_idx_add(node);
+#endif  /* CONFIG_GNRC_IPV6_NIB_HASH_INDEX */
 }
 
 static inline bool _node_unreachable(_nib_onl_entry_t *node)
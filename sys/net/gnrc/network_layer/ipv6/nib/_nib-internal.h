@@ -311,6 +311,17 @@ static inline void _nib_onl_set_if(_nib_onl_entry_t *node, unsigned iface)
  */
 _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_HASH_INDEX) || defined(DOXYGEN)
+/**
+ * @brief   Removes an on-link entry from the hash index
+ *
+ * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_HASH_INDEX.
+ *
+ * @param[in] node  An entry.
+ */
+void _nib_onl_idx_del(const _nib_onl_entry_t *node);
+#endif  /* CONFIG_GNRC_IPV6_NIB_HASH_INDEX */
+
 /**
  * @brief   Clears out a NIB entry (on-link version)
  *
@@ -322,6 +333,9 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
 static inline bool _nib_onl_clear(_nib_onl_entry_t *node)
 {
     if (node->mode == _EMPTY) {
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_HASH_INDEX)
+        _nib_onl_idx_del(node);
+#endif  /* CONFIG_GNRC_IPV6_NIB_HASH_INDEX */
         memset(node, 0, sizeof(_nib_onl_entry_t));
         return true;
     }
@@ -27,6 +27,8 @@
 #include <stdlib.h>
 
 #include "mutex.h"
+#include "net/gnrc/pkt.h"
+#include "net/gnrc/pktbuf.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -50,6 +52,47 @@ extern mutex_t gnrc_pktbuf_mutex;
 extern uint8_t *gnrc_pktbuf_static_buf;
 #endif
 
+#if IS_USED(MODULE_GNRC_PKTBUF_SLAB) || DOXYGEN
+/**
+ * @brief   Rounds @p size up to the block alignment of gnrc_pktbuf_slab
+ */
+#define GNRC_PKTBUF_SLAB_ALIGN(size)    (((size) + sizeof(uintptr_t) - 1) & \
+                                         ~(sizeof(uintptr_t) - 1))
+
+/**
+ * @brief   Block size of the packet snip size class
+ */
+#define GNRC_PKTBUF_SLAB_SNIP_SIZE      GNRC_PKTBUF_SLAB_ALIGN(sizeof(gnrc_pktsnip_t))
+
+/**
+ * @brief   Block size of the small size class
+ */
+#define GNRC_PKTBUF_SLAB_SMALL_SIZE     GNRC_PKTBUF_SLAB_ALIGN(CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE)
+
+/**
+ * @brief   Block size of the large size class
+ */
+#define GNRC_PKTBUF_SLAB_LARGE_SIZE     GNRC_PKTBUF_SLAB_ALIGN(CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE)
+
+/**
+ * @brief   Size of the memory backing all size classes of gnrc_pktbuf_slab
+ */
+#define GNRC_PKTBUF_SLAB_BUF_SIZE       ((GNRC_PKTBUF_SLAB_SNIP_SIZE * \
+                                          CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF) + \
+                                         (GNRC_PKTBUF_SLAB_SMALL_SIZE * \
+                                          CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF) + \
+                                         (GNRC_PKTBUF_SLAB_LARGE_SIZE * \
+                                          CONFIG_GNRC_PKTBUF_SLAB_LARGE_NUMOF))
+
+/**
+ * @brief   The memory backing all size classes when module gnrc_pktbuf_slab
+ *          is used
+ *
+ * @warning This is an internal buffer and should not be touched by external code
+ */
+extern uint8_t *gnrc_pktbuf_slab_buf;
+#endif
+
 /**
  * @brief   Check if the given pointer is indeed part of the packet buffer
  *
@@ -65,13 +108,15 @@ static inline bool gnrc_pktbuf_contains(void *ptr)
 {
 #if IS_USED(MODULE_GNRC_PKTBUF_STATIC)
     return (unsigned)((uint8_t *)ptr - gnrc_pktbuf_static_buf) < CONFIG_GNRC_PKTBUF_SIZE;
+#elif IS_USED(MODULE_GNRC_PKTBUF_SLAB)
+    return (unsigned)((uint8_t *)ptr - gnrc_pktbuf_slab_buf) < GNRC_PKTBUF_SLAB_BUF_SIZE;
 #else
     (void)ptr;
     return true;
 #endif
 }
 
-#if IS_USED(MODULE_GNRC_PKTBUF_STATIC) || DOXYGEN
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC) || IS_USED(MODULE_GNRC_PKTBUF_SLAB) || DOXYGEN
 /**
  * @brief   Release an internal buffer
  *
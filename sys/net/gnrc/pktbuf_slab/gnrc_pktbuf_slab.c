@@ -0,0 +1,520 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_pktbuf
+ * @{
+ *
+ * @file
+ * @brief   Packet buffer implementation using fixed size classes
+ *
+ * Every allocation is served from a free list of equally sized blocks, so
+ * allocating and freeing takes constant time and the buffer can not
+ * fragment. Packet snip descriptors, small data (headers) and large data
+ * (frames up to the MTU) each have their own size class; data falls back
+ * to the large class when the small one is exhausted.
+ *
+ * @ref gnrc_pktbuf_mark() does not copy: the marked snip and the remaining
+ * payload share the block, which keeps a reference count and is freed once
+ * the last part of it is released.
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "mutex.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/nettype.h"
+#include "net/gnrc/pkt.h"
+
+#include "pktbuf_internal.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define _SNIP_BUF_SIZE      (GNRC_PKTBUF_SLAB_SNIP_SIZE * \
+                             CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF)
+#define _SMALL_BUF_SIZE     (GNRC_PKTBUF_SLAB_SMALL_SIZE * \
+                             CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF)
+#define _SMALL_FIRST        (CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF)
+#define _LARGE_FIRST        (_SMALL_FIRST + CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF)
+#define _BLOCKS_NUMOF       (_LARGE_FIRST + CONFIG_GNRC_PKTBUF_SLAB_LARGE_NUMOF)
+
+#define _REFS_MAX           (UINT8_MAX)
+
+typedef struct _free {
+    struct _free *next;
+} _free_t;
+
+typedef struct {
+    _free_t *free;          /**< first free block */
+    uint16_t used;          /**< number of blocks in use */
+    uint16_t max_used;      /**< high-water mark of _slab_t::used */
+} _slab_t;
+
+/* The blocks are laid out by size class: snips, small, large. The buffer
+ * needs to be aligned to word size, so that each block can be casted to
+ * `_free_t *` and `gnrc_pktsnip_t *` safely */
+static uintptr_t _pktbuf_buf[GNRC_PKTBUF_SLAB_BUF_SIZE / sizeof(uintptr_t)];
+uint8_t *gnrc_pktbuf_slab_buf = (uint8_t *)_pktbuf_buf;
+
+static _slab_t _slabs[GNRC_PKTBUF_SLAB_NUMOF];
+/* number of parts of a packet referring to each block */
+static uint8_t _refs[_BLOCKS_NUMOF];
+
+/* internal gnrc_pktbuf functions */
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type);
+
+static inline size_t _block_size(gnrc_pktbuf_slab_class_t cls)
+{
+    switch (cls) {
+    case GNRC_PKTBUF_SLAB_SNIP:
+        return GNRC_PKTBUF_SLAB_SNIP_SIZE;
+    case GNRC_PKTBUF_SLAB_SMALL:
+        return GNRC_PKTBUF_SLAB_SMALL_SIZE;
+    default:
+        return GNRC_PKTBUF_SLAB_LARGE_SIZE;
+    }
+}
+
+static inline unsigned _blocks_numof(gnrc_pktbuf_slab_class_t cls)
+{
+    switch (cls) {
+    case GNRC_PKTBUF_SLAB_SNIP:
+        return CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF;
+    case GNRC_PKTBUF_SLAB_SMALL:
+        return CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF;
+    default:
+        return CONFIG_GNRC_PKTBUF_SLAB_LARGE_NUMOF;
+    }
+}
+
+static inline unsigned _first_block(gnrc_pktbuf_slab_class_t cls)
+{
+    switch (cls) {
+    case GNRC_PKTBUF_SLAB_SNIP:
+        return 0;
+    case GNRC_PKTBUF_SLAB_SMALL:
+        return _SMALL_FIRST;
+    default:
+        return _LARGE_FIRST;
+    }
+}
+
+static inline uint8_t *_class_start(gnrc_pktbuf_slab_class_t cls)
+{
+    switch (cls) {
+    case GNRC_PKTBUF_SLAB_SNIP:
+        return gnrc_pktbuf_slab_buf;
+    case GNRC_PKTBUF_SLAB_SMALL:
+        return gnrc_pktbuf_slab_buf + _SNIP_BUF_SIZE;
+    default:
+        return gnrc_pktbuf_slab_buf + _SNIP_BUF_SIZE + _SMALL_BUF_SIZE;
+    }
+}
+
+/* maps a pointer into the buffer to its block, the division is by a
+ * constant in each branch */
+static unsigned _block_idx(const void *ptr, gnrc_pktbuf_slab_class_t *cls)
+{
+    size_t offset = (const uint8_t *)ptr - gnrc_pktbuf_slab_buf;
+
+    if (offset < _SNIP_BUF_SIZE) {
+        *cls = GNRC_PKTBUF_SLAB_SNIP;
+        return offset / GNRC_PKTBUF_SLAB_SNIP_SIZE;
+    }
+    offset -= _SNIP_BUF_SIZE;
+    if (offset < _SMALL_BUF_SIZE) {
+        *cls = GNRC_PKTBUF_SLAB_SMALL;
+        return _SMALL_FIRST + (offset / GNRC_PKTBUF_SLAB_SMALL_SIZE);
+    }
+    offset -= _SMALL_BUF_SIZE;
+    *cls = GNRC_PKTBUF_SLAB_LARGE;
+    return _LARGE_FIRST + (offset / GNRC_PKTBUF_SLAB_LARGE_SIZE);
+}
+
+static inline uint8_t *_block_start(unsigned idx, gnrc_pktbuf_slab_class_t cls)
+{
+    return _class_start(cls) + ((idx - _first_block(cls)) * _block_size(cls));
+}
+
+static void *_slab_alloc(gnrc_pktbuf_slab_class_t cls)
+{
+    _slab_t *slab = &_slabs[cls];
+    _free_t *block = slab->free;
+
+    if (block == NULL) {
+        return NULL;
+    }
+    slab->free = block->next;
+    if (++slab->used > slab->max_used) {
+        slab->max_used = slab->used;
+    }
+    _refs[_block_idx(block, &cls)] = 1;
+    return block;
+}
+
+static gnrc_pktbuf_slab_class_t _data_class(size_t size)
+{
+    return (size <= GNRC_PKTBUF_SLAB_SMALL_SIZE) ? GNRC_PKTBUF_SLAB_SMALL
+                                                 : GNRC_PKTBUF_SLAB_LARGE;
+}
+
+static void *_data_alloc(size_t size)
+{
+    void *data = NULL;
+
+    if (size > GNRC_PKTBUF_SLAB_LARGE_SIZE) {
+        DEBUG("pktbuf: size (%u) > GNRC_PKTBUF_SLAB_LARGE_SIZE (%u)\n",
+              (unsigned)size, (unsigned)GNRC_PKTBUF_SLAB_LARGE_SIZE);
+        return NULL;
+    }
+    for (unsigned cls = _data_class(size); (data == NULL) &&
+         (cls < GNRC_PKTBUF_SLAB_NUMOF); cls++) {
+        data = _slab_alloc(cls);
+    }
+    if (data == NULL) {
+        DEBUG("pktbuf: no block left for size %u\n", (unsigned)size);
+    }
+    return data;
+}
+
+static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
+                                void *data, size_t size, gnrc_nettype_t type)
+{
+    pkt->next = next;
+    pkt->data = data;
+    pkt->size = size;
+    pkt->type = type;
+    pkt->users = 1;
+#ifdef MODULE_GNRC_NETERR
+    pkt->err_sub = KERNEL_PID_UNDEF;
+#endif
+}
+
+void gnrc_pktbuf_init(void)
+{
+    BUILD_BUG_ON(GNRC_PKTBUF_SLAB_SMALL_SIZE < sizeof(_free_t));
+    BUILD_BUG_ON(GNRC_PKTBUF_SLAB_SMALL_SIZE > GNRC_PKTBUF_SLAB_LARGE_SIZE);
+    BUILD_BUG_ON(_BLOCKS_NUMOF > UINT16_MAX);
+
+    mutex_lock(&gnrc_pktbuf_mutex);
+    for (unsigned cls = 0; cls < GNRC_PKTBUF_SLAB_NUMOF; cls++) {
+        uint8_t *start = _class_start(cls);
+        size_t size = _block_size(cls);
+        _free_t *prev = NULL;
+
+        /* build the free list back to front, so blocks are handed out in
+         * ascending order after initialization */
+        for (unsigned i = _blocks_numof(cls); i > 0; i--) {
+            /* block starts are aligned, as the block sizes are rounded up.
+             * We cast to uintptr_t as intermediate step to silence
+             * -Wcast-align */
+            _free_t *block = (_free_t *)(uintptr_t)(start + ((i - 1) * size));
+
+            block->next = prev;
+            prev = block;
+        }
+        _slabs[cls].free = prev;
+        _slabs[cls].used = 0;
+        _slabs[cls].max_used = 0;
+    }
+    memset(_refs, 0, sizeof(_refs));
+    mutex_unlock(&gnrc_pktbuf_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt;
+
+    if (size > GNRC_PKTBUF_SLAB_LARGE_SIZE) {
+        DEBUG("pktbuf: size (%u) > GNRC_PKTBUF_SLAB_LARGE_SIZE (%u)\n",
+              (unsigned)size, (unsigned)GNRC_PKTBUF_SLAB_LARGE_SIZE);
+        return NULL;
+    }
+    mutex_lock(&gnrc_pktbuf_mutex);
+    pkt = _create_snip(next, data, size, type);
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return pkt;
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *marked_snip;
+    gnrc_pktbuf_slab_class_t cls;
+    void *marked_data;
+
+    mutex_lock(&gnrc_pktbuf_mutex);
+    if ((size == 0) || (pkt == NULL) || (size > pkt->size) || (pkt->data == NULL)) {
+        DEBUG("pktbuf: size == 0 (was %u) or pkt == NULL (was %p) or "
+              "size > pkt->size (was %u) or pkt->data == NULL (was %p)\n",
+              (unsigned)size, (void *)pkt, (pkt ? (unsigned)pkt->size : 0),
+              (pkt ? pkt->data : NULL));
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return NULL;
+    }
+    if ((pkt->size != size) &&
+        (_refs[_block_idx(pkt->data, &cls)] == _REFS_MAX)) {
+        DEBUG("pktbuf: block of %p is split too often\n", pkt->data);
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return NULL;
+    }
+    /* create new snip descriptor for marked data */
+    marked_snip = _slab_alloc(GNRC_PKTBUF_SLAB_SNIP);
+    if (marked_snip == NULL) {
+        DEBUG("pktbuf: could not allocate marked snip.\n");
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return NULL;
+    }
+    marked_data = pkt->data;
+    if (pkt->size != size) {
+        /* both parts now refer to the same block */
+        _refs[_block_idx(pkt->data, &cls)]++;
+        pkt->data = ((uint8_t *)pkt->data) + size;
+    }
+    else {
+        pkt->data = NULL;
+    }
+    pkt->size -= size;
+    _set_pktsnip(marked_snip, pkt->next, marked_data, size, type);
+    pkt->next = marked_snip;
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return marked_snip;
+}
+
+static int _realloc_data(gnrc_pktsnip_t *pkt, size_t size)
+{
+    gnrc_pktbuf_slab_class_t cls;
+    unsigned idx;
+    void *new_data;
+
+    assert(pkt != NULL);
+    assert(((pkt->size == 0) && (pkt->data == NULL)) ||
+           ((pkt->size > 0) && (pkt->data != NULL) && gnrc_pktbuf_contains(pkt->data)));
+    /* new size and old size are equal */
+    if (size == pkt->size) {
+        /* nothing to do */
+        return 0;
+    }
+    /* new size is 0 and data pointer isn't already NULL */
+    if ((size == 0) && (pkt->data != NULL)) {
+        /* set data pointer to NULL */
+        gnrc_pktbuf_free_internal(pkt->data, pkt->size);
+        pkt->data = NULL;
+        pkt->size = 0;
+        return 0;
+    }
+    if (pkt->data != NULL) {
+        idx = _block_idx(pkt->data, &cls);
+        if (size < pkt->size) {
+            /* move to a smaller size class if the data is on its own to make
+             * the large block available again, otherwise just shrink */
+            if ((_refs[idx] == 1) && (_data_class(size) < cls) &&
+                ((new_data = _slab_alloc(_data_class(size))) != NULL)) {
+                memcpy(new_data, pkt->data, size);
+                gnrc_pktbuf_free_internal(pkt->data, pkt->size);
+                pkt->data = new_data;
+            }
+            pkt->size = size;
+            return 0;
+        }
+        /* grow in place if nobody else refers to the rest of the block */
+        if ((_refs[idx] == 1) &&
+            ((size_t)((uint8_t *)pkt->data - _block_start(idx, cls)) + size)
+            <= _block_size(cls)) {
+            pkt->size = size;
+            return 0;
+        }
+    }
+    new_data = _data_alloc(size);
+    if (new_data == NULL) {
+        DEBUG("pktbuf: error allocating new data section\n");
+        return ENOMEM;
+    }
+    if (pkt->data != NULL) {            /* if old data exist */
+        memcpy(new_data, pkt->data, pkt->size);
+    }
+    gnrc_pktbuf_free_internal(pkt->data, pkt->size);
+    pkt->data = new_data;
+    pkt->size = size;
+    return 0;
+}
+
+int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
+{
+    int res;
+
+    mutex_lock(&gnrc_pktbuf_mutex);
+    res = _realloc_data(pkt, size);
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return res;
+}
+
+void gnrc_pktbuf_hold(gnrc_pktsnip_t *pkt, unsigned int num)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    while (pkt) {
+        pkt->users += num;
+        pkt = pkt->next;
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    if (pkt == NULL) {
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return NULL;
+    }
+    if (pkt->users > 1) {
+        gnrc_pktsnip_t *new;
+        new = _create_snip(pkt->next, pkt->data, pkt->size, pkt->type);
+        if (new != NULL) {
+            pkt->users--;
+        }
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return new;
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return pkt;
+}
+
+void gnrc_pktbuf_slab_stats(gnrc_pktbuf_slab_class_t cls,
+                            gnrc_pktbuf_slab_stats_t *stats)
+{
+    assert(cls < GNRC_PKTBUF_SLAB_NUMOF);
+    mutex_lock(&gnrc_pktbuf_mutex);
+    stats->size = _block_size(cls);
+    stats->numof = _blocks_numof(cls);
+    stats->used = _slabs[cls].used;
+    stats->max_used = _slabs[cls].max_used;
+    mutex_unlock(&gnrc_pktbuf_mutex);
+}
+
+#ifdef DEVELHELP
+void gnrc_pktbuf_stats(void)
+{
+    static const char *names[] = { "snip", "small", "large" };
+
+    printf("packet buffer: first byte: %p, last byte: %p (size: %u)\n",
+           (void *)&gnrc_pktbuf_slab_buf[0],
+           (void *)&gnrc_pktbuf_slab_buf[GNRC_PKTBUF_SLAB_BUF_SIZE],
+           (unsigned)GNRC_PKTBUF_SLAB_BUF_SIZE);
+    for (unsigned cls = 0; cls < GNRC_PKTBUF_SLAB_NUMOF; cls++) {
+        gnrc_pktbuf_slab_stats_t stats;
+
+        gnrc_pktbuf_slab_stats(cls, &stats);
+        printf("  %-5s (%4u B): %3u of %3u blocks used, max: %3u\n",
+               names[cls], stats.size, stats.used, stats.numof,
+               stats.max_used);
+    }
+}
+#endif
+
+#ifdef TEST_SUITES
+bool gnrc_pktbuf_is_empty(void)
+{
+    for (unsigned cls = 0; cls < GNRC_PKTBUF_SLAB_NUMOF; cls++) {
+        if (_slabs[cls].used > 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool gnrc_pktbuf_is_sane(void)
+{
+    /* Invariants of this implementation:
+     *  - every block in the free list of a class is a block of that class
+     *    and is not referenced
+     *  - the free list of a class has (numof - used) entries
+     *  - (numof - used) blocks of a class are not referenced */
+    for (unsigned cls = 0; cls < GNRC_PKTBUF_SLAB_NUMOF; cls++) {
+        unsigned free = 0, unreferenced = 0;
+        unsigned first = _first_block(cls);
+
+        for (_free_t *ptr = _slabs[cls].free; ptr != NULL; ptr = ptr->next) {
+            gnrc_pktbuf_slab_class_t ptr_cls;
+            unsigned idx;
+
+            if (!gnrc_pktbuf_contains(ptr)) {
+                return false;
+            }
+            idx = _block_idx(ptr, &ptr_cls);
+            if ((ptr_cls != cls) || ((uint8_t *)ptr != _block_start(idx, cls)) ||
+                (_refs[idx] != 0) || (++free > _blocks_numof(cls))) {
+                return false;
+            }
+        }
+        for (unsigned i = first; i < first + _blocks_numof(cls); i++) {
+            if (_refs[i] == 0) {
+                unreferenced++;
+            }
+        }
+        if ((free != (_blocks_numof(cls) - _slabs[cls].used)) ||
+            (unreferenced != free)) {
+            return false;
+        }
+    }
+    return true;
+}
+#endif
+
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt = _slab_alloc(GNRC_PKTBUF_SLAB_SNIP);
+    void *_data = NULL;
+
+    if (pkt == NULL) {
+        DEBUG("pktbuf: error allocating new packet snip\n");
+        return NULL;
+    }
+    if (size > 0) {
+        _data = _data_alloc(size);
+        if (_data == NULL) {
+            DEBUG("pktbuf: error allocating data for new packet snip\n");
+            gnrc_pktbuf_free_internal(pkt, sizeof(gnrc_pktsnip_t));
+            return NULL;
+        }
+        if (data != NULL) {
+            memcpy(_data, data, size);
+        }
+    }
+    _set_pktsnip(pkt, next, _data, size, type);
+    return pkt;
+}
+
+void gnrc_pktbuf_free_internal(void *data, size_t size)
+{
+    gnrc_pktbuf_slab_class_t cls;
+    unsigned idx;
+
+    (void)size;
+    if (!gnrc_pktbuf_contains(data)) {
+        return;
+    }
+    idx = _block_idx(data, &cls);
+    assert(_refs[idx] > 0);
+    if (--_refs[idx] == 0) {
+        _free_t *block = (_free_t *)(uintptr_t)_block_start(idx, cls);
+
+        block->next = _slabs[cls].free;
+        _slabs[cls].free = block;
+        _slabs[cls].used--;
+    }
+}
+
+/** @} */
@@ -195,8 +195,8 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
     return 0;
 }
 
-ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
-                       const sock_ip_ep_t *remote, uint8_t nh)
+static ssize_t _send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
+                     const sock_ip_ep_t *remote, uint8_t nh, bool direct)
 {
     gnrc_pktsnip_t *pkt;
     kernel_pid_t iface = KERNEL_PID_UNDEF;
@@ -223,6 +223,9 @@ ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
                 payload->type = GNRC_NETTYPE_IPV6;
                 type = GNRC_NETTYPE_IPV6;
             }
+            else if (direct) {
+                type = GNRC_NETTYPE_IPV6;
+            }
             else {
                 type = payload->type;
             }
@@ -305,4 +308,16 @@ ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
     return payload_len;
 }
 
+ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
+                       const sock_ip_ep_t *remote, uint8_t nh)
+{
+    return _send(payload, local, remote, nh, false);
+}
+
+ssize_t gnrc_sock_send_direct(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
+                              const sock_ip_ep_t *remote, uint8_t nh)
+{
+    return _send(payload, local, remote, nh, true);
+}
+
 /** @} */
@@ -154,6 +154,17 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt, uint32_t time
  */
 ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
                        const sock_ip_ep_t *remote, uint8_t nh);
+
+/**
+ * @brief   Send a packet internally, directly to the network layer
+ *
+ * Other than @ref gnrc_sock_send() this bypasses the transport layer's
+ * thread, so the transport layer header in @p payload must be complete
+ * except for the checksum, which is calculated by the network layer.
+ * @internal
+ */
+ssize_t gnrc_sock_send_direct(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
+                              const sock_ip_ep_t *remote, uint8_t nh);
 /**
  * @}
  */
@@ -197,6 +197,33 @@ ssize_t sock_udp_recv_aux(sock_udp_t *sock, void *data, size_t max_len,
     return (nobufs) ? -ENOBUFS : ((res < 0) ? res : ret);
 }
 
+int sock_udp_recv_many(sock_udp_t *sock, sock_udp_dgram_t *dgrams,
+                       unsigned numof, uint32_t timeout)
+{
+    unsigned i = 0;
+
+    assert((sock != NULL) && (dgrams != NULL) && (numof > 0));
+    while (i < numof) {
+        /* only wait for the first datagram, the others are taken from the
+         * mbox as long as there are any */
+        ssize_t res = sock_udp_recv(sock, dgrams[i].data, dgrams[i].len,
+                                    (i == 0) ? timeout : 0, dgrams[i].remote);
+
+        if (res < 0) {
+            if (i == 0) {
+                return (int)res;
+            }
+            if ((res == -ENOBUFS) || (res == -EPROTO)) {
+                /* datagram was dropped, try the next one */
+                continue;
+            }
+            break;
+        }
+        dgrams[i++].len = res;
+    }
+    return (int)i;
+}
+
 ssize_t sock_udp_recv_buf_aux(sock_udp_t *sock, void **data, void **buf_ctx,
                               uint32_t timeout, sock_udp_ep_t *remote,
                               sock_udp_aux_rx_t *aux)
@@ -278,10 +305,9 @@ ssize_t sock_udp_recv_buf_aux(sock_udp_t *sock, void **data, void **buf_ctx,
     return res;
 }
 
-ssize_t sock_udp_send_aux(sock_udp_t *sock, const void *data, size_t len,
-                          const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
+static ssize_t _send(sock_udp_t *sock, const void *data, size_t len,
+                     const sock_udp_ep_t *remote, bool direct)
 {
-    (void)aux;
     int res;
     gnrc_pktsnip_t *payload, *pkt;
     uint16_t src_port = 0, dst_port;
@@ -372,7 +398,16 @@ ssize_t sock_udp_send_aux(sock_udp_t *sock, const void *data, size_t len,
         gnrc_pktbuf_release(payload);
         return -ENOMEM;
     }
-    res = gnrc_sock_send(pkt, &local, rem, PROTNUM_UDP);
+    if (direct) {
+        /* fill in what the UDP thread would, to skip it */
+        udp_hdr_t *hdr = pkt->data;
+
+        hdr->length = byteorder_htons(gnrc_pkt_len(pkt));
+        res = gnrc_sock_send_direct(pkt, &local, rem, PROTNUM_UDP);
+    }
+    else {
+        res = gnrc_sock_send(pkt, &local, rem, PROTNUM_UDP);
+    }
     if (res > 0) {
         res -= sizeof(udp_hdr_t);
     }
@@ -385,6 +420,28 @@ ssize_t sock_udp_send_aux(sock_udp_t *sock, const void *data, size_t len,
     return res;
 }
 
+ssize_t sock_udp_send_aux(sock_udp_t *sock, const void *data, size_t len,
+                          const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
+{
+    (void)aux;
+    return _send(sock, data, len, remote, false);
+}
+
+int sock_udp_send_many(sock_udp_t *sock, const sock_udp_dgram_t *dgrams,
+                       unsigned numof)
+{
+    assert((sock != NULL) && (dgrams != NULL) && (numof > 0));
+    for (unsigned i = 0; i < numof; i++) {
+        ssize_t res = _send(sock, dgrams[i].data, dgrams[i].len,
+                            dgrams[i].remote, true);
+
+        if (res < 0) {
+            return (i == 0) ? (int)res : (int)i;
+        }
+    }
+    return (int)numof;
+}
+
 #ifdef SOCK_HAS_ASYNC
 void sock_udp_set_cb(sock_udp_t *sock, sock_udp_cb_t cb, void *arg)
 {
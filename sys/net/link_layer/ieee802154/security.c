@@ -306,15 +306,25 @@ static void _comp_mic(ieee802154_sec_context_t *ctx,
 
 static void _ctr(ieee802154_sec_context_t *ctx,
                  ieee802154_ccm_block_t *A0,
-                 const void *m, uint16_t m_len)
+                 void *m, uint16_t m_len)
 {
-    uint8_t tmp1[IEEE802154_SEC_BLOCK_SIZE] = { 0 };
-    uint8_t tmp2[IEEE802154_SEC_BLOCK_SIZE] = { 0 };
+    /* pass several counter blocks to the cipher at once, hardware
+       accelerators then need fewer transfers */
+    ieee802154_ccm_block_t Ai[CONFIG_CIPHER_BATCH_BLOCKS];
+    uint8_t stream[sizeof(Ai)];
 
     for (uint16_t off = 0; off < m_len;) {
-        _advance_ctr_Ai(A0);
-        off += _ecb(ctx, tmp1, tmp2,
-                    &(((uint8_t *)m)[off]), (uint8_t *)A0, m_len - off);
+        uint16_t n = (m_len - off + IEEE802154_SEC_BLOCK_SIZE - 1)
+                     / IEEE802154_SEC_BLOCK_SIZE;
+        n = _min(n, ARRAY_SIZE(Ai));
+        for (uint16_t i = 0; i < n; i++) {
+            _advance_ctr_Ai(A0);
+            Ai[i] = *A0;
+        }
+        ctx->dev.cipher_ops->ecb(&ctx->dev, stream, (uint8_t *)Ai, n);
+        n = _min(n * IEEE802154_SEC_BLOCK_SIZE, m_len - off);
+        _memxor(&((uint8_t *)m)[off], stream, n);
+        off += n;
     }
 }
 
@@ -19,6 +19,7 @@
  * @}
  */
 
+#include <assert.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -65,6 +66,307 @@ static void fib_lifetime_to_absolute(uint32_t ms, uint64_t *target)
     *target = xtimer_now_usec64() + (ms * US_PER_MS);
 }
 
+/**
+ * @brief removes the given entry
+ *
+ * @param[in] table the FIB table the entry belongs to
+ * @param[in] entry the entry to be removed
+ *
+ * @return 0 on success
+ */
+static int fib_remove(fib_table_t *table, fib_entry_t *entry);
+
+/**
+ * @brief lowers the point in time of the next expiry check if needed
+ *
+ * @param[in] table     the FIB table
+ * @param[in] lifetime  the absolute lifetime of an entry
+ */
+static void fib_update_next_expiry(fib_table_t *table, uint64_t lifetime)
+{
+    if (lifetime < table->next_expiry) {
+        table->next_expiry = lifetime;
+    }
+}
+
+/**
+ * @brief removes all entries with an expired lifetime
+ *
+ * The entries are only searched once the earliest lifetime in the table
+ * passed, so all lookups but the first one after an expiry return right away.
+ * The caller must hold the lock of the table.
+ *
+ * @param[in] table     the FIB table
+ */
+static void fib_remove_expired(fib_table_t *table)
+{
+    uint64_t now = xtimer_now_usec64();
+
+    if (now < table->next_expiry) {
+        return;
+    }
+
+    table->next_expiry = FIB_LIFETIME_NO_EXPIRE;
+    for (size_t i = 0; i < table->size; ++i) {
+        fib_entry_t *entry = &table->data.entries[i];
+
+        /* autoinvalidate if the entry lifetime is not set to not expire */
+        if (entry->lifetime != FIB_LIFETIME_NO_EXPIRE) {
+            /* check if the lifetime expired */
+            if (entry->lifetime < now) {
+                /* remove this entry if its lifetime expired */
+                fib_remove(table, entry);
+            }
+            else {
+                fib_update_next_expiry(table, entry->lifetime);
+            }
+        }
+    }
+}
+
+#ifdef MODULE_FIB_TRIE
+#define FIB_TRIE_NODE_UNUSED    (UINT8_MAX)
+
+static inline unsigned _trie_bit(const uint8_t *key, unsigned pos)
+{
+    return (key[pos >> 3] >> (7 - (pos & 0x7))) & 0x1;
+}
+
+/* returns the number of leading bits @p a and @p b have in common, up to @p max */
+static unsigned _trie_common_len(const uint8_t *a, const uint8_t *b, unsigned max)
+{
+    unsigned len = 0;
+
+    while (len < max) {
+        uint8_t diff = a[len >> 3] ^ b[len >> 3];
+        if (diff == 0) {
+            len += 8;
+            continue;
+        }
+        while (!(diff & 0x80)) {
+            diff <<= 1;
+            len++;
+        }
+        break;
+    }
+    return (len < max) ? len : max;
+}
+
+/* builds the trie key of an address prefix, returns the key length in bits */
+static unsigned _trie_key(uint8_t *key, const uint8_t *addr, size_t addr_size,
+                          uint32_t addr_flags)
+{
+    unsigned prefix_len = 0;
+
+    for (size_t i = 0; i < addr_size; ++i) {
+        if (addr[i] != 0) {
+            /* not the default route, which matches any address */
+            prefix_len = addr_size << 3;
+            break;
+        }
+    }
+    if (prefix_len && (addr_flags & FIB_FLAG_NET_PREFIX_MASK)) {
+        unsigned flags_len = (addr_flags & FIB_FLAG_NET_PREFIX_MASK)
+                             >> FIB_FLAG_NET_PREFIX_SHIFT;
+        if (flags_len < prefix_len) {
+            prefix_len = flags_len;
+        }
+    }
+
+    memset(key, 0, UNIVERSAL_ADDRESS_SIZE + 1);
+    key[0] = addr_size;
+    memcpy(&key[1], addr, prefix_len >> 3);
+    if (prefix_len & 0x7) {
+        key[1 + (prefix_len >> 3)] = addr[prefix_len >> 3] &
+                                     (0xff << (8 - (prefix_len & 0x7)));
+    }
+    return 8 + prefix_len;
+}
+
+static unsigned _trie_entry_key(uint8_t *key, fib_entry_t *entry)
+{
+    return _trie_key(key, entry->global->address, entry->global->address_size,
+                     entry->global_flags);
+}
+
+static int16_t _trie_alloc(fib_table_t *table, const uint8_t *key,
+                           unsigned len, fib_entry_t *entry)
+{
+    for (int16_t i = 0; i < (int16_t)FIB_TRIE_NODES_NUMOF(table->size); ++i) {
+        fib_trie_node_t *node = &table->trie_nodes[i];
+        if (node->len == FIB_TRIE_NODE_UNUSED) {
+            node->entry = entry;
+            node->child[0] = -1;
+            node->child[1] = -1;
+            node->len = len;
+            memcpy(node->key, key, sizeof(node->key));
+            /* clear the bits beyond len, key may be longer */
+            for (unsigned j = len; j < (sizeof(node->key) << 3); j++) {
+                node->key[j >> 3] &= ~(0x80 >> (j & 0x7));
+            }
+            return i;
+        }
+    }
+    /* cannot happen, a table of n entries needs at most 2n - 1 nodes */
+    assert(false);
+    return -1;
+}
+
+static void _trie_reset(fib_table_t *table)
+{
+    if (table->trie_nodes == NULL) {
+        return;
+    }
+    for (size_t i = 0; i < FIB_TRIE_NODES_NUMOF(table->size); ++i) {
+        table->trie_nodes[i].len = FIB_TRIE_NODE_UNUSED;
+    }
+    table->trie_root = -1;
+}
+
+static void _trie_insert(fib_table_t *table, fib_entry_t *entry)
+{
+    uint8_t key[UNIVERSAL_ADDRESS_SIZE + 1];
+    unsigned len = _trie_entry_key(key, entry);
+    int16_t *link = &table->trie_root;
+
+    while (*link >= 0) {
+        fib_trie_node_t *node = &table->trie_nodes[*link];
+        unsigned common = _trie_common_len(node->key, key,
+                                           (node->len < len) ? node->len : len);
+
+        if (common < node->len) {
+            /* the new prefix diverges from this node or is a prefix of it */
+            int16_t idx;
+            if (common == len) {
+                idx = _trie_alloc(table, key, len, entry);
+            }
+            else {
+                int16_t leaf = _trie_alloc(table, key, len, entry);
+                idx = _trie_alloc(table, key, common, NULL);
+                table->trie_nodes[idx].child[_trie_bit(key, common)] = leaf;
+            }
+            table->trie_nodes[idx].child[_trie_bit(node->key, common)] = *link;
+            *link = idx;
+            return;
+        }
+        if (node->len == len) {
+            /* fib_add_entry() updates entries of known prefixes, so this
+             * can only be a branching node */
+            assert(node->entry == NULL);
+            node->entry = entry;
+            return;
+        }
+        link = &node->child[_trie_bit(key, node->len)];
+    }
+    *link = _trie_alloc(table, key, len, entry);
+}
+
+static void _trie_remove(fib_table_t *table, fib_entry_t *entry)
+{
+    uint8_t key[UNIVERSAL_ADDRESS_SIZE + 1];
+    unsigned len = _trie_entry_key(key, entry);
+    int16_t *parent_link = NULL;
+    int16_t *link = &table->trie_root;
+
+    while ((*link >= 0) && (table->trie_nodes[*link].entry != entry)) {
+        fib_trie_node_t *node = &table->trie_nodes[*link];
+        if (node->len >= len) {
+            return;
+        }
+        parent_link = link;
+        link = &node->child[_trie_bit(key, node->len)];
+    }
+    if (*link < 0) {
+        return;
+    }
+
+    fib_trie_node_t *node = &table->trie_nodes[*link];
+    node->entry = NULL;
+    if ((node->child[0] >= 0) && (node->child[1] >= 0)) {
+        /* keep it as branching node */
+        return;
+    }
+
+    /* replace the node by its only child (if any) */
+    node->len = FIB_TRIE_NODE_UNUSED;
+    *link = (node->child[0] >= 0) ? node->child[0] : node->child[1];
+
+    if ((*link < 0) && (parent_link != NULL)) {
+        /* a branching parent is left with one child, so remove it as well */
+        fib_trie_node_t *parent = &table->trie_nodes[*parent_link];
+        if (parent->entry == NULL) {
+            parent->len = FIB_TRIE_NODE_UNUSED;
+            *parent_link = (parent->child[0] >= 0) ? parent->child[0]
+                                                   : parent->child[1];
+        }
+    }
+}
+
+/* returns the entry stored for exactly the given prefix */
+static fib_entry_t *_trie_get(fib_table_t *table, uint8_t *dst,
+                              size_t dst_size, uint32_t dst_flags)
+{
+    uint8_t key[UNIVERSAL_ADDRESS_SIZE + 1];
+    unsigned len = _trie_key(key, dst, dst_size, dst_flags);
+    int16_t idx = table->trie_root;
+
+    while (idx >= 0) {
+        fib_trie_node_t *node = &table->trie_nodes[idx];
+        if ((node->len > len) ||
+            (_trie_common_len(node->key, key, node->len) < node->len)) {
+            break;
+        }
+        if (node->len == len) {
+            return node->entry;
+        }
+        idx = node->child[_trie_bit(key, node->len)];
+    }
+    return NULL;
+}
+
+static int _trie_find(fib_table_t *table, uint8_t *dst, size_t dst_size,
+                      fib_entry_t **entry_arr, size_t *entry_arr_size)
+{
+    uint8_t key[UNIVERSAL_ADDRESS_SIZE + 1];
+    unsigned len = _trie_key(key, dst, dst_size, 0);
+    fib_entry_t *best = NULL;
+    int16_t idx = table->trie_root;
+
+    /* all nodes along the path are prefixes of dst, the deeper the longer */
+    while (idx >= 0) {
+        fib_trie_node_t *node = &table->trie_nodes[idx];
+
+        if ((node->len > len) ||
+            (_trie_common_len(node->key, key, node->len) < node->len)) {
+            break;
+        }
+        if (node->entry != NULL) {
+            universal_address_container_t *global = node->entry->global;
+            if ((global->address_size == dst_size) &&
+                (memcmp(global->address, dst, dst_size) == 0)) {
+                /* we will not find a better one than the exact match */
+                entry_arr[0] = node->entry;
+                *entry_arr_size = 1;
+                return 1;
+            }
+            best = node->entry;
+        }
+        if (node->len == len) {
+            break;
+        }
+        idx = node->child[_trie_bit(key, node->len)];
+    }
+
+    if (best == NULL) {
+        *entry_arr_size = 0;
+        return -EHOSTUNREACH;
+    }
+    entry_arr[0] = best;
+    *entry_arr_size = 1;
+    return 0;
+}
+#endif /* MODULE_FIB_TRIE */
+
 /**
  * @brief returns pointer to the entry for the given destination address
  *
@@ -81,8 +383,6 @@ static void fib_lifetime_to_absolute(uint32_t ms, uint64_t *target)
  */
 static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
                           fib_entry_t **entry_arr, size_t *entry_arr_size) {
-    uint64_t now = xtimer_now_usec64();
-
     size_t count = 0;
     size_t prefix_size = 0;
     size_t match_size = dst_size << 3;
@@ -97,6 +397,14 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
         DEBUG("\n");
     }
 
+    fib_remove_expired(table);
+
+#ifdef MODULE_FIB_TRIE
+    if (table->trie_nodes != NULL) {
+        return _trie_find(table, dst, dst_size, entry_arr, entry_arr_size);
+    }
+#endif
+
     for (size_t i = 0; i < dst_size; ++i) {
         if (dst[i] != 0) {
             is_all_zeros_addr = false;
@@ -106,29 +414,6 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
 
     for (size_t i = 0; i < table->size; ++i) {
 
-        /* autoinvalidate if the entry lifetime is not set to not expire */
-        if (table->data.entries[i].lifetime != FIB_LIFETIME_NO_EXPIRE) {
-
-            /* check if the lifetime expired */
-            if (table->data.entries[i].lifetime < now) {
-                /* remove this entry if its lifetime expired */
-                table->data.entries[i].lifetime = 0;
-                table->data.entries[i].global_flags = 0;
-                table->data.entries[i].next_hop_flags = 0;
-                table->data.entries[i].iface_id = KERNEL_PID_UNDEF;
-
-                if (table->data.entries[i].global != NULL) {
-                    universal_address_rem(table->data.entries[i].global);
-                    table->data.entries[i].global = NULL;
-                }
-
-                if (table->data.entries[i].next_hop != NULL) {
-                    universal_address_rem(table->data.entries[i].next_hop);
-                    table->data.entries[i].next_hop = NULL;
-                }
-            }
-        }
-
         if ((prefix_size < (dst_size<<3)) && (table->data.entries[i].global != NULL)) {
 
             int ret_comp = universal_address_compare(table->data.entries[i].global, dst, &match_size);
@@ -192,6 +477,7 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
 /**
  * @brief updates the next hop the lifetime and the interface id for a given entry
  *
+ * @param[in] table          the FIB table the entry belongs to
  * @param[in] entry          the entry to be updated
  * @param[in] next_hop       the next hop address to be updated
  * @param[in] next_hop_size  the next hop address size
@@ -201,9 +487,9 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
  * @return 0 if the entry has been updated
  *         -ENOMEM if the entry cannot be updated due to insufficient RAM
  */
-static int fib_upd_entry(fib_entry_t *entry, uint8_t *next_hop,
-                         size_t next_hop_size, uint32_t next_hop_flags,
-                         uint32_t lifetime)
+static int fib_upd_entry(fib_table_t *table, fib_entry_t *entry,
+                         uint8_t *next_hop, size_t next_hop_size,
+                         uint32_t next_hop_flags, uint32_t lifetime)
 {
     universal_address_container_t *container = universal_address_add(next_hop, next_hop_size);
 
@@ -217,6 +503,7 @@ static int fib_upd_entry(fib_entry_t *entry, uint8_t *next_hop,
 
     if (lifetime != (uint32_t)FIB_LIFETIME_NO_EXPIRE) {
         fib_lifetime_to_absolute(lifetime, &entry->lifetime);
+        fib_update_next_expiry(table, entry->lifetime);
     }
     else {
         entry->lifetime = FIB_LIFETIME_NO_EXPIRE;
@@ -263,29 +550,41 @@ static int fib_create_entry(fib_table_t *table, kernel_pid_t iface_id,
 
                 if (lifetime != (uint32_t) FIB_LIFETIME_NO_EXPIRE) {
                     fib_lifetime_to_absolute(lifetime, &table->data.entries[i].lifetime);
+                    fib_update_next_expiry(table, table->data.entries[i].lifetime);
                 }
                 else {
                     table->data.entries[i].lifetime = FIB_LIFETIME_NO_EXPIRE;
                 }
 
+#ifdef MODULE_FIB_TRIE
+                if (table->trie_nodes != NULL) {
+                    _trie_insert(table, &table->data.entries[i]);
+                }
+#endif
                 return 0;
             }
+
+            if (table->data.entries[i].global != NULL) {
+                /* release the destination again, we ran out of addresses */
+                universal_address_rem(table->data.entries[i].global);
+                table->data.entries[i].global = NULL;
+            }
         }
     }
 
     return -ENOMEM;
 }
 
-/**
- * @brief removes the given entry
- *
- * @param[in] entry the entry to be removed
- *
- * @return 0 on success
- */
-static int fib_remove(fib_entry_t *entry)
+static int fib_remove(fib_table_t *table, fib_entry_t *entry)
 {
     if (entry->global != NULL) {
+#ifdef MODULE_FIB_TRIE
+        if (table->trie_nodes != NULL) {
+            _trie_remove(table, entry);
+        }
+#else
+        (void)table;
+#endif
         universal_address_rem(entry->global);
     }
 
@@ -401,9 +700,21 @@ int fib_add_entry(fib_table_t *table,
 
     int ret = fib_find_entry(table, dst, dst_size, &(entry[0]), &count);
 
+#ifdef MODULE_FIB_TRIE
+    if ((ret != 1) && (table->trie_nodes != NULL)) {
+        /* the trie holds one entry per prefix, so an entry for the same
+         * prefix but with different host bits is updated as well */
+        entry[0] = _trie_get(table, dst, dst_size, dst_flags);
+        if (entry[0] != NULL) {
+            ret = 1;
+        }
+    }
+#endif
+
     if (ret == 1) {
         /* we must take the according entry and update the values */
-        ret = fib_upd_entry(entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
+        ret = fib_upd_entry(table, entry[0], next_hop, next_hop_size, next_hop_flags,
+                            lifetime);
     }
     else {
         ret = fib_create_entry(table, iface_id, dst, dst_size, dst_flags,
@@ -433,7 +744,8 @@ int fib_update_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
     if (fib_find_entry(table, dst, dst_size, &(entry[0]), &count) == 1) {
         DEBUG("[fib_update_entry] found entry: %p\n", (void *)(entry[0]));
         /* we must take the according entry and update the values */
-        ret = fib_upd_entry(entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
+        ret = fib_upd_entry(table, entry[0], next_hop, next_hop_size, next_hop_flags,
+                            lifetime);
     }
     else {
         /* we have ambiguous entries, i.e. count > 1
@@ -457,7 +769,7 @@ void fib_remove_entry(fib_table_t *table, uint8_t *dst, size_t dst_size)
 
     if (ret == 1) {
         /* we must take the according entry and update the values */
-        fib_remove(entry[0]);
+        fib_remove(table, entry[0]);
     }
     else {
         /* we have ambiguous entries, i.e. count > 1
@@ -477,7 +789,7 @@ void fib_flush(fib_table_t *table, kernel_pid_t interface)
     for (size_t i = 0; i < table->size; ++i) {
         if ((interface == KERNEL_PID_UNDEF) ||
             (interface == table->data.entries[i].iface_id)) {
-            fib_remove(&table->data.entries[i]);
+            fib_remove(table, &table->data.entries[i]);
         }
     }
 
@@ -596,7 +908,11 @@ void fib_init(fib_table_t *table)
     }
     else {
         memset(table->data.entries, 0, (table->size * sizeof(fib_entry_t)));
+#ifdef MODULE_FIB_TRIE
+        _trie_reset(table);
+#endif
     }
+    table->next_expiry = FIB_LIFETIME_NO_EXPIRE;
     universal_address_init();
     mutex_unlock(&(table->mtx_access));
 }
@@ -621,7 +937,11 @@ void fib_deinit(fib_table_t *table)
     }
     else {
         memset(table->data.entries, 0, (table->size * sizeof(fib_entry_t)));
+#ifdef MODULE_FIB_TRIE
+        _trie_reset(table);
+#endif
     }
+    table->next_expiry = FIB_LIFETIME_NO_EXPIRE;
     universal_address_reset();
     mutex_unlock(&(table->mtx_access));
 }
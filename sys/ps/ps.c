@@ -32,6 +32,30 @@
 #include "tlsf-malloc.h"
 #endif
 
+#ifdef MODULE_SCHEDSTATISTICS_LATENCY
+static void _print_latency_hist(void)
+{
+    puts("\nScheduling latency histogram (bucket n counts latencies "
+         "< 2^(n+1) us):");
+    printf("\tpid");
+    for (unsigned j = 0; j < CONFIG_SCHEDSTATISTICS_LATENCY_BUCKETS; j++) {
+        printf(" | %5u", j);
+    }
+    puts("");
+
+    for (kernel_pid_t i = KERNEL_PID_FIRST; i <= KERNEL_PID_LAST; i++) {
+        if (thread_get(i) == NULL) {
+            continue;
+        }
+        printf("\t%3" PRIkernel_pid, i);
+        for (unsigned j = 0; j < CONFIG_SCHEDSTATISTICS_LATENCY_BUCKETS; j++) {
+            printf(" | %5u", sched_pidlist[i].latency_hist[j]);
+        }
+        puts("");
+    }
+}
+#endif
+
 /**
  * @brief Prints a list of running threads including stack usage to stdout.
  */
@@ -51,6 +75,9 @@ void ps(void)
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
            "| runtime  | switches"
+#endif
+#ifdef MODULE_SCHEDSTATISTICS_LATENCY
+           "  | lat max  | run max "
 #endif
            "\n",
 #ifdef CONFIG_THREAD_NAMES
@@ -116,6 +143,9 @@ void ps(void)
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
                    " | %2d.%03d%% |  %8u"
+#endif
+#ifdef MODULE_SCHEDSTATISTICS_LATENCY
+                   "  | %6" PRIu32 "us | %6" PRIu32 "us"
 #endif
                    "\n",
                    p->pid,
@@ -129,6 +159,9 @@ void ps(void)
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
                    , runtime_major, runtime_minor, switches
+#endif
+#ifdef MODULE_SCHEDSTATISTICS_LATENCY
+                   , sched_pidlist[i].latency_max, sched_pidlist[i].running_max
 #endif
                   );
         }
@@ -145,4 +178,7 @@ void ps(void)
     printf("\tTotal used size: %u\n", sizes.used);
 #   endif
 #endif
+#ifdef MODULE_SCHEDSTATISTICS_LATENCY
+    _print_latency_hist();
+#endif
 }
@@ -40,6 +40,17 @@ static inline size_t min(size_t a, size_t b)
     return a <= b ? a : b;
 }
 
+/* writes a block and reads it back, flashpage_write() does not verify */
+static int _write_and_verify(void *addr, const void *data, size_t len)
+{
+    flashpage_write(addr, data, len);
+    if (memcmp(addr, data, len) != 0) {
+        LOG_WARNING(LOG_PREFIX "error writing block at %p!\n", addr);
+        return -1;
+    }
+    return 0;
+}
+
 size_t riotboot_flashwrite_slotsize(
         const riotboot_flashwrite_t *state)
 {
@@ -62,6 +73,14 @@ int riotboot_flashwrite_init_raw(riotboot_flashwrite_t *state, int target_slot,
     state->target_slot = target_slot;
     state->flashpage = flashpage_page((void *)riotboot_slot_get_hdr(target_slot));
 
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_VERIFY_SHA256)
+    sha256_init(&state->sha256);
+    if (offset == RIOTBOOT_FLASHWRITE_SKIPLEN) {
+        /* the magic number is only written by riotboot_flashwrite_finish() */
+        sha256_update(&state->sha256, "RIOT", RIOTBOOT_FLASHWRITE_SKIPLEN);
+    }
+#endif
+
     if (CONFIG_RIOTBOOT_FLASHWRITE_RAW && offset) {
         /* Erase the first page only if the offset (!=0) specifies that there is
          * a checksum or other mechanism at the start of the page. */
@@ -84,9 +103,9 @@ int riotboot_flashwrite_flush(riotboot_flashwrite_t *state)
         /* Get the offset of the remaining chunk */
         size_t flashpage_pos = state->offset - flashwrite_buffer_pos;
         /* Write remaining chunk */
-        flashpage_write(slot_start + flashpage_pos,
-                        state->flashpage_buf,
-                        RIOTBOOT_FLASHPAGE_BUFFER_SIZE);
+        return _write_and_verify(slot_start + flashpage_pos,
+                                 state->flashpage_buf,
+                                 RIOTBOOT_FLASHPAGE_BUFFER_SIZE);
     }
     else {
         if (flashpage_write_and_verify(state->flashpage, state->flashpage_buf) != FLASHPAGE_OK) {
@@ -102,6 +121,11 @@ int riotboot_flashwrite_putbytes(riotboot_flashwrite_t *state,
 {
     LOG_DEBUG(LOG_PREFIX "processing bytes %u-%u\n", state->offset, state->offset + len - 1);
 
+#if IS_USED(MODULE_RIOTBOOT_FLASHWRITE_VERIFY_SHA256)
+    /* hash while the data is in cache, instead of reading the slot back */
+    sha256_update(&state->sha256, bytes, len);
+#endif
+
     while (len) {
         size_t flashpage_pos = state->offset % FLASHPAGE_SIZE;
         size_t flashwrite_buffer_pos = state->offset % RIOTBOOT_FLASHPAGE_BUFFER_SIZE;
@@ -129,6 +153,10 @@ int riotboot_flashwrite_putbytes(riotboot_flashwrite_t *state,
         if ((!flashpage_avail) || (!more)) {
 #if CONFIG_RIOTBOOT_FLASHWRITE_RAW  /* Guards access to state::firstblock_buf */
             void * addr = flashpage_addr(state->flashpage);
+            /* the buffered block starts before flashpage_pos if the data
+             * passed in did not start at a block boundary */
+            uint8_t *block = (uint8_t *)addr + flashpage_pos
+                             - flashwrite_buffer_pos;
             if (addr == riotboot_slot_get_hdr(state->target_slot) &&
                     state->offset == RIOTBOOT_FLASHPAGE_BUFFER_SIZE) {
                 /* Skip flashing the first block, store it for later to flash it
@@ -136,10 +164,9 @@ int riotboot_flashwrite_putbytes(riotboot_flashwrite_t *state,
                 memcpy(state->firstblock_buf,
                        state->flashpage_buf, RIOTBOOT_FLASHPAGE_BUFFER_SIZE);
             }
-            else {
-                flashpage_write((uint8_t*)addr + flashpage_pos,
-                                    state->flashpage_buf,
-                                    RIOTBOOT_FLASHPAGE_BUFFER_SIZE);
+            else if (_write_and_verify(block, state->flashpage_buf,
+                                       RIOTBOOT_FLASHPAGE_BUFFER_SIZE) < 0) {
+                return -1;
             }
 #else
             int res = flashpage_write_and_verify(state->flashpage,
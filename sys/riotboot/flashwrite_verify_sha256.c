@@ -25,6 +25,7 @@
 
 #include "hashes/sha256.h"
 #include "log.h"
+#include "riotboot/flashwrite.h"
 #include "riotboot/slot.h"
 
 int riotboot_flashwrite_verify_sha256(const uint8_t *sha256_digest, size_t img_len, int target_slot)
@@ -55,3 +56,12 @@ int riotboot_flashwrite_verify_sha256(const uint8_t *sha256_digest, size_t img_l
 
     return memcmp(sha256_digest, digest, SHA256_DIGEST_LENGTH) != 0;
 }
+
+void riotboot_flashwrite_get_sha256(const riotboot_flashwrite_t *state,
+                                    uint8_t *digest)
+{
+    /* finalize a copy, so that more data can be added */
+    sha256_context_t sha256 = state->sha256;
+
+    sha256_final(&sha256, digest);
+}
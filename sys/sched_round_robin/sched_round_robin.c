@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_sched_round_robin
+ * @{
+ *
+ * @file
+ * @brief       Round robin scheduling within a priority
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+
+#include "irq.h"
+#include "sched.h"
+#include "sched_round_robin.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static void _rotate(void *arg);
+
+static ztimer_t _timer = { .callback = _rotate };
+static bool _enabled;
+/* thread whose time slice runs, or KERNEL_PID_UNDEF */
+static kernel_pid_t _slice_pid = KERNEL_PID_UNDEF;
+/* priority of that thread when the time slice started */
+static uint8_t _slice_prio;
+
+static void _start_slice(const thread_t *thread)
+{
+    DEBUG("sched_rr: time slice for %" PRIkernel_pid "\n", thread->pid);
+    _slice_pid = thread->pid;
+    _slice_prio = thread->priority;
+    ztimer_set(ZTIMER_USEC, &_timer, CONFIG_SCHED_RR_QUANTUM_US);
+}
+
+static void _stop_slice(void)
+{
+    _slice_pid = KERNEL_PID_UNDEF;
+    ztimer_remove(ZTIMER_USEC, &_timer);
+}
+
+static void _rotate(void *arg)
+{
+    (void)arg;
+    unsigned state = irq_disable();
+    clist_node_t *head = clist_lpeek(&sched_runqueues[_slice_prio]);
+
+    /* the thread may still be preempted by a thread of higher priority, it
+     * then continues after the other threads of its priority */
+    if (head && (container_of(head, thread_t, rq_entry)->pid == _slice_pid) &&
+        sched_runq_more_than_one(_slice_prio)) {
+        DEBUG("sched_rr: %" PRIkernel_pid " used up its time slice\n",
+              _slice_pid);
+        sched_runq_advance(_slice_prio);
+        thread_t *active = thread_get_active();
+        if (active && (active->priority == _slice_prio)) {
+            /* ztimer callbacks run in interrupt context */
+            sched_context_switch_request = 1;
+        }
+    }
+    /* the next thread starts its time slice when it is scheduled */
+    _slice_pid = KERNEL_PID_UNDEF;
+    irq_restore(state);
+}
+
+void sched_runq_callback(uint8_t prio)
+{
+    thread_t *active = thread_get_active();
+
+    if (!_enabled || !active || (active->priority != prio)) {
+        /* threads of other priorities only matter once they run */
+        return;
+    }
+
+    bool contended = sched_runq_more_than_one(prio);
+
+    if (_slice_pid != KERNEL_PID_UNDEF) {
+        if ((_slice_pid == active->pid) && (_slice_prio == prio) && contended) {
+            return;
+        }
+        if ((_slice_prio > prio) && !contended) {
+            /* keep the time slice of the preempted thread going */
+            return;
+        }
+        _stop_slice();
+    }
+    if (contended) {
+        _start_slice(active);
+    }
+}
+
+void sched_round_robin_init(void)
+{
+    unsigned state = irq_disable();
+
+    _enabled = true;
+    sched_runq_callback(thread_get_active()->priority);
+    irq_restore(state);
+}
@@ -21,10 +21,20 @@
  * @}
  */
 
+#include <errno.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "bitarithm.h"
+#include "bitfield.h"
+#include "irq.h"
 #include "sched.h"
 #include "schedstatistics.h"
 #include "thread.h"
 #include "xtimer.h"
+#if IS_USED(MODULE_SCHEDSTATISTICS_LATENCY)
+#include "ztimer.h"
+#endif
 
 /**
  * When core_idle_thread is not active, the KERNEL_PID_UNDEF is used to track
@@ -32,6 +42,49 @@
  */
 schedstat_t sched_pidlist[KERNEL_PID_LAST + 1];
 
+#if IS_USED(MODULE_SCHEDSTATISTICS_LATENCY)
+void sched_runnable_callback(thread_t *thread)
+{
+    sched_pidlist[thread->pid].runnable_since = ztimer_now(ZTIMER_USEC);
+}
+
+static void _latency_cb(kernel_pid_t active_thread, kernel_pid_t next_thread)
+{
+    uint32_t now = ztimer_now(ZTIMER_USEC);
+
+    if (active_thread != KERNEL_PID_UNDEF) {
+        schedstat_t *active_stat = &sched_pidlist[active_thread];
+        thread_t *thread = thread_get(active_thread);
+        uint32_t running = now - active_stat->running_since;
+
+        if (running > active_stat->running_max) {
+            active_stat->running_max = running;
+        }
+        /* a preempted thread stays runnable */
+        if (thread && (thread->status >= STATUS_ON_RUNQUEUE)) {
+            active_stat->runnable_since = now;
+        }
+    }
+
+    if (next_thread != KERNEL_PID_UNDEF) {
+        schedstat_t *next_stat = &sched_pidlist[next_thread];
+        uint32_t latency = now - next_stat->runnable_since;
+        unsigned bucket = latency ? bitarithm_msb(latency) : 0;
+
+        if (bucket >= CONFIG_SCHEDSTATISTICS_LATENCY_BUCKETS) {
+            bucket = CONFIG_SCHEDSTATISTICS_LATENCY_BUCKETS - 1;
+        }
+        if (next_stat->latency_hist[bucket] < UINT16_MAX) {
+            next_stat->latency_hist[bucket]++;
+        }
+        if (latency > next_stat->latency_max) {
+            next_stat->latency_max = latency;
+        }
+        next_stat->running_since = now;
+    }
+}
+#endif
+
 void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread)
 {
     uint32_t now = xtimer_now().ticks32;
@@ -48,6 +101,10 @@ void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread)
         next_stat->laststart = now;
         next_stat->schedules++;
     }
+
+#if IS_USED(MODULE_SCHEDSTATISTICS_LATENCY)
+    _latency_cb(active_thread, next_thread);
+#endif
 }
 
 void init_schedstatistics(void)
@@ -57,5 +114,82 @@ void init_schedstatistics(void)
     schedstat_t *active_stat = &sched_pidlist[thread_getpid()];
     active_stat->laststart = xtimer_now().ticks32;
     active_stat->schedules = 1;
+#if IS_USED(MODULE_SCHEDSTATISTICS_LATENCY)
+    /* threads created before were not tracked becoming runnable */
+    uint32_t now = ztimer_now(ZTIMER_USEC);
+    for (kernel_pid_t i = KERNEL_PID_FIRST; i <= KERNEL_PID_LAST; i++) {
+        sched_pidlist[i].runnable_since = now;
+    }
+    active_stat->running_since = now;
+#endif
     sched_register_cb(sched_statistics_cb);
 }
+
+static uint8_t *_put(uint8_t *pos, uint64_t val, unsigned len)
+{
+    while (len--) {
+        *pos++ = val;
+        val >>= 8;
+    }
+    return pos;
+}
+
+static bool _has_stats(kernel_pid_t pid)
+{
+    if (pid == KERNEL_PID_UNDEF) {
+        return !IS_USED(MODULE_CORE_IDLE_THREAD);
+    }
+    return thread_get(pid) != NULL;
+}
+
+int schedstatistics_dump(void *buf, size_t len)
+{
+    uint8_t *pos = buf;
+    unsigned num = 0;
+    BITFIELD(pids, KERNEL_PID_LAST + 1) = { 0 };
+
+    /* take the threads to dump in one go, so the number of records written
+     * matches the header even if threads are created meanwhile */
+    unsigned state = irq_disable();
+    for (kernel_pid_t i = KERNEL_PID_UNDEF; i <= KERNEL_PID_LAST; i++) {
+        if (_has_stats(i)) {
+            bf_set(pids, i);
+            num++;
+        }
+    }
+    irq_restore(state);
+
+    if (len < SCHEDSTATISTICS_DUMP_HDR_LEN + num * SCHEDSTATISTICS_DUMP_REC_LEN) {
+        return -ENOBUFS;
+    }
+
+    memcpy(pos, "SCHS", 4);
+    pos += 4;
+    *pos++ = 1;
+    *pos++ = IS_USED(MODULE_SCHEDSTATISTICS_LATENCY)
+           ? CONFIG_SCHEDSTATISTICS_LATENCY_BUCKETS : 0;
+    pos = _put(pos, num, 2);
+
+    for (kernel_pid_t i = KERNEL_PID_UNDEF; i <= KERNEL_PID_LAST; i++) {
+        if (!bf_isset(pids, i)) {
+            continue;
+        }
+        /* don't let the scheduler update the record while copying it */
+        state = irq_disable();
+        schedstat_t stat = sched_pidlist[i];
+        irq_restore(state);
+
+        pos = _put(pos, i, 2);
+        pos = _put(pos, stat.schedules, 4);
+        pos = _put(pos, stat.runtime_ticks, 8);
+#if IS_USED(MODULE_SCHEDSTATISTICS_LATENCY)
+        pos = _put(pos, stat.latency_max, 4);
+        pos = _put(pos, stat.running_max, 4);
+        for (unsigned j = 0; j < CONFIG_SCHEDSTATISTICS_LATENCY_BUCKETS; j++) {
+            pos = _put(pos, stat.latency_hist[j], 2);
+        }
+#endif
+    }
+
+    return pos - (uint8_t *)buf;
+}
@@ -0,0 +1,180 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_spscrb
+ * @{
+ *
+ * @file
+ * @brief       Lock-free single producer single consumer ringbuffer
+ *
+ * The producer only changes spscrb_t::writes and the consumer only changes
+ * spscrb_t::reads. Each side stores its counter after it is done with the
+ * buffer, the atomic store keeps the compiler from moving the copy behind it.
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "spscrb.h"
+
+static void _copy_in(spscrb_t *rb, uint32_t pos, const uint8_t *src, size_t n)
+{
+    uint32_t offset = pos & (rb->size - 1);
+    size_t first = rb->size - offset;
+
+    if (first > n) {
+        first = n;
+    }
+    memcpy(&rb->buf[offset], src, first);
+    memcpy(rb->buf, src + first, n - first);
+}
+
+static void _copy_out(const spscrb_t *rb, uint32_t pos, uint8_t *dst, size_t n)
+{
+    uint32_t offset = pos & (rb->size - 1);
+    size_t first = rb->size - offset;
+
+    if (first > n) {
+        first = n;
+    }
+    memcpy(dst, &rb->buf[offset], first);
+    memcpy(dst + first, rb->buf, n - first);
+}
+
+static size_t _free(const spscrb_t *rb)
+{
+    return rb->size - (rb->writes - atomic_load_u32(&rb->reads));
+}
+
+static size_t _avail(const spscrb_t *rb)
+{
+    return atomic_load_u32(&rb->writes) - rb->reads;
+}
+
+int spscrb_get_one(spscrb_t *rb)
+{
+    if (_avail(rb) == 0) {
+        return -1;
+    }
+    uint8_t c = rb->buf[rb->reads & (rb->size - 1)];
+    atomic_store_u32(&rb->reads, rb->reads + 1);
+    return c;
+}
+
+int spscrb_get(spscrb_t *rb, uint8_t *dst, size_t n)
+{
+    size_t avail = _avail(rb);
+
+    if (n > avail) {
+        n = avail;
+    }
+    _copy_out(rb, rb->reads, dst, n);
+    atomic_store_u32(&rb->reads, rb->reads + n);
+    return n;
+}
+
+int spscrb_drop(spscrb_t *rb, size_t n)
+{
+    size_t avail = _avail(rb);
+
+    if (n > avail) {
+        n = avail;
+    }
+    atomic_store_u32(&rb->reads, rb->reads + n);
+    return n;
+}
+
+int spscrb_add_one(spscrb_t *rb, uint8_t c)
+{
+    if (_free(rb) == 0) {
+        return -1;
+    }
+    rb->buf[rb->writes & (rb->size - 1)] = c;
+    atomic_store_u32(&rb->writes, rb->writes + 1);
+    return 0;
+}
+
+int spscrb_add(spscrb_t *rb, const uint8_t *src, size_t n)
+{
+    size_t free = _free(rb);
+
+    if (n > free) {
+        n = free;
+    }
+    _copy_in(rb, rb->writes, src, n);
+    atomic_store_u32(&rb->writes, rb->writes + n);
+    return n;
+}
+
+size_t spscrb_reserve(spscrb_t *rb, uint8_t **data)
+{
+    uint32_t offset = rb->writes & (rb->size - 1);
+    size_t free = _free(rb);
+
+    *data = &rb->buf[offset];
+    return (free < rb->size - offset) ? free : rb->size - offset;
+}
+
+void spscrb_commit(spscrb_t *rb, size_t n)
+{
+    assert(n <= _free(rb));
+    atomic_store_u32(&rb->writes, rb->writes + n);
+}
+
+size_t spscrb_peek(spscrb_t *rb, uint8_t **data)
+{
+    uint32_t offset = rb->reads & (rb->size - 1);
+    size_t avail = _avail(rb);
+
+    *data = &rb->buf[offset];
+    return (avail < rb->size - offset) ? avail : rb->size - offset;
+}
+
+void spscrb_consume(spscrb_t *rb, size_t n)
+{
+    assert(n <= _avail(rb));
+    atomic_store_u32(&rb->reads, rb->reads + n);
+}
+
+int spscrb_add_elem(spscrb_t *rb, const void *elem, size_t elem_size)
+{
+    return (spscrb_add_elems(rb, elem, 1, elem_size) == 1) ? 0 : -1;
+}
+
+unsigned spscrb_add_elems(spscrb_t *rb, const void *src, unsigned num,
+                          size_t elem_size)
+{
+    size_t free = _free(rb) / elem_size;
+
+    if (num > free) {
+        num = free;
+    }
+    _copy_in(rb, rb->writes, src, num * elem_size);
+    atomic_store_u32(&rb->writes, rb->writes + num * elem_size);
+    return num;
+}
+
+int spscrb_get_elem(spscrb_t *rb, void *elem, size_t elem_size)
+{
+    return (spscrb_get_elems(rb, elem, 1, elem_size) == 1) ? 0 : -1;
+}
+
+unsigned spscrb_get_elems(spscrb_t *rb, void *dst, unsigned num,
+                          size_t elem_size)
+{
+    size_t avail = _avail(rb) / elem_size;
+
+    if (num > avail) {
+        num = avail;
+    }
+    _copy_out(rb, rb->reads, dst, num * elem_size);
+    atomic_store_u32(&rb->reads, rb->reads + num * elem_size);
+    return num;
+}
@@ -413,7 +413,12 @@ static int _validate_payload(suit_component_t *component, const uint8_t *digest,
     uint8_t payload_digest[SHA256_DIGEST_LENGTH];
     suit_storage_t *storage = component->storage_backend;
 
-    if (suit_storage_has_readptr(storage)) {
+    if (suit_storage_has_sha256(storage) &&
+            suit_storage_get_sha256(storage, payload_size,
+                                    payload_digest) == SUIT_OK) {
+        /* Digest calculated while writing */
+    }
+    else if (suit_storage_has_readptr(storage)) {
         /* Direct read possible */
         const uint8_t *payload = NULL;
         size_t payload_len = 0;
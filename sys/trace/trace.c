@@ -15,56 +15,196 @@
  * @file
  * @brief       Execution tracing module implementation
  *
+ * Writers reserve space by advancing `_writes` with a compare and swap and
+ * fill it afterwards. The length byte of a record is written last, so a
+ * reader stops at a record that is still being written. The reader zeroes
+ * every byte it removes from the buffer to keep this working on the next
+ * pass through the buffer.
+ *
  * @author      Kaspar Schleiser <kaspar@schleiser.de>
  *
  * @}
  */
 
+#include <assert.h>
+#include <inttypes.h>
+#include <stdatomic.h>
 #include <stdio.h>
 
-#include "irq.h"
-#include "xtimer.h"
+#include "atomic_utils.h"
+#include "stdio_base.h"
+#include "trace.h"
+#include "ztimer.h"
 
-#ifndef CONFIG_TRACE_BUFSIZE
-#define CONFIG_TRACE_BUFSIZE 512
+#if (CONFIG_TRACE_BUFSIZE & (CONFIG_TRACE_BUFSIZE - 1)) != 0
+#error "CONFIG_TRACE_BUFSIZE must be a power of two"
 #endif
 
-typedef struct {
-    uint32_t time;
-    uint32_t val;
-} tracebuf_entry_t;
+#define TRACE_VERSION   (1U)
+
+static uint8_t _tracebuf[CONFIG_TRACE_BUFSIZE];
+static atomic_uint_least32_t _writes;
+static atomic_uint_least32_t _reads;
+static atomic_uint_least32_t _dropped;
+/* ZTIMER_USEC must not be read before ztimer_init() */
+static atomic_bool _clock_ready;
+
+static uint32_t _now(void)
+{
+    return atomic_load(&_clock_ready) ? ztimer_now(ZTIMER_USEC) : 0;
+}
+
+static uint8_t *_put_varint(uint8_t *pos, uint32_t val)
+{
+    while (val >= 0x80) {
+        *pos++ = (val & 0x7f) | 0x80;
+        val >>= 7;
+    }
+    *pos++ = val;
+    return pos;
+}
 
-static tracebuf_entry_t tracebuf[CONFIG_TRACE_BUFSIZE];
-static size_t tracebuf_pos;
+static const uint8_t *_get_varint(const uint8_t *pos, uint32_t *val)
+{
+    unsigned shift = 0;
+
+    *val = 0;
+    do {
+        *val |= (uint32_t)(*pos & 0x7f) << shift;
+        shift += 7;
+    } while (*pos++ & 0x80);
+    return pos;
+}
+
+static unsigned _encode(uint8_t *rec, uint8_t id, uint32_t time,
+                        unsigned argc, const uint32_t *argv)
+{
+    uint8_t *pos = &rec[1];
+
+    *pos++ = id;
+    for (unsigned i = 0; i < 4; i++) {
+        *pos++ = time >> (8 * i);
+    }
+    for (unsigned i = 0; i < argc; i++) {
+        pos = _put_varint(pos, argv[i]);
+    }
+    rec[0] = pos - rec;
+    return rec[0];
+}
+
+void trace_init(void)
+{
+    atomic_store(&_clock_ready, true);
+}
+
+void trace_event(uint8_t id, unsigned argc, const uint32_t *argv)
+{
+    uint8_t rec[TRACE_RECORD_MAXLEN];
+
+    assert(argc <= TRACE_ARGS_MAX);
+
+    unsigned len = _encode(rec, id, _now(), argc, argv);
+    uint32_t pos = atomic_load(&_writes);
+
+    do {
+        if (pos + len - atomic_load(&_reads) > CONFIG_TRACE_BUFSIZE) {
+            atomic_fetch_add(&_dropped, 1);
+            return;
+        }
+    } while (!atomic_compare_exchange_weak(&_writes, &pos, pos + len));
+
+    for (unsigned i = 1; i < len; i++) {
+        _tracebuf[(pos + i) & (CONFIG_TRACE_BUFSIZE - 1)] = rec[i];
+    }
+    /* publish the record */
+    atomic_store_u8(&_tracebuf[pos & (CONFIG_TRACE_BUFSIZE - 1)], len);
+}
 
 void trace(uint32_t val)
 {
-    unsigned state = irq_disable();
+    trace_event(TRACE_EVENT_USER, 1, &val);
+}
+
+/* copies the record at pos to rec, returns its length or 0 if there is no
+ * complete record */
+static unsigned _read(uint32_t pos, uint8_t *rec)
+{
+    unsigned len = atomic_load_u8(&_tracebuf[pos & (CONFIG_TRACE_BUFSIZE - 1)]);
+
+    for (unsigned i = 0; i < len; i++) {
+        rec[i] = _tracebuf[(pos + i) & (CONFIG_TRACE_BUFSIZE - 1)];
+    }
+    return len;
+}
 
-    tracebuf[tracebuf_pos % CONFIG_TRACE_BUFSIZE] =
-        (tracebuf_entry_t){ .time = xtimer_now_usec(), .val = val };
-    tracebuf_pos++;
-    irq_restore(state);
+static void _consume(uint32_t pos, unsigned len)
+{
+    for (unsigned i = 0; i < len; i++) {
+        _tracebuf[(pos + i) & (CONFIG_TRACE_BUFSIZE - 1)] = 0;
+    }
+    atomic_store(&_reads, pos + len);
 }
 
 void trace_dump(void)
 {
-    size_t n = tracebuf_pos >
-               CONFIG_TRACE_BUFSIZE ? CONFIG_TRACE_BUFSIZE : tracebuf_pos;
+    uint8_t rec[TRACE_RECORD_MAXLEN];
+    uint32_t pos = atomic_load(&_reads);
     uint32_t t_last = 0;
+    unsigned len;
 
-    for (size_t i = 0; i < n; i++) {
-        printf("n=%4lu t=%s%8" PRIu32 " v=0x%08lx\n", (unsigned long)i,
-               i ? "+" : " ",
-               tracebuf[i].time - t_last, (unsigned long)tracebuf[i].val);
-        t_last = tracebuf[i].time;
+    for (unsigned long n = 0; (len = _read(pos, rec)); n++, pos += len) {
+        uint32_t time = rec[2] | (rec[3] << 8) | ((uint32_t)rec[4] << 16) |
+                        ((uint32_t)rec[5] << 24);
+        const uint8_t *arg = &rec[6];
+        uint32_t val;
+
+        printf("n=%4lu t=%s%8" PRIu32, n, n ? "+" : " ", time - t_last);
+        if (rec[1] == TRACE_EVENT_USER) {
+            _get_varint(arg, &val);
+            printf(" v=0x%08lx", (unsigned long)val);
+        }
+        else {
+            printf(" e=%3u", rec[1]);
+            while (arg < &rec[len]) {
+                arg = _get_varint(arg, &val);
+                printf(" 0x%08lx", (unsigned long)val);
+            }
+        }
+        puts("");
+        t_last = time;
+    }
+}
+
+void trace_dump_binary(void)
+{
+    static const uint8_t hdr[8] = { 'R', 'T', 'R', 'C', TRACE_VERSION };
+    uint8_t rec[TRACE_RECORD_MAXLEN];
+    uint32_t pos = atomic_load(&_reads);
+    uint32_t dropped = atomic_exchange(&_dropped, 0);
+    unsigned len;
+
+    stdio_write(hdr, sizeof(hdr));
+    while ((len = _read(pos, rec))) {
+        stdio_write(rec, len);
+        _consume(pos, len);
+        pos += len;
+    }
+    if (dropped) {
+        len = _encode(rec, TRACE_EVENT_DROPPED, _now(), 1, &dropped);
+        stdio_write(rec, len);
     }
 }
 
 void trace_reset(void)
 {
-    unsigned state = irq_disable();
+    uint8_t rec[TRACE_RECORD_MAXLEN];
+    uint32_t pos = atomic_load(&_reads);
+    unsigned len;
 
-    tracebuf_pos = 0;
-    irq_restore(state);
+    /* records still being written are left to the next call */
+    while ((len = _read(pos, rec))) {
+        _consume(pos, len);
+        pos += len;
+    }
+    atomic_store(&_dropped, 0);
 }
@@ -31,7 +31,11 @@
 #ifdef MODULE_PM_LAYERED
 #include "pm_layered.h"
 #endif
+#include "trace.h"
 #include "ztimer.h"
+#ifdef MODULE_ZTIMER_WHEEL
+#include "ztimer/wheel.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -41,6 +45,11 @@ static void _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry);
 static void _ztimer_update(ztimer_clock_t *clock);
 static void _ztimer_print(const ztimer_clock_t *clock);
 
+#ifdef MODULE_ZTIMER_WHEEL
+static ztimer_base_t *_wheel_add(ztimer_clock_t *clock, ztimer_base_t *entry);
+static bool _wheel_del(ztimer_clock_t *clock, ztimer_base_t *entry);
+#endif
+
 #ifdef MODULE_ZTIMER_EXTEND
 static inline uint32_t _min_u32(uint32_t a, uint32_t b)
 {
@@ -101,9 +110,23 @@ void ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
         val = 0;
     }
 
-    timer->base.offset = val;
-    _add_entry_to_list(clock, &timer->base);
-    if (clock->list.next == &timer->base) {
+    ztimer_base_t *entry = &timer->base;
+
+    entry->offset = val;
+#ifdef MODULE_ZTIMER_WHEEL
+    if (clock->wheel) {
+        /* timers beyond the current slot go to the wheel, which might in
+         * turn need its slot timer to be (re-)added to the list */
+        entry = _wheel_add(clock, entry);
+        if (!entry) {
+            irq_restore(state);
+            return;
+        }
+        val = entry->offset;
+    }
+#endif
+    _add_entry_to_list(clock, entry);
+    if (clock->list.next == entry) {
 #ifdef MODULE_ZTIMER_EXTEND
         if (clock->max_value < UINT32_MAX) {
             val = _min_u32(val, clock->max_value >> 1);
@@ -232,6 +255,12 @@ static void _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 
     assert(_is_set(clock, (ztimer_t *)entry));
 
+#ifdef MODULE_ZTIMER_WHEEL
+    if (clock->wheel && _wheel_del(clock, entry)) {
+        return;
+    }
+#endif
+
     while (list->next) {
         ztimer_base_t *list_entry = list->next;
         if (list_entry == entry) {
@@ -263,6 +292,155 @@ static void _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 #endif
 }
 
+#ifdef MODULE_ZTIMER_WHEEL
+/* Terminates all bucket chains. Using a marker instead of NULL makes every
+ * timer stored in a bucket have a non-NULL next pointer, so _is_set() works
+ * for them just like for timers in the sorted list. */
+static ztimer_base_t _wheel_end;
+
+static void _wheel_arm(ztimer_clock_t *clock, uint32_t now, uint32_t start)
+{
+    ztimer_wheel_t *wheel = clock->wheel;
+    int32_t diff = (int32_t)(start - now);
+
+    wheel->armed = true;
+    wheel->horizon = start;
+    wheel->slot_timer.base.offset = (diff > 0) ? (uint32_t)diff : 0;
+}
+
+static ztimer_base_t *_wheel_add(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    ztimer_wheel_t *wheel = clock->wheel;
+    uint32_t now = clock->list.offset;
+    uint32_t val = entry->offset;
+    uint32_t target = now + val;
+    /* ticks from now until the start of the target's slot */
+    uint32_t slot_start = (target & ~((1UL << wheel->shift) - 1)) - now;
+
+    if ((slot_start == 0) || (slot_start > val)) {
+        /* target is within the current slot, use the sorted list */
+        return entry;
+    }
+
+    /* buckets store the absolute target, wrapping like the list's base */
+    ztimer_base_t **bucket =
+        &wheel->buckets[(target >> wheel->shift) & wheel->mask];
+    entry->offset = target;
+    entry->next = *bucket;
+    *bucket = entry;
+
+    uint32_t pending = wheel->horizon - now;
+    if (wheel->armed && (((int32_t)pending <= 0) || (pending <= slot_start))) {
+        /* slot timer is due before (or at) the target's slot */
+        return NULL;
+    }
+
+    if (wheel->armed) {
+        _del_entry_from_list(clock, &wheel->slot_timer.base);
+    }
+
+    /* never look further ahead than one wheel revolution, so that the
+     * distance to the slot timer always fits into an int32_t */
+    uint32_t revolution = ((uint32_t)wheel->mask + 1) << wheel->shift;
+    uint32_t limit = (now & ~((1UL << wheel->shift) - 1)) + revolution - now;
+    _wheel_arm(clock, now, now + ((slot_start < limit) ? slot_start : limit));
+
+    DEBUG("_wheel_add(): %p slot timer at %" PRIu32 "\n", (void *)clock,
+          wheel->horizon);
+    return &wheel->slot_timer.base;
+}
+
+static bool _wheel_del(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    ztimer_wheel_t *wheel = clock->wheel;
+
+    if (entry == &wheel->slot_timer.base) {
+        return false;
+    }
+
+    /* for timers in the sorted list, offset is a delta and this will just
+     * search an unrelated bucket */
+    ztimer_base_t **prev =
+        &wheel->buckets[(entry->offset >> wheel->shift) & wheel->mask];
+    while (*prev != &_wheel_end) {
+        if (*prev == entry) {
+            *prev = entry->next;
+            entry->next = NULL;
+            return true;
+        }
+        prev = &(*prev)->next;
+    }
+    return false;
+}
+
+static void _wheel_advance(void *arg)
+{
+    ztimer_clock_t *clock = arg;
+    ztimer_wheel_t *wheel = clock->wheel;
+    uint32_t slot_len = 1UL << wheel->shift;
+    uint32_t horizon = wheel->horizon;
+
+    wheel->armed = false;
+    ztimer_update_head_offset(clock);
+    uint32_t now = clock->list.offset;
+
+    /* move timers targeting the slot starting at horizon to the sorted list,
+     * leaving those of later revolutions in the bucket */
+    ztimer_base_t **prev = &wheel->buckets[(horizon >> wheel->shift) &
+                                           wheel->mask];
+    while (*prev != &_wheel_end) {
+        ztimer_base_t *entry = *prev;
+        if ((entry->offset - horizon) < slot_len) {
+            int32_t diff = (int32_t)(entry->offset - now);
+            *prev = entry->next;
+            entry->offset = (diff > 0) ? (uint32_t)diff : 0;
+            _add_entry_to_list(clock, entry);
+        }
+        else {
+            prev = &entry->next;
+        }
+    }
+
+    /* set slot timer to the next non-empty bucket */
+    for (unsigned i = 1; i <= (unsigned)wheel->mask + 1; i++) {
+        uint32_t start = horizon + (i << wheel->shift);
+        if (wheel->buckets[(start >> wheel->shift) & wheel->mask] !=
+            &_wheel_end) {
+            _wheel_arm(clock, now, start);
+            _add_entry_to_list(clock, &wheel->slot_timer.base);
+            break;
+        }
+    }
+}
+
+void ztimer_wheel_init(ztimer_clock_t *clock, ztimer_wheel_t *wheel,
+                       ztimer_base_t **buckets, unsigned nbuckets,
+                       unsigned shift)
+{
+    /* nbuckets must be a power of two */
+    assert(nbuckets && !(nbuckets & (nbuckets - 1)));
+    assert(nbuckets <= UINT16_MAX + 1);
+    assert(((uint64_t)nbuckets << shift) <= (1UL << 30));
+    /* can only attach a wheel to a clock without active timers */
+    assert(!clock->list.next);
+
+    for (unsigned i = 0; i < nbuckets; i++) {
+        buckets[i] = &_wheel_end;
+    }
+
+    wheel->slot_timer.base.next = NULL;
+    wheel->slot_timer.callback = _wheel_advance;
+    wheel->slot_timer.arg = clock;
+    wheel->buckets = buckets;
+    wheel->horizon = 0;
+    wheel->mask = nbuckets - 1;
+    wheel->shift = shift;
+    wheel->armed = false;
+
+    clock->wheel = wheel;
+}
+#endif /* MODULE_ZTIMER_WHEEL */
+
 static ztimer_t *_now_next(ztimer_clock_t *clock)
 {
     ztimer_base_t *entry = clock->list.next;
@@ -319,6 +497,7 @@ static void _ztimer_update(ztimer_clock_t *clock)
 
 void ztimer_handler(ztimer_clock_t *clock)
 {
+    TRACE_POINT(TRACE_EVENT_ZTIMER, (uintptr_t)clock);
     DEBUG("ztimer_handler(): %p now=%" PRIu32 "\n", (void *)clock, clock->ops->now(
               clock));
     if (IS_ACTIVE(ENABLE_DEBUG)) {
@@ -362,6 +541,7 @@ void ztimer_handler(ztimer_clock_t *clock)
     while (entry) {
         DEBUG("ztimer_handler(): trigger %p->%p at %" PRIu32 "\n",
               (void *)entry, (void *)entry->base.next, clock->ops->now(clock));
+        TRACE_POINT(TRACE_EVENT_ZTIMER_CB, (uintptr_t)entry->callback);
         entry->callback(entry->arg);
         entry = _now_next(clock);
         if (!entry) {
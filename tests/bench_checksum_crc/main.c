@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for the CRC implementations
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "benchmark.h"
+#include "checksum/crc.h"
+#include "checksum/crc8.h"
+#include "checksum/crc16_ccitt.h"
+#include "checksum/ucrc16.h"
+#include "periph_conf.h"
+
+#ifndef DATA_LEN
+#define DATA_LEN    (1024U)
+#endif
+
+static uint8_t _in[DATA_LEN];
+static crc_engine_t _crc16;
+static crc_engine_t _crc32;
+static volatile uint32_t _res;
+
+static void _crc8(void *arg)
+{
+    (void)arg;
+    _res = crc8(_in, DATA_LEN, 0x31, 0xff);
+}
+
+static void _ucrc16(void *arg)
+{
+    (void)arg;
+    _res = ucrc16_calc_be(_in, DATA_LEN, UCRC16_CCITT_POLY_BE, 0x1d0f);
+}
+
+static void _crc16_ccitt(void *arg)
+{
+    (void)arg;
+    _res = crc16_ccitt_calc(_in, DATA_LEN);
+}
+
+static void _crc_crc16(void *arg)
+{
+    (void)arg;
+    _res = crc_calc(&_crc16, _in, DATA_LEN);
+}
+
+static void _crc_crc32(void *arg)
+{
+    (void)arg;
+    _res = crc_calc(&_crc32, _in, DATA_LEN);
+}
+
+#define STR(x)      #x
+#define XSTR(x)     STR(x)
+#define CASE(f)     { .name = #f, .param = XSTR(DATA_LEN), .func = _##f }
+
+static const benchmark_case_t _cases[] = {
+    CASE(crc8),
+    CASE(ucrc16),
+    CASE(crc16_ccitt),
+    CASE(crc_crc16),
+    CASE(crc_crc32),
+};
+
+static uint32_t _median[ARRAY_SIZE(_cases)];
+
+int main(void)
+{
+    for (unsigned i = 0; i < sizeof(_in); i++) {
+        _in[i] = i;
+    }
+    crc_engine_init(&_crc16, &crc_params_crc16_ccitt);
+    crc_engine_init(&_crc32, &crc_params_crc32);
+
+    benchmark_print_header();
+    for (unsigned i = 0; i < ARRAY_SIZE(_cases); i++) {
+        benchmark_result_t res;
+
+        benchmark_run(&_cases[i], &res);
+        benchmark_print_result(&_cases[i], &res);
+        _median[i] = res.median;
+    }
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_cases); i++) {
+        /* in thousandths */
+        uint64_t bytes = (uint64_t)DATA_LEN * 1000000LU;
+#ifdef CLOCK_CORECLOCK
+        uint32_t speed = (bytes * 1000) /
+                         ((uint64_t)_median[i] * (CLOCK_CORECLOCK / 1000));
+        const char *unit = "cycle";
+#else
+        uint32_t speed = bytes / _median[i];
+        const char *unit = "us";
+#endif
+        printf("%s: %" PRIu32 ".%03" PRIu32 " bytes/%s\n", _cases[i].name,
+               speed / 1000, speed % 1000, unit);
+    }
+
+    return 0;
+}
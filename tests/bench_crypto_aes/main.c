@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for the AES block cipher modes
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "benchmark.h"
+#include "crypto/ciphers.h"
+#include "crypto/modes/cbc.h"
+#include "crypto/modes/ccm.h"
+#include "crypto/modes/ctr.h"
+#include "crypto/modes/ecb.h"
+#include "crypto/modes/ocb.h"
+#include "periph_conf.h"
+
+#ifndef DATA_LEN
+#define DATA_LEN    (256U)
+#endif
+
+#define MAC_LEN     (16U)
+
+static const uint8_t _key[16] = {
+    0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+    0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c
+};
+static const uint8_t _nonce[13] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c
+};
+
+static cipher_t _cipher;
+static uint8_t _in[DATA_LEN];
+static uint8_t _out[DATA_LEN + MAC_LEN];
+static uint8_t _plain[DATA_LEN];
+
+static void _ecb_encrypt(void *arg)
+{
+    (void)arg;
+    cipher_encrypt_ecb(&_cipher, _in, DATA_LEN, _out);
+}
+
+static void _ecb_decrypt(void *arg)
+{
+    (void)arg;
+    cipher_decrypt_ecb(&_cipher, _in, DATA_LEN, _out);
+}
+
+static void _cbc_encrypt(void *arg)
+{
+    uint8_t iv[16] = { 0 };
+
+    (void)arg;
+    cipher_encrypt_cbc(&_cipher, iv, _in, DATA_LEN, _out);
+}
+
+static void _cbc_decrypt(void *arg)
+{
+    uint8_t iv[16] = { 0 };
+
+    (void)arg;
+    cipher_decrypt_cbc(&_cipher, iv, _in, DATA_LEN, _out);
+}
+
+static void _ctr_encrypt(void *arg)
+{
+    uint8_t ctr[16] = { 0 };
+
+    (void)arg;
+    memcpy(ctr, _nonce, sizeof(_nonce));
+    cipher_encrypt_ctr(&_cipher, ctr, sizeof(_nonce), _in, DATA_LEN, _out);
+}
+
+static void _ccm_encrypt(void *arg)
+{
+    (void)arg;
+    cipher_encrypt_ccm(&_cipher, NULL, 0, MAC_LEN, 2, _nonce, sizeof(_nonce),
+                       _in, DATA_LEN, _out);
+}
+
+static void _ccm_decrypt(void *arg)
+{
+    (void)arg;
+    /* decrypts the output of ccm_encrypt */
+    cipher_decrypt_ccm(&_cipher, NULL, 0, MAC_LEN, 2, _nonce, sizeof(_nonce),
+                       _out, DATA_LEN + MAC_LEN, _plain);
+}
+
+static void _ccm_stream(void *arg)
+{
+    cipher_ccm_t ccm;
+
+    (void)arg;
+    cipher_ccm_init(&ccm, &_cipher, NULL, 0, MAC_LEN, 2, _nonce,
+                    sizeof(_nonce), DATA_LEN);
+    /* e.g. a header and a payload in different buffers */
+    cipher_ccm_encrypt_update(&ccm, _in, 7, _out);
+    cipher_ccm_encrypt_update(&ccm, _in + 7, DATA_LEN - 7, _out + 7);
+    cipher_ccm_encrypt_finish(&ccm, _out + DATA_LEN);
+}
+
+static void _ocb_encrypt(void *arg)
+{
+    (void)arg;
+    cipher_encrypt_ocb(&_cipher, NULL, 0, MAC_LEN, _nonce, 12,
+                       _in, DATA_LEN, _out);
+}
+
+#define STR(x)      #x
+#define XSTR(x)     STR(x)
+#define CASE(f)     { .name = #f, .param = XSTR(DATA_LEN), .func = _##f }
+
+static const benchmark_case_t _cases[] = {
+    CASE(ecb_encrypt),
+    CASE(ecb_decrypt),
+    CASE(cbc_encrypt),
+    CASE(cbc_decrypt),
+    CASE(ctr_encrypt),
+    CASE(ccm_encrypt),
+    CASE(ccm_decrypt),
+    CASE(ccm_stream),
+    CASE(ocb_encrypt),
+};
+
+static uint32_t _median[ARRAY_SIZE(_cases)];
+
+int main(void)
+{
+    for (unsigned i = 0; i < sizeof(_in); i++) {
+        _in[i] = i;
+    }
+    cipher_init(&_cipher, CIPHER_AES_128, _key, sizeof(_key));
+
+    benchmark_print_header();
+    for (unsigned i = 0; i < ARRAY_SIZE(_cases); i++) {
+        benchmark_result_t res;
+
+        benchmark_run(&_cases[i], &res);
+        benchmark_print_result(&_cases[i], &res);
+        _median[i] = res.median;
+    }
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_cases); i++) {
+#ifdef CLOCK_CORECLOCK
+        uint32_t cost = ((uint64_t)_median[i] * (CLOCK_CORECLOCK / 1000)) /
+                        (1000000LU * DATA_LEN);
+        printf("%s: %" PRIu32 " cycles/byte\n", _cases[i].name, cost);
+#else
+        printf("%s: %" PRIu32 " ns/byte\n", _cases[i].name,
+               _median[i] / DATA_LEN);
+#endif
+    }
+
+    return 0;
+}
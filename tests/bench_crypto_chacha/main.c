@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for ChaCha
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "benchmark.h"
+#include "crypto/chacha.h"
+#include "crypto/chacha20poly1305.h"
+#include "periph_conf.h"
+
+#ifndef DATA_LEN
+#define DATA_LEN    (256U)
+#endif
+
+static const uint8_t _key[32] = {
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97,
+    0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f,
+};
+static const uint8_t _nonce[12] = {
+    0x00, 0x00, 0x00, 0x07, 0x40, 0x41, 0x42, 0x43,
+    0x44, 0x45, 0x46, 0x47,
+};
+
+static chacha_ctx _chacha20;
+static chacha_ctx _chacha8;
+static uint8_t _in[DATA_LEN];
+static uint8_t _out[DATA_LEN + CHACHA20POLY1305_TAG_BYTES];
+
+static void _chacha20_block(void *arg)
+{
+    (void)arg;
+    for (unsigned i = 0; i < DATA_LEN; i += 64) {
+        chacha_keystream_bytes(&_chacha20, &_out[i]);
+    }
+}
+
+static void _chacha20_blocks(void *arg)
+{
+    (void)arg;
+    chacha_keystream_blocks(&_chacha20, _out, DATA_LEN / 64);
+}
+
+static void _chacha8_blocks(void *arg)
+{
+    (void)arg;
+    chacha_keystream_blocks(&_chacha8, _out, DATA_LEN / 64);
+}
+
+static void _chacha20poly1305(void *arg)
+{
+    (void)arg;
+    chacha20poly1305_encrypt(_out, _in, DATA_LEN, NULL, 0, _key, _nonce);
+}
+
+static void _chacha_prng(void *arg)
+{
+    (void)arg;
+    for (unsigned i = 0; i < DATA_LEN; i += 4) {
+        uint32_t r = chacha_prng_next();
+
+        memcpy(&_out[i], &r, sizeof(r));
+    }
+}
+
+#define STR(x)      #x
+#define XSTR(x)     STR(x)
+#define CASE(f)     { .name = #f, .param = XSTR(DATA_LEN), .func = _##f }
+
+static const benchmark_case_t _cases[] = {
+    CASE(chacha20_block),
+    CASE(chacha20_blocks),
+    CASE(chacha8_blocks),
+    CASE(chacha20poly1305),
+    CASE(chacha_prng),
+};
+
+static uint32_t _median[ARRAY_SIZE(_cases)];
+
+int main(void)
+{
+    for (unsigned i = 0; i < sizeof(_in); i++) {
+        _in[i] = i;
+    }
+    chacha_init(&_chacha20, 20, _key, sizeof(_key), _nonce);
+    chacha_init(&_chacha8, 8, _key, sizeof(_key), _nonce);
+
+    benchmark_print_header();
+    for (unsigned i = 0; i < ARRAY_SIZE(_cases); i++) {
+        benchmark_result_t res;
+
+        benchmark_run(&_cases[i], &res);
+        benchmark_print_result(&_cases[i], &res);
+        _median[i] = res.median;
+    }
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_cases); i++) {
+#ifdef CLOCK_CORECLOCK
+        uint32_t cost = ((uint64_t)_median[i] * (CLOCK_CORECLOCK / 1000)) /
+                        (1000000LU * DATA_LEN);
+        printf("%s: %" PRIu32 " cycles/byte\n", _cases[i].name, cost);
+#else
+        printf("%s: %" PRIu32 " ns/byte\n", _cases[i].name,
+               _median[i] / DATA_LEN);
+#endif
+    }
+
+    return 0;
+}
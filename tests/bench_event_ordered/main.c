@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Dispatch latency of an urgent event in a FIFO and an ordered
+ *              event queue shared with slow events
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "event/ordered.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "ztimer.h"
+
+#ifndef ROUNDS
+#define ROUNDS                  (100U)
+#endif
+
+#ifndef SLOW_NUMOF
+#define SLOW_NUMOF              (4U)
+#endif
+
+/* runtime of a slow event handler */
+#ifndef SLOW_US
+#define SLOW_US                 (1000U)
+#endif
+
+#define SLOW_DEADLINE_US        (100000U)
+#define URGENT_DEADLINE_US      (100U)
+/* the urgent event is posted while the first slow event is handled */
+#define URGENT_DELAY_US         (SLOW_US / 2)
+
+#define THREAD_FLAG_DONE        (0x2)
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static thread_t *_main;
+
+static event_queue_t _queues[2];
+static event_queue_t *_queue;
+static event_ordered_t _slow[SLOW_NUMOF];
+static event_ordered_t _urgent;
+static ztimer_t _timer;
+
+static unsigned _pending;
+static uint32_t _posted;
+static uint32_t _latency_max;
+static uint32_t _latency_sum;
+
+static void _done(void)
+{
+    if (--_pending == 0) {
+        thread_flags_set(_main, THREAD_FLAG_DONE);
+    }
+}
+
+static void _slow_handler(event_t *event)
+{
+    (void)event;
+    ztimer_spin(ZTIMER_USEC, SLOW_US);
+    _done();
+}
+
+static void _urgent_handler(event_t *event)
+{
+    (void)event;
+    uint32_t latency = ztimer_now(ZTIMER_USEC) - _posted;
+
+    _latency_sum += latency;
+    if (latency > _latency_max) {
+        _latency_max = latency;
+    }
+    _done();
+}
+
+static void _post_urgent(void *arg)
+{
+    (void)arg;
+    _posted = ztimer_now(ZTIMER_USEC);
+    _urgent.key = _posted + URGENT_DEADLINE_US;
+    event_post(_queue, &_urgent.super);
+}
+
+static void *_thread(void *arg)
+{
+    (void)arg;
+    event_queues_claim(_queues, ARRAY_SIZE(_queues));
+    event_loop_multi(_queues, ARRAY_SIZE(_queues));
+    return NULL;
+}
+
+static void _bench(const char *name, event_queue_t *queue)
+{
+    _queue = queue;
+    _latency_max = 0;
+    _latency_sum = 0;
+
+    for (unsigned round = 0; round < ROUNDS; round++) {
+        uint32_t now = ztimer_now(ZTIMER_USEC);
+
+        _pending = SLOW_NUMOF + 1;
+        /* the handler thread has a lower priority, so all slow events are
+         * queued before the first one is handled */
+        for (unsigned i = 0; i < SLOW_NUMOF; i++) {
+            _slow[i].key = now + SLOW_DEADLINE_US;
+            event_post(queue, &_slow[i].super);
+        }
+        ztimer_set(ZTIMER_USEC, &_timer, URGENT_DELAY_US);
+        thread_flags_wait_any(THREAD_FLAG_DONE);
+    }
+
+    printf("{ \"queue\" : \"%s\", \"rounds\" : %u, \"latency_max_us\" : %"
+           PRIu32 ", \"latency_mean_us\" : %" PRIu32 " }\n",
+           name, ROUNDS, _latency_max, _latency_sum / ROUNDS);
+}
+
+int main(void)
+{
+    _main = thread_get_active();
+    _timer.callback = _post_urgent;
+    _urgent.super.handler = _urgent_handler;
+    for (unsigned i = 0; i < SLOW_NUMOF; i++) {
+        _slow[i].super.handler = _slow_handler;
+    }
+
+    event_queue_init_detached(&_queues[0]);
+    event_queue_init_ordered_detached(&_queues[1]);
+    thread_create(_stack, sizeof(_stack), THREAD_PRIORITY_MAIN + 1,
+                  THREAD_CREATE_STACKTEST, _thread, NULL, "handler");
+
+    _bench("fifo", &_queues[0]);
+    _bench("ordered", &_queues[1]);
+
+    puts("DONE");
+
+    return 0;
+}
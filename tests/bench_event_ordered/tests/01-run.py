@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2021 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for queue in ("fifo", "ordered"):
+        child.expect(r"{ \"queue\" : \"" + queue + r"\", \"rounds\" : \d+, "
+                     r"\"latency_max_us\" : \d+, \"latency_mean_us\" : \d+ }")
+    child.expect_exact("DONE")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Time to handle events with pools of different sizes
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "event/pool.h"
+#include "irq.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "ztimer.h"
+
+#ifndef EVENTS_NUMOF
+#define EVENTS_NUMOF            (16U)
+#endif
+
+/* runtime of an event handler */
+#ifndef HANDLER_US
+#define HANDLER_US              (1000U)
+#endif
+
+#define THREAD_FLAG_DONE        (0x2)
+
+static char _stacks[1 + 2 + 4][THREAD_STACKSIZE_DEFAULT];
+static event_pool_t _pools[3];
+static thread_t *_main;
+static unsigned _pending;
+
+static void _done(void)
+{
+    unsigned state = irq_disable();
+    unsigned pending = --_pending;
+    irq_restore(state);
+
+    if (pending == 0) {
+        thread_flags_set(_main, THREAD_FLAG_DONE);
+    }
+}
+
+/* blocks like a handler waiting for a peripheral */
+static void _sleep_handler(event_t *event)
+{
+    (void)event;
+    ztimer_sleep(ZTIMER_USEC, HANDLER_US);
+    _done();
+}
+
+/* keeps the CPU busy */
+static void _spin_handler(event_t *event)
+{
+    (void)event;
+    ztimer_spin(ZTIMER_USEC, HANDLER_US);
+    _done();
+}
+
+static void _bench(const char *name, event_handler_t handler,
+                   event_pool_t *pool, unsigned workers)
+{
+    static event_t events[EVENTS_NUMOF];
+
+    _pending = EVENTS_NUMOF;
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    /* the workers have a lower priority, so all events are queued before
+     * the first one is handled */
+    for (unsigned i = 0; i < EVENTS_NUMOF; i++) {
+        events[i].handler = handler;
+        event_post(&pool->queue, &events[i]);
+    }
+    thread_flags_wait_any(THREAD_FLAG_DONE);
+    uint32_t time = ztimer_now(ZTIMER_USEC) - start;
+
+    printf("{ \"handler\" : \"%s\", \"workers\" : %u, \"events\" : %u, "
+           "\"time_us\" : %" PRIu32 " }\n",
+           name, workers, EVENTS_NUMOF, time);
+}
+
+int main(void)
+{
+    static const unsigned workers[] = { 1, 2, 4 };
+    char *stack = &_stacks[0][0];
+
+    _main = thread_get_active();
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_pools); i++) {
+        event_pool_init(&_pools[i], stack, sizeof(_stacks[0]), workers[i],
+                        THREAD_PRIORITY_MAIN + 1);
+        stack += workers[i] * sizeof(_stacks[0]);
+    }
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_pools); i++) {
+        _bench("sleep", _sleep_handler, &_pools[i], workers[i]);
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(_pools); i++) {
+        _bench("spin", _spin_handler, &_pools[i], workers[i]);
+    }
+
+    puts("DONE");
+
+    return 0;
+}
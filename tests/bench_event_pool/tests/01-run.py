@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2021 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for handler in ("sleep", "spin"):
+        for workers in (1, 2, 4):
+            child.expect(r"{{ \"handler\" : \"{}\", \"workers\" : {}, "
+                         r"\"events\" : \d+, \"time_us\" : \d+ }}"
+                         .format(handler, workers))
+    child.expect_exact("DONE")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
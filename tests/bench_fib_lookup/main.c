@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       FIB linear search vs. longest prefix match trie benchmark
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <string.h>
+
+#include "net/fib.h"
+#include "random.h"
+#include "xtimer.h"
+
+#ifndef ENTRIES_MAX
+#define ENTRIES_MAX         (256U)
+#endif
+
+#ifndef TEST_RUNS
+#define TEST_RUNS           (10000U)
+#endif
+
+#define ADDR_SIZE           (16U)
+#define LIFETIME_MS         (3600U * MS_PER_SEC)
+
+static fib_entry_t _entries[ENTRIES_MAX];
+static fib_trie_node_t _nodes[FIB_TRIE_NODES_NUMOF(ENTRIES_MAX)];
+static fib_table_t _table = { .data.entries = _entries,
+                              .table_type = FIB_TABLE_TYPE_SH,
+                              .mtx_access = MUTEX_INIT };
+
+static uint8_t _prefixes[ENTRIES_MAX][ADDR_SIZE];
+static uint8_t _prefix_lens[ENTRIES_MAX];
+static uint8_t _dsts[ENTRIES_MAX][ADDR_SIZE];
+
+/* a random address covered by the given prefix */
+static void _gen_dst(uint8_t *dst, unsigned idx)
+{
+    unsigned len = _prefix_lens[idx];
+
+    random_bytes(dst, ADDR_SIZE);
+    memcpy(dst, _prefixes[idx], len >> 3);
+    if (len & 0x7) {
+        uint8_t mask = 0xff << (8 - (len & 0x7));
+        dst[len >> 3] = (_prefixes[idx][len >> 3] & mask) |
+                        (dst[len >> 3] & ~mask);
+    }
+}
+
+static void _gen_prefixes(unsigned numof)
+{
+    for (unsigned i = 0; i < numof; i++) {
+        random_bytes(_prefixes[i], ADDR_SIZE);
+        /* 2001:db8::/32 */
+        _prefixes[i][0] = 0x20;
+        _prefixes[i][1] = 0x01;
+        _prefixes[i][2] = 0x0d;
+        _prefixes[i][3] = 0xb8;
+        _prefix_lens[i] = random_uint32_range(33, 129);
+    }
+    for (unsigned i = 0; i < numof; i++) {
+        _gen_dst(_dsts[i], random_uint32_range(0, numof));
+    }
+}
+
+static uint32_t _bench(fib_trie_node_t *nodes, unsigned numof)
+{
+    uint8_t next_hop[ADDR_SIZE] = { 0xfe, 0x80 };
+
+    _table.size = numof;
+    _table.trie_nodes = nodes;
+    fib_init(&_table);
+
+    for (unsigned i = 0; i < numof; i++) {
+        next_hop[15] = i;
+        fib_add_entry(&_table, 1, _prefixes[i], ADDR_SIZE,
+                      _prefix_lens[i] << FIB_FLAG_NET_PREFIX_SHIFT,
+                      next_hop, ADDR_SIZE, 0, LIFETIME_MS);
+    }
+
+    uint32_t start = xtimer_now_usec();
+    for (unsigned i = 0; i < TEST_RUNS; i++) {
+        kernel_pid_t iface;
+        size_t next_hop_size = sizeof(next_hop);
+        uint32_t next_hop_flags;
+
+        fib_get_next_hop(&_table, &iface, next_hop, &next_hop_size,
+                         &next_hop_flags, _dsts[i % numof], ADDR_SIZE, 0);
+    }
+    uint32_t time = xtimer_now_usec() - start;
+
+    fib_deinit(&_table);
+
+    return (uint32_t)(((uint64_t)time * 1000) / TEST_RUNS);
+}
+
+int main(void)
+{
+    for (unsigned numof = 16; numof <= ENTRIES_MAX; numof *= 4) {
+        random_init(numof);
+        _gen_prefixes(numof);
+        uint32_t linear_ns = _bench(NULL, numof);
+        uint32_t trie_ns = _bench(_nodes, numof);
+        printf("{ \"entries\" : %u, \"linear_ns\" : %" PRIu32 ", "
+               "\"trie_ns\" : %" PRIu32 " }\n", numof, linear_ns, trie_ns);
+    }
+
+    puts("DONE");
+
+    return 0;
+}
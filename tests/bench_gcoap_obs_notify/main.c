@@ -0,0 +1,152 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for notifying many observers of a resource with gcoap
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/gcoap.h"
+#include "ztimer.h"
+
+#ifndef TEST_RUNS
+#define TEST_RUNS           (20U)
+#endif
+
+#define OBSERVER_PORT_BASE  (20000U)
+
+static const char _payload[] = "{ \"temperature\" : 2342 }";
+
+static ssize_t _value_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                              void *ctx)
+{
+    (void)ctx;
+    gcoap_resp_init(pdu, buf, len, COAP_CODE_CONTENT);
+    coap_opt_add_format(pdu, COAP_FORMAT_JSON);
+    size_t resp_len = coap_opt_finish(pdu, COAP_OPT_FINISH_PAYLOAD);
+
+    memcpy(pdu->payload, _payload, sizeof(_payload) - 1);
+    return resp_len + sizeof(_payload) - 1;
+}
+
+static const coap_resource_t _resources[] = {
+    { "/value", COAP_GET, _value_handler, NULL },
+};
+
+static gcoap_listener_t _listener = {
+    &_resources[0],
+    ARRAY_SIZE(_resources),
+    NULL,
+    NULL,
+    NULL
+};
+
+static uint8_t _buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+
+/* registers from a port of its own */
+static void _register(unsigned num)
+{
+    sock_udp_ep_t local = { .family = AF_INET6,
+                            .port = OBSERVER_PORT_BASE + num };
+    sock_udp_ep_t remote = { .family = AF_INET6,
+                             .addr = { .ipv6 = { [15] = 1 } },
+                             .port = CONFIG_GCOAP_PORT };
+    sock_udp_t sock;
+    coap_pkt_t pdu;
+    ssize_t len;
+
+    gcoap_req_init(&pdu, _buf, sizeof(_buf), COAP_METHOD_GET, NULL);
+    coap_opt_add_uint(&pdu, COAP_OPT_OBSERVE, COAP_OBS_REGISTER);
+    coap_opt_add_uri_path(&pdu, "/value");
+    len = coap_opt_finish(&pdu, COAP_OPT_FINISH_NONE);
+    if (sock_udp_create(&sock, &local, NULL, 0) < 0) {
+        puts("unable to create sock");
+        return;
+    }
+    sock_udp_send(&sock, _buf, len, &remote);
+    /* the response must be taken from the sock before closing it */
+    len = sock_udp_recv(&sock, _buf, sizeof(_buf), 100 * US_PER_MS, NULL);
+    if ((len <= 0) || (coap_parse(&pdu, _buf, len) < 0) ||
+        !coap_has_observe(&pdu)) {
+        printf("registration %u failed\n", num);
+    }
+    sock_udp_close(&sock);
+}
+
+static ssize_t _encode(coap_pkt_t *pdu)
+{
+    if (gcoap_obs_notify_init(pdu, _buf, sizeof(_buf),
+                              &_resources[0]) != GCOAP_OBS_INIT_OK) {
+        return -1;
+    }
+    coap_opt_add_format(pdu, COAP_FORMAT_JSON);
+    size_t len = coap_opt_finish(pdu, COAP_OPT_FINISH_PAYLOAD);
+
+    memcpy(pdu->payload, _payload, sizeof(_payload) - 1);
+    return len + sizeof(_payload) - 1;
+}
+
+static void _bench(unsigned observers)
+{
+    uint32_t encode_time = 0, notify_time = 0;
+    unsigned notified = 0;
+
+    for (unsigned i = 0; i < TEST_RUNS; i++) {
+        coap_pkt_t pdu;
+        uint32_t start = ztimer_now(ZTIMER_USEC);
+        ssize_t len = _encode(&pdu);
+        uint32_t encoded = ztimer_now(ZTIMER_USEC);
+
+        if (len < 0) {
+            puts("unable to encode notification");
+            return;
+        }
+        notified = gcoap_obs_notify(&pdu, len, &_resources[0]);
+        notify_time += ztimer_now(ZTIMER_USEC) - encoded;
+        encode_time += encoded - start;
+    }
+    notify_time /= TEST_RUNS;
+    printf("{ \"observers\" : %u, \"notified\" : %u, "
+           "\"encode_ns\" : %" PRIu32 ", \"notify_ns\" : %" PRIu32 ", "
+           "\"per_s\" : %" PRIu32 " }\n", observers, notified,
+           (uint32_t)(((uint64_t)encode_time * 1000) / TEST_RUNS),
+           (uint32_t)(((uint64_t)notify_time * 1000) / observers),
+           (uint32_t)(((uint64_t)observers * US_PER_SEC) /
+                      ((notify_time) ? notify_time : 1)));
+}
+
+int main(void)
+{
+    static const unsigned numofs[] = {
+        1, 16, CONFIG_GCOAP_OBS_REGISTRATIONS_MAX / 4,
+        CONFIG_GCOAP_OBS_REGISTRATIONS_MAX
+    };
+    unsigned registered = 0;
+
+    gcoap_register_listener(&_listener);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(numofs); i++) {
+        while (registered < numofs[i]) {
+            _register(registered++);
+        }
+        _bench(registered);
+    }
+
+    puts("DONE");
+
+    return 0;
+}
@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2021 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for _ in range(4):
+        child.expect(r"{ \"observers\" : (\d+), \"notified\" : (\d+), "
+                     r"\"encode_ns\" : \d+, \"notify_ns\" : \d+, "
+                     r"\"per_s\" : \d+ }")
+        assert child.match.group(1) == child.match.group(2)
+    child.expect_exact("DONE")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=60))
@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for SHA-256
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "benchmark.h"
+#include "hashes/sha256.h"
+#include "periph_conf.h"
+
+#ifndef DATA_LEN
+#define DATA_LEN    (1024U)
+#endif
+
+#define PARTS       (4U)
+#define PART_LEN    (DATA_LEN / PARTS)
+
+static const uint8_t _key[32] = { 0x01, 0x02, 0x03, 0x04 };
+
+static uint8_t _in[DATA_LEN];
+static uint8_t _digests[PARTS][SHA256_DIGEST_LENGTH];
+
+static void _sha256(void *arg)
+{
+    (void)arg;
+    sha256(_in, DATA_LEN, _digests[0]);
+}
+
+static void _sha256_update(void *arg)
+{
+    sha256_context_t ctx;
+
+    (void)arg;
+    sha256_init(&ctx);
+    for (unsigned i = 0; i < DATA_LEN; i += 64) {
+        sha256_update(&ctx, &_in[i], 64);
+    }
+    sha256_final(&ctx, _digests[0]);
+}
+
+static void _sha256_4x(void *arg)
+{
+    (void)arg;
+    for (unsigned i = 0; i < PARTS; i++) {
+        sha256(&_in[i * PART_LEN], PART_LEN, _digests[i]);
+    }
+}
+
+static void _sha256_multi(void *arg)
+{
+    const void *data[PARTS];
+    void *digests[PARTS];
+
+    (void)arg;
+    for (unsigned i = 0; i < PARTS; i++) {
+        data[i] = &_in[i * PART_LEN];
+        digests[i] = _digests[i];
+    }
+    sha256_multi(data, PART_LEN, digests, PARTS);
+}
+
+static void _hmac_sha256(void *arg)
+{
+    (void)arg;
+    hmac_sha256(_key, sizeof(_key), _in, DATA_LEN, _digests[0]);
+}
+
+#define STR(x)      #x
+#define XSTR(x)     STR(x)
+#define CASE(f)     { .name = #f, .param = XSTR(DATA_LEN), .func = _##f }
+
+static const benchmark_case_t _cases[] = {
+    CASE(sha256),
+    CASE(sha256_update),
+    CASE(sha256_4x),
+    CASE(sha256_multi),
+    CASE(hmac_sha256),
+};
+
+static uint32_t _median[ARRAY_SIZE(_cases)];
+
+int main(void)
+{
+    for (unsigned i = 0; i < sizeof(_in); i++) {
+        _in[i] = i;
+    }
+
+    benchmark_print_header();
+    for (unsigned i = 0; i < ARRAY_SIZE(_cases); i++) {
+        benchmark_result_t res;
+
+        benchmark_run(&_cases[i], &res);
+        benchmark_print_result(&_cases[i], &res);
+        _median[i] = res.median;
+    }
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_cases); i++) {
+#ifdef CLOCK_CORECLOCK
+        uint32_t cost = ((uint64_t)_median[i] * (CLOCK_CORECLOCK / 1000)) /
+                        (1000000LU * DATA_LEN);
+        printf("%s: %" PRIu32 " cycles/byte\n", _cases[i].name, cost);
+#else
+        printf("%s: %" PRIu32 " ns/byte\n", _cases[i].name,
+               _median[i] / DATA_LEN);
+#endif
+    }
+
+    return 0;
+}
@@ -0,0 +1,26 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2021 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+CASES = ("sha256", "sha256_update", "sha256_4x", "sha256_multi",
+         "hmac_sha256")
+
+
+def testfunc(child):
+    child.expect_exact("name,param,iterations,samples,"
+                       "min_ns,median_ns,p99_ns,max_ns,mean_ns\r\n")
+    for case in CASES:
+        child.expect(case + r",1024,\d+(,\d+){6}\r\n")
+    for case in CASES:
+        child.expect(case + r": \d+ (cycles|ns)/byte\r\n")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Internet checksum runtime benchmark
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "benchmark.h"
+#include "net/inet_csum.h"
+
+#define BUF_SIZE            (4096U)
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (10U)
+#endif
+
+typedef struct {
+    uint16_t len;
+    uint8_t offset;
+} csum_param_t;
+
+static uint8_t _buf[BUF_SIZE + 4];
+static volatile uint16_t _sum;
+
+static const csum_param_t _params[] = {
+    { 64, 0 }, { 64, 1 }, { 1280, 0 }, { 1280, 1 },
+    { BUF_SIZE, 0 }, { BUF_SIZE, 1 },
+};
+
+/* the former implementation, one 16 bit word per iteration */
+static uint16_t _csum_bytewise(uint16_t sum, const uint8_t *buf, uint16_t len)
+{
+    uint32_t csum = sum;
+
+    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
+        csum += (uint16_t)(*buf << 8) + *(buf + 1);
+    }
+    if (len & 1) {
+        csum += (uint16_t)(*buf << 8);
+    }
+    while (csum >> 16) {
+        csum = (csum & 0xffff) + (csum >> 16);
+    }
+    return csum;
+}
+
+static void _bench_bytewise(void *arg)
+{
+    const csum_param_t *p = arg;
+
+    _sum = _csum_bytewise(0, &_buf[p->offset], p->len);
+}
+
+static void _bench_inet_csum(void *arg)
+{
+    const csum_param_t *p = arg;
+
+    _sum = inet_csum(0, &_buf[p->offset], p->len);
+}
+
+#define CASES(name, func) \
+    { name, "64/0", func, (void *)&_params[0], BENCH_RUNS }, \
+    { name, "64/1", func, (void *)&_params[1], BENCH_RUNS }, \
+    { name, "1280/0", func, (void *)&_params[2], BENCH_RUNS }, \
+    { name, "1280/1", func, (void *)&_params[3], BENCH_RUNS }, \
+    { name, "4096/0", func, (void *)&_params[4], BENCH_RUNS }, \
+    { name, "4096/1", func, (void *)&_params[5], BENCH_RUNS }
+
+static const benchmark_case_t _cases[] = {
+    CASES("bytewise", _bench_bytewise),
+    CASES("inet_csum", _bench_inet_csum),
+};
+
+int main(void)
+{
+    for (unsigned i = 0; i < sizeof(_buf); i++) {
+        _buf[i] = (i * 13) ^ (i >> 3);
+    }
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_params); i++) {
+        const uint8_t *buf = &_buf[_params[i].offset];
+        uint16_t sum = inet_csum(0, buf, _params[i].len);
+        uint16_t sum_bytewise = _csum_bytewise(0, buf, _params[i].len);
+
+        if (sum != sum_bytewise) {
+            printf("checksum mismatch: 0x%04x != 0x%04x\n", sum, sum_bytewise);
+        }
+    }
+
+    benchmark_run_all(_cases, ARRAY_SIZE(_cases));
+
+    puts("DONE");
+
+    return 0;
+}
@@ -0,0 +1,24 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2021 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("name,param,iterations,samples,"
+                       "min_ns,median_ns,p99_ns,max_ns,mean_ns")
+    for name in ("bytewise", "inet_csum"):
+        for _ in range(6):
+            child.expect(name + r",\d+/\d,\d+(,\d+){6}")
+    child.expect_exact("benchmark: 12 cases run")
+    child.expect_exact("DONE")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -11,7 +11,7 @@
  * @{
  *
  * @file
- * @brief       Measure messages send per second
+ * @brief       Measure messages send per second, one by one and in batches
  *
  * @author      Kaspar Schleiser <kaspar@schleiser.de>
  *
@@ -29,8 +29,15 @@
 #define TEST_DURATION       (1000000U)
 #endif
 
+/* number of messages sent and received at once in the batched run, must be
+ * a power of two as it is also used as message queue size */
+#ifndef BATCH_SIZE
+#define BATCH_SIZE          (8U)
+#endif
+
 volatile unsigned _flag = 0;
 static char _stack[THREAD_STACKSIZE_MAIN];
+static char _batch_stack[THREAD_STACKSIZE_MAIN];
 
 static void _timer_callback(void*arg)
 {
@@ -51,6 +58,32 @@ static void *_second_thread(void *arg)
     return NULL;
 }
 
+static void *_batch_thread(void *arg)
+{
+    (void)arg;
+    /* the first message of a batch is copied directly, the others queued */
+    msg_t queue[BATCH_SIZE];
+    msg_t test[BATCH_SIZE];
+
+    msg_init_queue(queue, BATCH_SIZE);
+
+    while(1) {
+        msg_receive_many(test, BATCH_SIZE);
+    }
+
+    return NULL;
+}
+
+static void _print_result(uint32_t n)
+{
+    printf("\"result\" : %"PRIu32, n);
+#ifdef CLOCK_CORECLOCK
+    printf(", \"ticks\" : %"PRIu32,
+           (uint32_t)((TEST_DURATION/US_PER_MS) * (CLOCK_CORECLOCK/KHZ(1)))/n);
+#endif
+    puts(" }");
+}
+
 int main(void)
 {
     printf("main starting\n");
@@ -76,12 +109,30 @@ int main(void)
         n++;
     }
 
-    printf("{ \"result\" : %"PRIu32, n);
-#ifdef CLOCK_CORECLOCK
-    printf(", \"ticks\" : %"PRIu32,
-           (uint32_t)((TEST_DURATION/US_PER_MS) * (CLOCK_CORECLOCK/KHZ(1)))/n);
-#endif
-    puts(" }");
+    printf("{ ");
+    _print_result(n);
+
+    other = thread_create(_batch_stack,
+                          sizeof(_batch_stack),
+                          (THREAD_PRIORITY_MAIN - 1),
+                          THREAD_CREATE_STACKTEST,
+                          _batch_thread,
+                          NULL,
+                          "batch_thread");
+
+    msg_t batch[BATCH_SIZE];
+
+    n = 0;
+    _flag = 0;
+
+    xtimer_set(&timer, TEST_DURATION);
+    while(!_flag) {
+        msg_send_many(batch, BATCH_SIZE, other);
+        n += BATCH_SIZE;
+    }
+
+    printf("{ \"batch\" : %u, ", BATCH_SIZE);
+    _print_result(n);
 
     return 0;
 }
@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for the time a high priority thread waits for a
+ *              mutex held by a low priority thread
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "kernel_defines.h"
+#include "mutex.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef TEST_RUNS
+#define TEST_RUNS           (50U)
+#endif
+
+/* time the low priority thread holds the mutex */
+#ifndef WORK_US
+#define WORK_US             (1000U)
+#endif
+
+/* time the medium priority thread keeps the CPU busy */
+#ifndef BUSY_US
+#define BUSY_US             (10000U)
+#endif
+
+static char _stack_low[THREAD_STACKSIZE_DEFAULT];
+static char _stack_mid[THREAD_STACKSIZE_DEFAULT];
+static mutex_t _mutex = MUTEX_INIT;
+
+static void _spin(uint32_t us)
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    while ((ztimer_now(ZTIMER_USEC) - start) < us) {}
+}
+
+static void *_low(void *arg)
+{
+    (void)arg;
+    while (1) {
+        mutex_lock(&_mutex);
+        _spin(WORK_US);
+        mutex_unlock(&_mutex);
+        thread_sleep();
+    }
+    return NULL;
+}
+
+static void *_mid(void *arg)
+{
+    (void)arg;
+    while (1) {
+        _spin(BUSY_US);
+        thread_sleep();
+    }
+    return NULL;
+}
+
+int main(void)
+{
+    uint32_t min = UINT32_MAX, max = 0;
+    uint64_t sum = 0;
+
+    /* both start sleeping, main wakes them up when needed */
+    kernel_pid_t low = thread_create(_stack_low, sizeof(_stack_low),
+                                     THREAD_PRIORITY_MAIN + 2,
+                                     THREAD_CREATE_SLEEPING |
+                                     THREAD_CREATE_STACKTEST,
+                                     _low, NULL, "low");
+    kernel_pid_t mid = thread_create(_stack_mid, sizeof(_stack_mid),
+                                     THREAD_PRIORITY_MAIN + 1,
+                                     THREAD_CREATE_SLEEPING |
+                                     THREAD_CREATE_STACKTEST,
+                                     _mid, NULL, "mid");
+
+    for (unsigned i = 0; i < TEST_RUNS; i++) {
+        thread_wakeup(low);
+        /* low locks the mutex in the meantime */
+        ztimer_sleep(ZTIMER_USEC, WORK_US / 2);
+        thread_wakeup(mid);
+
+        uint32_t start = ztimer_now(ZTIMER_USEC);
+        mutex_lock(&_mutex);
+        uint32_t wait = ztimer_now(ZTIMER_USEC) - start;
+        mutex_unlock(&_mutex);
+
+        min = (wait < min) ? wait : min;
+        max = (wait > max) ? wait : max;
+        sum += wait;
+        /* let low and mid go back to sleep */
+        ztimer_sleep(ZTIMER_USEC, BUSY_US + WORK_US);
+    }
+
+    printf("{ \"pi\" : %u, \"work_us\" : %u, \"busy_us\" : %u, "
+           "\"min_us\" : %" PRIu32 ", \"avg_us\" : %" PRIu32 ", "
+           "\"max_us\" : %" PRIu32 " }\n",
+           IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE), WORK_US, BUSY_US,
+           min, (uint32_t)(sum / TEST_RUNS), max);
+
+    puts("DONE");
+
+    return 0;
+}
@@ -0,0 +1,27 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2021 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"{ \"pi\" : ([01]), \"work_us\" : \d+, "
+                 r"\"busy_us\" : (\d+), \"min_us\" : \d+, "
+                 r"\"avg_us\" : \d+, \"max_us\" : (\d+) }")
+    pi = int(child.match.group(1))
+    busy_us = int(child.match.group(2))
+    max_us = int(child.match.group(3))
+    if pi:
+        # waiting must not include the busy time of the medium thread
+        assert max_us < busy_us, "wait not bound by the work of the holder"
+    child.expect_exact("DONE")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
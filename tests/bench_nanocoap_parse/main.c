@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for parsing and handling CoAP requests with nanocoap
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "kernel_defines.h"
+#include "net/nanocoap.h"
+#include "ztimer.h"
+
+#ifndef TEST_RUNS
+#define TEST_RUNS           (10000U)
+#endif
+
+#define BUF_SIZE            (128U)
+
+static const char _payload[] = "{ \"temperature\" : 2342 }";
+static unsigned _errors;
+
+static ssize_t _temp_handler(coap_pkt_t *pkt, uint8_t *buf, size_t len,
+                             void *ctx)
+{
+    char query[CONFIG_NANOCOAP_URI_MAX];
+    coap_block1_t block;
+    uint32_t accept = COAP_FORMAT_NONE;
+
+    (void)ctx;
+    if ((coap_get_uri_query(pkt, (uint8_t *)query) <= 0) ||
+        (strcmp(query, "&unit=c") != 0)) {
+        _errors++;
+    }
+    if (coap_get_content_type(pkt) != COAP_FORMAT_TEXT) {
+        _errors++;
+    }
+    if ((coap_opt_get_uint(pkt, COAP_OPT_ACCEPT, &accept) < 0) ||
+        (accept != COAP_FORMAT_JSON)) {
+        _errors++;
+    }
+    if (!coap_get_block2(pkt, &block) || (block.blknum != 1)) {
+        _errors++;
+    }
+    return coap_reply_simple(pkt, COAP_CODE_CHANGED, buf, len,
+                             COAP_FORMAT_JSON, (uint8_t *)_payload,
+                             sizeof(_payload) - 1);
+}
+
+static ssize_t _dummy_handler(coap_pkt_t *pkt, uint8_t *buf, size_t len,
+                              void *ctx)
+{
+    (void)ctx;
+    _errors++;
+    return coap_reply_simple(pkt, COAP_CODE_204, buf, len, COAP_FORMAT_NONE,
+                             NULL, 0);
+}
+
+const coap_resource_t coap_resources[] = {
+    { "/sensor/hum", COAP_GET, _dummy_handler, NULL },
+    { "/sensor/press", COAP_GET, _dummy_handler, NULL },
+    { "/sensor/temp", COAP_POST, _temp_handler, NULL },
+};
+
+const unsigned coap_resources_numof = ARRAY_SIZE(coap_resources);
+
+static uint8_t _req[BUF_SIZE];
+static uint8_t _resp[BUF_SIZE];
+static size_t _req_len;
+
+static size_t _build_req(void)
+{
+    static const char text[] = "23.42";
+    uint8_t token[2] = { 0xDA, 0xEC };
+    coap_pkt_t pkt;
+    size_t len;
+
+    len = coap_build_hdr((coap_hdr_t *)_req, COAP_TYPE_NON, token,
+                         sizeof(token), COAP_METHOD_POST, 0x4242);
+    coap_pkt_init(&pkt, _req, sizeof(_req), len);
+    coap_opt_add_uri_path(&pkt, "/sensor/temp");
+    coap_opt_add_format(&pkt, COAP_FORMAT_TEXT);
+    coap_opt_add_uri_query(&pkt, "unit", "c");
+    coap_opt_add_uint(&pkt, COAP_OPT_ACCEPT, COAP_FORMAT_JSON);
+    coap_opt_add_uint(&pkt, COAP_OPT_BLOCK2, (1 << 4) | 2);
+    len = coap_opt_finish(&pkt, COAP_OPT_FINISH_PAYLOAD);
+    memcpy(pkt.payload, text, sizeof(text) - 1);
+    return len + sizeof(text) - 1;
+}
+
+static uint32_t _ns(uint32_t time)
+{
+    return (uint32_t)(((uint64_t)time * 1000) / TEST_RUNS);
+}
+
+/* reading the timer may take as long as parsing, so parsing is timed on its
+ * own and taken out of the time for parsing and handling */
+static uint32_t _bench(bool handle)
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    for (unsigned i = 0; i < TEST_RUNS; i++) {
+        coap_pkt_t pkt;
+
+        if (coap_parse(&pkt, _req, _req_len) < 0) {
+            _errors++;
+        }
+        else if (handle && (coap_handle_req(&pkt, _resp, sizeof(_resp)) <= 0)) {
+            _errors++;
+        }
+    }
+    return ztimer_now(ZTIMER_USEC) - start;
+}
+
+int main(void)
+{
+    uint32_t parse_time, handle_time;
+
+    _req_len = _build_req();
+    parse_time = _bench(false);
+    handle_time = _bench(true) - parse_time;
+    if (_errors) {
+        printf("%u errors\n", _errors);
+    }
+    printf("{ \"opt_index\" : %u, \"parse_ns\" : %" PRIu32 ", "
+           "\"handle_ns\" : %" PRIu32 " }\n",
+           IS_USED(MODULE_NANOCOAP_OPT_INDEX), _ns(parse_time),
+           _ns(handle_time));
+
+    puts("DONE");
+
+    return 0;
+}
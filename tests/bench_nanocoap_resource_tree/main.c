@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for the resource lookup of nanocoap
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "kernel_defines.h"
+#include "net/nanocoap.h"
+#include "ztimer.h"
+
+#ifndef TEST_RUNS
+#define TEST_RUNS           (100U)
+#endif
+
+#define NODES               (10U)   /* /node/00/ .. /node/09/ */
+#define SENSORS             (15U)   /* s00 .. s14 */
+#define RES_NUMOF           (NODES * (SENSORS + 1) + 2)
+
+static char _paths[RES_NUMOF][16];
+static coap_resource_t _res[RES_NUMOF];
+static coap_resource_tree_node_t _nodes[COAP_RESOURCE_TREE_NODES_NUMOF(RES_NUMOF)];
+static coap_resource_tree_t _tree = {
+    .nodes = _nodes,
+};
+static unsigned _errors;
+
+/* sorted resources: a firmware subtree, and a POST-only subtree next to the
+ * GET resources of each node */
+static void _setup(void)
+{
+    unsigned n = 0;
+
+    strcpy(_paths[n], "/fw/");
+    _res[n].methods = COAP_PUT | COAP_MATCH_SUBTREE;
+    n++;
+    for (unsigned i = 0; i < NODES; i++) {
+        sprintf(_paths[n], "/node/%02u/", i);
+        _res[n].methods = COAP_POST | COAP_MATCH_SUBTREE;
+        n++;
+        for (unsigned j = 0; j < SENSORS; j++) {
+            sprintf(_paths[n], "/node/%02u/s%02u", i, j);
+            _res[n].methods = COAP_GET;
+            n++;
+        }
+    }
+    strcpy(_paths[n], "/node/10");
+    _res[n].methods = COAP_GET | COAP_PUT;
+    n++;
+    for (unsigned i = 0; i < n; i++) {
+        _res[i].path = _paths[i];
+    }
+}
+
+/* what coap_tree_handler() does */
+static const coap_resource_t *_linear_find(const char *uri, unsigned method)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_res); i++) {
+        if (!(_res[i].methods & method)) {
+            continue;
+        }
+        int res = coap_match_path(&_res[i], (uint8_t *)uri);
+        if (res == 0) {
+            return &_res[i];
+        }
+        else if (res < 0) {
+            break;
+        }
+    }
+    return NULL;
+}
+
+static const coap_resource_t *_tree_find(const char *uri, unsigned method)
+{
+    const coap_resource_t *resource;
+
+    if (coap_resource_tree_find(&_tree, uri, method, &resource) < 0) {
+        return NULL;
+    }
+    return resource;
+}
+
+/* smallest node storage the tree fits in */
+static unsigned _nodes_needed(void)
+{
+    for (unsigned n = 1; n < ARRAY_SIZE(_nodes); n++) {
+        _tree.nodes_numof = n;
+        if (coap_resource_tree_init(&_tree, _res, ARRAY_SIZE(_res)) == 0) {
+            return n;
+        }
+    }
+    _tree.nodes_numof = ARRAY_SIZE(_nodes);
+    if (coap_resource_tree_init(&_tree, _res, ARRAY_SIZE(_res)) < 0) {
+        _errors++;
+    }
+    return ARRAY_SIZE(_nodes);
+}
+
+static uint32_t _bench(const coap_resource_t *(*find)(const char *, unsigned))
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    for (unsigned run = 0; run < TEST_RUNS; run++) {
+        for (unsigned i = 0; i < ARRAY_SIZE(_res); i++) {
+            /* only the subtrees do not allow GET, requests to them are
+             * matched by the resource itself */
+            if (find(_paths[i], COAP_GET) == NULL) {
+                _errors += !!(_res[i].methods & COAP_GET);
+            }
+        }
+    }
+    return ztimer_now(ZTIMER_USEC) - start;
+}
+
+static uint32_t _ns(uint32_t time)
+{
+    return (uint32_t)(((uint64_t)time * 1000) / (TEST_RUNS * RES_NUMOF));
+}
+
+int main(void)
+{
+    uint32_t linear, tree;
+    unsigned nodes;
+
+    _setup();
+    nodes = _nodes_needed();
+    linear = _bench(_linear_find);
+    tree = _bench(_tree_find);
+    if (_errors) {
+        printf("%u errors\n", _errors);
+    }
+    printf("{ \"resources\" : %u, \"nodes\" : %u, \"linear_ns\" : %" PRIu32 ", "
+           "\"tree_ns\" : %" PRIu32 " }\n", RES_NUMOF, nodes, _ns(linear),
+           _ns(tree));
+
+    puts("DONE");
+
+    return 0;
+}
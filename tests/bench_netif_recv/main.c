@@ -0,0 +1,286 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for receiving frames with and without copying them
+ *              from the device
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/gnrc.h"
+#include "net/gnrc/netif/ieee802154.h"
+#include "net/netdev/ieee802154.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef TEST_RUNS
+#define TEST_RUNS           (10000U)
+#endif
+
+#define TEST_LQI            (0x42)
+
+static netdev_ieee802154_t _dev;
+static gnrc_netif_t _netif;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+
+/* simulated radio: the frame is "received" into _rx_cur, the device's own
+ * buffer unless one was provided by the upper layer, PHR first */
+static uint8_t _rxbuf[NETDEV_IEEE802154_RX_BUF_SIZE];
+static uint8_t *_rx_cur = _rxbuf;
+static uint8_t *_rx_next[GNRC_NETIF_RX_BUF_NUMOF];
+static bool _rx_complete;
+
+static uint8_t _frame[IEEE802154_FRAME_LEN_MAX - IEEE802154_FCS_LEN];
+static size_t _frame_len;
+static size_t _mhr_len;
+
+static void _dma_rx(void)
+{
+    _rx_cur[0] = _frame_len + IEEE802154_FCS_LEN;
+    memcpy(&_rx_cur[1], _frame, _frame_len);
+    _rx_cur[_frame_len + 1] = TEST_LQI;
+    _rx_complete = true;
+}
+
+static void _reset_rx(void)
+{
+    if ((_rx_cur == _rxbuf) && (_rx_next[0] != NULL)) {
+        _rx_cur = _rx_next[0];
+        memmove(&_rx_next[0], &_rx_next[1],
+                sizeof(_rx_next) - sizeof(_rx_next[0]));
+        _rx_next[ARRAY_SIZE(_rx_next) - 1] = NULL;
+    }
+    _rx_complete = false;
+}
+
+static int _init(netdev_t *dev)
+{
+    (void)dev;
+    return 0;
+}
+
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    (void)dev;
+    return iolist_size(iolist);
+}
+
+static int _recv(netdev_t *dev, void *buf, size_t len, void *info)
+{
+    (void)dev;
+    size_t pktlen = _rx_cur[0] - IEEE802154_FCS_LEN;
+
+    if (!_rx_complete) {
+        return 0;
+    }
+    if (buf == NULL) {
+        if (len == 0) {
+            return pktlen;
+        }
+    }
+    else if (len < pktlen) {
+        return -ENOBUFS;
+    }
+    else {
+        memcpy(buf, &_rx_cur[1], pktlen);
+        if (info != NULL) {
+            ((netdev_ieee802154_rx_info_t *)info)->lqi = _rx_cur[pktlen + 1];
+        }
+    }
+    _reset_rx();
+    return pktlen;
+}
+
+static int _rx_buf_push(netdev_t *dev, void *buf, size_t len)
+{
+    (void)dev;
+
+    if (len < sizeof(_rxbuf)) {
+        return -ENOBUFS;
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(_rx_next); i++) {
+        if (_rx_next[i] == NULL) {
+            _rx_next[i] = buf;
+            return 0;
+        }
+    }
+    return -EBUSY;
+}
+
+static int _recv_buf(netdev_t *dev, void **buf, size_t *offset, void *info)
+{
+    (void)dev;
+    size_t pktlen = _rx_cur[0] - IEEE802154_FCS_LEN;
+
+    if (!_rx_complete) {
+        return 0;
+    }
+    if (_rx_cur == _rxbuf) {
+        return -ENOBUFS;
+    }
+    if (info != NULL) {
+        ((netdev_ieee802154_rx_info_t *)info)->lqi = _rx_cur[pktlen + 1];
+    }
+    *buf = _rx_cur;
+    *offset = 1;
+    _rx_cur = _rxbuf;
+    _reset_rx();
+    return pktlen;
+}
+
+static void _isr(netdev_t *dev)
+{
+    (void)dev;
+}
+
+static int _get(netdev_t *dev, netopt_t opt, void *value, size_t max_len)
+{
+    return netdev_ieee802154_get((netdev_ieee802154_t *)dev, opt, value,
+                                 max_len);
+}
+
+static int _set(netdev_t *dev, netopt_t opt, const void *value,
+                size_t value_len)
+{
+    return netdev_ieee802154_set((netdev_ieee802154_t *)dev, opt, value,
+                                 value_len);
+}
+
+static const netdev_driver_t _driver_copy = {
+    .send = _send,
+    .recv = _recv,
+    .init = _init,
+    .isr = _isr,
+    .get = _get,
+    .set = _set,
+};
+
+static const netdev_driver_t _driver_zero_copy = {
+    .send = _send,
+    .recv = _recv,
+    .rx_buf_push = _rx_buf_push,
+    .recv_buf = _recv_buf,
+    .init = _init,
+    .isr = _isr,
+    .get = _get,
+    .set = _set,
+};
+
+static void _set_frame(size_t payload_len)
+{
+    static const uint8_t src[] = { 0x12, 0x34 };
+    static const uint8_t dst[] = { 0x56, 0x78 };
+    le_uint16_t pan = byteorder_htols(CONFIG_IEEE802154_DEFAULT_PANID);
+
+    _mhr_len = ieee802154_set_frame_hdr(_frame, src, sizeof(src),
+                                        dst, sizeof(dst), pan, pan,
+                                        IEEE802154_FCF_TYPE_DATA, 0);
+    for (unsigned i = 0; i < payload_len; i++) {
+        _frame[_mhr_len + i] = i;
+    }
+    _frame_len = _mhr_len + payload_len;
+}
+
+static bool _check(gnrc_pktsnip_t *pkt)
+{
+    gnrc_netif_hdr_t *hdr;
+
+    if ((pkt == NULL) || (pkt->next == NULL) ||
+        (pkt->next->type != GNRC_NETTYPE_NETIF)) {
+        return false;
+    }
+    hdr = pkt->next->data;
+    return (pkt->size == (_frame_len - _mhr_len)) &&
+           (memcmp(pkt->data, &_frame[_mhr_len], pkt->size) == 0) &&
+           (hdr->lqi == TEST_LQI);
+}
+
+static uint32_t _bench(const netdev_driver_t *driver)
+{
+    uint32_t start;
+
+    _dev.netdev.driver = driver;
+    /* have buffers provided to the device before measuring */
+    for (unsigned i = 0; i < GNRC_NETIF_RX_BUF_NUMOF + 1; i++) {
+        _dma_rx();
+        gnrc_pktbuf_release(_netif.ops->recv(&_netif));
+    }
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < TEST_RUNS; i++) {
+        gnrc_pktsnip_t *pkt;
+
+        _dma_rx();
+        pkt = _netif.ops->recv(&_netif);
+        if (!_check(pkt)) {
+            printf("unexpected packet received with %s\n",
+                   (driver == &_driver_copy) ? "copy" : "zero copy");
+        }
+        gnrc_pktbuf_release(pkt);
+    }
+    return ztimer_now(ZTIMER_USEC) - start;
+}
+
+static uint32_t _ns(uint32_t time)
+{
+    return (uint32_t)(((uint64_t)time * 1000) / TEST_RUNS);
+}
+
+int main(void)
+{
+    static const uint16_t lens[] = { 8, 48, 96 };
+
+    _dev.netdev.driver = &_driver_copy;
+    netdev_register(&_dev.netdev, NETDEV_ANY, 0);
+    netdev_ieee802154_reset(&_dev);
+    if (gnrc_netif_ieee802154_create(&_netif, _netif_stack,
+                                     sizeof(_netif_stack), GNRC_NETIF_PRIO,
+                                     "bench", &_dev.netdev) < 0) {
+        puts("unable to create interface");
+        return 1;
+    }
+
+    for (unsigned i = 0; i < ARRAY_SIZE(lens); i++) {
+        uint32_t dma_time, copy_time, zero_copy_time;
+
+        _set_frame(lens[i]);
+        /* the simulated reception is part of both loops, take it out */
+        dma_time = ztimer_now(ZTIMER_USEC);
+        for (unsigned j = 0; j < TEST_RUNS; j++) {
+            _dma_rx();
+            _reset_rx();
+        }
+        dma_time = ztimer_now(ZTIMER_USEC) - dma_time;
+        copy_time = _bench(&_driver_copy);
+        zero_copy_time = _bench(&_driver_zero_copy);
+        /* hand the buffers held by the device back for the next run */
+        _rx_cur = _rxbuf;
+        memset(_rx_next, 0, sizeof(_rx_next));
+        for (unsigned j = 0; j < GNRC_NETIF_RX_BUF_NUMOF; j++) {
+            gnrc_pktbuf_release(_netif.rx_bufs[j]);
+            _netif.rx_bufs[j] = NULL;
+        }
+        printf("{ \"len\" : %u, \"copy_ns\" : %" PRIu32 ", "
+               "\"zero_copy_ns\" : %" PRIu32 " }\n", (unsigned)_frame_len,
+               _ns(copy_time - dma_time), _ns(zero_copy_time - dma_time));
+    }
+
+    puts("DONE");
+
+    return 0;
+}
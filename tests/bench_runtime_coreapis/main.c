@@ -26,7 +26,7 @@
 #include "thread_flags.h"
 
 #ifndef BENCH_RUNS
-#define BENCH_RUNS          (1000UL * 1000UL)
+#define BENCH_RUNS          (1000UL)
 #endif
 
 static mutex_t _lock;
@@ -34,49 +34,97 @@ static thread_t *t;
 static thread_flags_t _flag = 0x0001;
 static msg_t _msg;
 
-static void _mutex_lockunlock(void)
+static void _nop(void *arg)
 {
+    (void)arg;
+    __asm__ volatile ("nop");
+}
+
+static void _mutex_init(void *arg)
+{
+    (void)arg;
+    mutex_init(&_lock);
+}
+
+static void _mutex_lockunlock(void *arg)
+{
+    (void)arg;
     mutex_lock(&_lock);
     mutex_unlock(&_lock);
 }
 
-static void _flag_waitany(void)
+static void _flag_set(void *arg)
+{
+    (void)arg;
+    thread_flags_set(t, _flag);
+}
+
+static void _flag_clear(void *arg)
 {
+    (void)arg;
+    thread_flags_clear(_flag);
+}
+
+static void _flag_waitany(void *arg)
+{
+    (void)arg;
     thread_flags_set(t, _flag);
     thread_flags_wait_any(_flag);
 }
 
-static void _flag_waitall(void)
+static void _flag_waitall(void *arg)
 {
+    (void)arg;
     thread_flags_set(t, _flag);
     thread_flags_wait_all(_flag);
 }
 
-static void _flag_waitone(void)
+static void _flag_waitone(void *arg)
 {
+    (void)arg;
     thread_flags_set(t, _flag);
     thread_flags_wait_one(_flag);
 }
 
+static void _msg_try_receive(void *arg)
+{
+    (void)arg;
+    msg_try_receive(&_msg);
+}
+
+static void _msg_avail(void *arg)
+{
+    (void)arg;
+    msg_avail();
+}
+
+static const benchmark_case_t _cases[] = {
+    { .name = "nop loop", .func = _nop, .iterations = BENCH_RUNS },
+    { .name = "mutex_init()", .func = _mutex_init, .iterations = BENCH_RUNS },
+    { .name = "mutex lock/unlock", .func = _mutex_lockunlock,
+      .iterations = BENCH_RUNS },
+    { .name = "thread_flags_set()", .func = _flag_set,
+      .iterations = BENCH_RUNS },
+    { .name = "thread_flags_clear()", .func = _flag_clear,
+      .iterations = BENCH_RUNS },
+    { .name = "thread flags set/wait any", .func = _flag_waitany,
+      .iterations = BENCH_RUNS },
+    { .name = "thread flags set/wait all", .func = _flag_waitall,
+      .iterations = BENCH_RUNS },
+    { .name = "thread flags set/wait one", .func = _flag_waitone,
+      .iterations = BENCH_RUNS },
+    { .name = "msg_try_receive()", .func = _msg_try_receive,
+      .iterations = BENCH_RUNS },
+    { .name = "msg_avail()", .func = _msg_avail, .iterations = BENCH_RUNS },
+};
+
 int main(void)
 {
     puts("Runtime of Selected Core API functions\n");
 
     t = thread_get_active();
 
-    BENCHMARK_FUNC("nop loop", BENCH_RUNS, __asm__ volatile ("nop"));
-    puts("");
-    BENCHMARK_FUNC("mutex_init()", BENCH_RUNS, mutex_init(&_lock));
-    BENCHMARK_FUNC("mutex lock/unlock", BENCH_RUNS, _mutex_lockunlock());
-    puts("");
-    BENCHMARK_FUNC("thread_flags_set()", BENCH_RUNS, thread_flags_set(t, _flag));
-    BENCHMARK_FUNC("thread_flags_clear()", BENCH_RUNS, thread_flags_clear(_flag));
-    BENCHMARK_FUNC("thread flags set/wait any", BENCH_RUNS, _flag_waitany());
-    BENCHMARK_FUNC("thread flags set/wait all", BENCH_RUNS, _flag_waitall());
-    BENCHMARK_FUNC("thread flags set/wait one", BENCH_RUNS, _flag_waitone());
-    puts("");
-    BENCHMARK_FUNC("msg_try_receive()", BENCH_RUNS, msg_try_receive(&_msg));
-    BENCHMARK_FUNC("msg_avail()", BENCH_RUNS, msg_avail());
+    benchmark_run_all(_cases, ARRAY_SIZE(_cases));
 
     puts("\n[SUCCESS]");
     return 0;
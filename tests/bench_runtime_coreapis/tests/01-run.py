@@ -11,22 +11,29 @@ from testrunner import run
 
 
 # The default timeout is not enough for this test on some of the slower boards
-TIMEOUT = 30
-BENCHMARK_REGEXP = r"\s+{func}:\s+\d+us\s+---\s+\d*\.*\d+us per call\s+---\s+\d+ calls per sec"
+TIMEOUT = 60
+BENCHMARK_REGEXP = r"{func},,\d+(,\d+){{6}}"
+FUNCS = [
+    "nop loop",
+    r"mutex_init\(\)",
+    "mutex lock/unlock",
+    r"thread_flags_set\(\)",
+    r"thread_flags_clear\(\)",
+    "thread flags set/wait any",
+    "thread flags set/wait all",
+    "thread flags set/wait one",
+    r"msg_try_receive\(\)",
+    r"msg_avail\(\)",
+]
 
 
 def testfunc(child):
     child.expect_exact('Runtime of Selected Core API functions')
-    child.expect(BENCHMARK_REGEXP.format(func="nop loop"))
-    child.expect(BENCHMARK_REGEXP.format(func=r"mutex_init\(\)"))
-    child.expect(BENCHMARK_REGEXP.format(func="mutex lock/unlock"), timeout=TIMEOUT)
-    child.expect(BENCHMARK_REGEXP.format(func=r"thread_flags_set\(\)"))
-    child.expect(BENCHMARK_REGEXP.format(func=r"thread_flags_clear\(\)"))
-    child.expect(BENCHMARK_REGEXP.format(func="thread flags set/wait any"), timeout=TIMEOUT)
-    child.expect(BENCHMARK_REGEXP.format(func="thread flags set/wait all"), timeout=TIMEOUT)
-    child.expect(BENCHMARK_REGEXP.format(func="thread flags set/wait one"), timeout=TIMEOUT)
-    child.expect(BENCHMARK_REGEXP.format(func=r"msg_try_receive\(\)"), timeout=TIMEOUT)
-    child.expect(BENCHMARK_REGEXP.format(func=r"msg_avail\(\)"))
+    child.expect_exact('name,param,iterations,samples,'
+                       'min_ns,median_ns,p99_ns,max_ns,mean_ns')
+    for func in FUNCS:
+        child.expect(BENCHMARK_REGEXP.format(func=func), timeout=TIMEOUT)
+    child.expect_exact('benchmark: {} cases run'.format(len(FUNCS)))
     child.expect_exact('[SUCCESS]')
 
 
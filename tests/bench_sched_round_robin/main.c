@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for fairness and overhead of round robin scheduling
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "kernel_defines.h"
+#include "sched_round_robin.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef TEST_DURATION_US
+#define TEST_DURATION_US    (1000000U)
+#endif
+
+#ifndef WORKERS
+#define WORKERS             (3U)
+#endif
+
+static char _stacks[WORKERS][THREAD_STACKSIZE_DEFAULT];
+static volatile uint32_t _counts[WORKERS];
+
+static void *_worker(void *arg)
+{
+    volatile uint32_t *count = arg;
+
+    while (1) {
+        (*count)++;
+    }
+    return NULL;
+}
+
+int main(void)
+{
+    kernel_pid_t workers[WORKERS];
+    uint32_t min = UINT32_MAX, max = 0;
+    uint64_t total = 0;
+
+    /* workers run only while main sleeps */
+    for (unsigned i = 0; i < WORKERS; i++) {
+        workers[i] = thread_create(_stacks[i], sizeof(_stacks[i]),
+                                   THREAD_PRIORITY_MAIN + 1,
+                                   THREAD_CREATE_SLEEPING |
+                                   THREAD_CREATE_STACKTEST,
+                                   _worker, (void *)&_counts[i], "worker");
+    }
+
+    thread_wakeup(workers[0]);
+    ztimer_sleep(ZTIMER_USEC, TEST_DURATION_US);
+    uint32_t single = _counts[0];
+
+    _counts[0] = 0;
+    for (unsigned i = 1; i < WORKERS; i++) {
+        thread_wakeup(workers[i]);
+    }
+    ztimer_sleep(ZTIMER_USEC, TEST_DURATION_US);
+
+    for (unsigned i = 0; i < WORKERS; i++) {
+        uint32_t count = _counts[i];
+
+        min = (count < min) ? count : min;
+        max = (count > max) ? count : max;
+        total += count;
+    }
+
+    printf("{ \"rr\" : %u, \"quantum_us\" : %u, \"workers\" : %u, "
+           "\"min\" : %" PRIu32 ", \"max\" : %" PRIu32 ", "
+           "\"fairness\" : %" PRIu32 ", \"overhead_ppm\" : %" PRIi32 " }\n",
+           IS_USED(MODULE_SCHED_ROUND_ROBIN), CONFIG_SCHED_RR_QUANTUM_US,
+           WORKERS, min, max,
+           (uint32_t)(((uint64_t)min * 100) / (max ? max : 1)),
+           (int32_t)((((int64_t)single - (int64_t)total) * 1000000) /
+                     (single ? single : 1)));
+
+    puts("DONE");
+
+    return 0;
+}
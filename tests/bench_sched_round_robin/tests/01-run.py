@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2021 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"{ \"rr\" : ([01]), \"quantum_us\" : \d+, "
+                 r"\"workers\" : \d+, \"min\" : \d+, \"max\" : \d+, "
+                 r"\"fairness\" : (\d+), \"overhead_ppm\" : -?\d+ }")
+    if int(child.match.group(1)):
+        assert int(child.match.group(2)) >= 50, "workers not served fairly"
+    child.expect_exact("DONE")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
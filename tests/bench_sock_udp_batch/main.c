@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for sending and receiving UDP datagrams one by one
+ *              and in batches
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/sock/udp.h"
+#include "ztimer.h"
+
+#ifndef TEST_RUNS
+#define TEST_RUNS           (500U)
+#endif
+
+/* the sock's mailbox must be able to take a whole batch */
+#define BATCH_SIZE          (GNRC_SOCK_MBOX_SIZE)
+#define TEST_PORT           (0x4242)
+#define MAX_LEN             (128U)
+
+static sock_udp_t _sock;
+static uint8_t _tx_buf[MAX_LEN];
+static uint8_t _rx_bufs[BATCH_SIZE][MAX_LEN];
+static sock_udp_dgram_t _tx[BATCH_SIZE];
+static sock_udp_dgram_t _rx[BATCH_SIZE];
+static sock_udp_ep_t _remote = { .family = AF_INET6,
+                                 .addr = { .ipv6 = { [15] = 1 } },
+                                 .port = TEST_PORT };
+
+/* the stack's threads have a higher priority than main, so all datagrams
+ * already wait in the sock's mailbox once sending returns */
+static unsigned _single(size_t len)
+{
+    unsigned received = 0;
+
+    for (unsigned i = 0; i < BATCH_SIZE; i++) {
+        sock_udp_send(&_sock, _tx_buf, len, &_remote);
+    }
+    for (unsigned i = 0; i < BATCH_SIZE; i++) {
+        if (sock_udp_recv(&_sock, _rx_bufs[i], MAX_LEN, 0, NULL) > 0) {
+            received++;
+        }
+    }
+    return BATCH_SIZE - received;
+}
+
+static unsigned _many(size_t len)
+{
+    int received;
+
+    for (unsigned i = 0; i < BATCH_SIZE; i++) {
+        _tx[i].len = len;
+        _rx[i].len = MAX_LEN;
+    }
+    sock_udp_send_many(&_sock, _tx, BATCH_SIZE);
+    received = sock_udp_recv_many(&_sock, _rx, BATCH_SIZE, 0);
+    return BATCH_SIZE - ((received > 0) ? received : 0);
+}
+
+static uint32_t _bench(unsigned (*fn)(size_t), size_t len, unsigned *lost)
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    for (unsigned i = 0; i < TEST_RUNS; i++) {
+        *lost += fn(len);
+    }
+    return ztimer_now(ZTIMER_USEC) - start;
+}
+
+static uint32_t _ns(uint32_t time)
+{
+    return (uint32_t)(((uint64_t)time * 1000) / (TEST_RUNS * BATCH_SIZE));
+}
+
+int main(void)
+{
+    static const uint16_t lens[] = { 8, 48, MAX_LEN };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = TEST_PORT };
+
+    if (sock_udp_create(&_sock, &local, NULL, 0) < 0) {
+        puts("unable to create sock");
+        return 1;
+    }
+    for (unsigned i = 0; i < sizeof(_tx_buf); i++) {
+        _tx_buf[i] = i;
+    }
+    for (unsigned i = 0; i < BATCH_SIZE; i++) {
+        _tx[i].data = _tx_buf;
+        _tx[i].remote = &_remote;
+        _rx[i].data = _rx_bufs[i];
+        _rx[i].remote = NULL;
+    }
+
+    for (unsigned i = 0; i < ARRAY_SIZE(lens); i++) {
+        uint32_t single_time, many_time;
+        unsigned lost = 0;
+
+        single_time = _bench(_single, lens[i], &lost);
+        many_time = _bench(_many, lens[i], &lost);
+        if (lost) {
+            printf("%u datagrams lost with length %u\n", lost, lens[i]);
+        }
+        printf("{ \"len\" : %u, \"single_ns\" : %" PRIu32 ", "
+               "\"many_ns\" : %" PRIu32 " }\n", lens[i], _ns(single_time),
+               _ns(many_time));
+    }
+
+    puts("DONE");
+
+    return 0;
+}
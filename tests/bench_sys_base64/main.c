@@ -22,8 +22,8 @@
 #include <string.h>
 
 #include "base64.h"
+#include "benchmark.h"
 #include "fmt.h"
-#include "xtimer.h"
 
 #define MIN(a, b) (a < b) ? a : b
 
@@ -36,8 +36,30 @@ static const char base64[128] =
 "VGhpcyBpcyBhbiBleHRyZW1lbHksIGVub3Jtb3VzbHksIGdyZWF0bHksIGltbWVuc2VseSwgdHJl"
 "bWVuZG91c2x5LCByZW1hcmthYmx5IGxlbmd0aHkgc2VudGVuY2Uh";
 
+static void _encode(void *arg)
+{
+    size_t size = sizeof(buf);
+
+    (void)arg;
+    base64_encode(input, sizeof(input), buf, &size);
+}
+
+static void _decode(void *arg)
+{
+    size_t size = sizeof(buf);
+
+    (void)arg;
+    base64_decode(base64, sizeof(base64), buf, &size);
+}
+
+static const benchmark_case_t _cases[] = {
+    { .name = "base64_encode", .param = "96", .func = _encode,
+      .iterations = 10 },
+    { .name = "base64_decode", .param = "128", .func = _decode,
+      .iterations = 10 },
+};
+
 int main(void) {
-    uint32_t start, stop;
     size_t size;
 
     /* We don't want check return value in the benchmark loop, so we just do
@@ -74,26 +96,6 @@ int main(void) {
         print_str("OK\n");
     }
 
-    start = xtimer_now_usec();
-    for (unsigned i = 0; i < 1000; i++) {
-        size = sizeof(buf);
-        base64_encode(input, sizeof(input), buf, &size);
-    }
-    stop = xtimer_now_usec();
-
-    print_str("Encoding 1.000 x 96 bytes (128 bytes in base64): ");
-    print_u32_dec(stop - start);
-    print_str(" µs\n");
-
-    start = xtimer_now_usec();
-    for (unsigned i = 0; i < 1000; i++) {
-        size = sizeof(buf);
-        base64_decode(base64, sizeof(base64), buf, &size);
-    }
-    stop = xtimer_now_usec();
-
-    print_str("Decoding 1.000 x 96 bytes (128 bytes in base64): ");
-    print_u32_dec(stop - start);
-    print_str(" µs\n");
+    benchmark_run_all(_cases, ARRAY_SIZE(_cases));
     return 0;
 }
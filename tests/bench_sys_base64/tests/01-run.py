@@ -13,8 +13,11 @@ from testrunner import run
 def testfunc(child):
     child.expect_exact("Verifying that base64 encoding works for benchmark input: OK\r\n")
     child.expect_exact("Verifying that base64 decoding works for benchmark input: OK\r\n")
-    child.expect(r"Encoding 1\.000 x 96 bytes \(128 bytes in base64\): [0-9]+ µs\r\n")
-    child.expect(r"Decoding 1\.000 x 96 bytes \(128 bytes in base64\): [0-9]+ µs\r\n")
+    child.expect_exact("name,param,iterations,samples,"
+                       "min_ns,median_ns,p99_ns,max_ns,mean_ns\r\n")
+    child.expect(r"base64_encode,96,\d+(,\d+){6}\r\n")
+    child.expect(r"base64_decode,128,\d+(,\d+){6}\r\n")
+    child.expect_exact("benchmark: 2 cases run\r\n")
 
 
 if __name__ == "__main__":
@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       ztimer list vs. hashed timer wheel benchmark
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <inttypes.h>
+
+#include "random.h"
+#include "ztimer.h"
+#include "ztimer/mock.h"
+#include "ztimer/wheel.h"
+
+#ifndef TIMERS_MAX
+#define TIMERS_MAX          (1000U)
+#endif
+
+#ifndef TEST_RUNS
+#define TEST_RUNS           (10000U)
+#endif
+
+/* timers are set up to 2^20 ticks into the future */
+#define TIMEOUT_RANGE       (1UL << 20)
+
+/* 256 slots of 2^12 ticks cover the whole range */
+#define WHEEL_BUCKETS       (256U)
+#define WHEEL_SHIFT         (12U)
+
+static ztimer_mock_t _list_clock;
+static ztimer_mock_t _wheel_clock;
+static ztimer_wheel_t _wheel;
+static ztimer_base_t *_buckets[WHEEL_BUCKETS];
+static ztimer_t _timers[TIMERS_MAX];
+
+static void _cb(void *arg)
+{
+    (void)arg;
+}
+
+static uint32_t _bench(ztimer_clock_t *clock, unsigned numof)
+{
+    random_init(numof);
+
+    for (unsigned i = 0; i < numof; i++) {
+        _timers[i].callback = _cb;
+        ztimer_set(clock, &_timers[i], random_uint32_range(1, TIMEOUT_RANGE));
+    }
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < TEST_RUNS; i++) {
+        ztimer_t *timer = &_timers[random_uint32_range(0, numof)];
+        ztimer_remove(clock, timer);
+        ztimer_set(clock, timer, random_uint32_range(1, TIMEOUT_RANGE));
+    }
+    uint32_t time = ztimer_now(ZTIMER_USEC) - start;
+
+    for (unsigned i = 0; i < numof; i++) {
+        ztimer_remove(clock, &_timers[i]);
+    }
+
+    return (uint32_t)(((uint64_t)time * 1000) / TEST_RUNS);
+}
+
+int main(void)
+{
+    ztimer_mock_init(&_list_clock, 32);
+    ztimer_mock_init(&_wheel_clock, 32);
+    ztimer_wheel_init(&_wheel_clock.super, &_wheel, _buckets, WHEEL_BUCKETS,
+                      WHEEL_SHIFT);
+
+    for (unsigned numof = 10; numof <= TIMERS_MAX; numof *= 10) {
+        uint32_t list_ns = _bench(&_list_clock.super, numof);
+        uint32_t wheel_ns = _bench(&_wheel_clock.super, numof);
+        printf("{ \"timers\" : %u, \"list_ns\" : %" PRIu32 ", "
+               "\"wheel_ns\" : %" PRIu32 " }\n", numof, list_ns, wheel_ns);
+    }
+
+    puts("DONE");
+
+    return 0;
+}
@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test notifying several observers of a resource with gcoap
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "net/gcoap.h"
+#include "timex.h"
+
+#define OBSERVER_PORT_BASE  (20000U)
+#define RECV_TIMEOUT        (100 * US_PER_MS)
+
+static const char _payload[] = "42";
+
+static ssize_t _value_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                              void *ctx)
+{
+    (void)ctx;
+    gcoap_resp_init(pdu, buf, len, COAP_CODE_CONTENT);
+    coap_opt_add_format(pdu, COAP_FORMAT_TEXT);
+    size_t resp_len = coap_opt_finish(pdu, COAP_OPT_FINISH_PAYLOAD);
+
+    memcpy(pdu->payload, _payload, sizeof(_payload) - 1);
+    return resp_len + sizeof(_payload) - 1;
+}
+
+static const coap_resource_t _resources[] = {
+    { "/value", COAP_GET, _value_handler, NULL },
+};
+
+static gcoap_listener_t _listener = {
+    &_resources[0],
+    ARRAY_SIZE(_resources),
+    NULL,
+    NULL,
+    NULL
+};
+
+static sock_udp_t _socks[OBSERVERS];
+static uint8_t _buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+
+/* each observer uses a token of its own, also differing in length */
+static unsigned _token(unsigned num, uint8_t *token)
+{
+    unsigned len = 1 + (num % GCOAP_TOKENLEN_MAX);
+
+    for (unsigned i = 0; i < len; i++) {
+        token[i] = num * 16 + i;
+    }
+    return len;
+}
+
+static int _register(unsigned num)
+{
+    sock_udp_ep_t local = { .family = AF_INET6,
+                            .port = OBSERVER_PORT_BASE + num };
+    sock_udp_ep_t remote = { .family = AF_INET6,
+                             .addr = { .ipv6 = { [15] = 1 } },
+                             .port = CONFIG_GCOAP_PORT };
+    uint8_t token[GCOAP_TOKENLEN_MAX];
+    unsigned token_len = _token(num, token);
+    coap_pkt_t pdu;
+    ssize_t len;
+
+    len = coap_build_hdr((coap_hdr_t *)_buf, COAP_TYPE_NON, token, token_len,
+                         COAP_METHOD_GET, num);
+    coap_pkt_init(&pdu, _buf, sizeof(_buf), len);
+    coap_opt_add_uint(&pdu, COAP_OPT_OBSERVE, COAP_OBS_REGISTER);
+    coap_opt_add_uri_path(&pdu, "/value");
+    len = coap_opt_finish(&pdu, COAP_OPT_FINISH_NONE);
+
+    if (sock_udp_create(&_socks[num], &local, NULL, 0) < 0) {
+        return -1;
+    }
+    sock_udp_send(&_socks[num], _buf, len, &remote);
+    len = sock_udp_recv(&_socks[num], _buf, sizeof(_buf), RECV_TIMEOUT, NULL);
+    if ((len <= 0) || (coap_parse(&pdu, _buf, len) < 0) ||
+        !coap_has_observe(&pdu)) {
+        return -1;
+    }
+    return 0;
+}
+
+/* checks that the observer got a notification with its own token */
+static int _check_notification(unsigned num)
+{
+    uint8_t token[GCOAP_TOKENLEN_MAX];
+    unsigned token_len = _token(num, token);
+    coap_pkt_t pdu;
+    ssize_t len;
+
+    len = sock_udp_recv(&_socks[num], _buf, sizeof(_buf), RECV_TIMEOUT, NULL);
+    if ((len <= 0) || (coap_parse(&pdu, _buf, len) < 0)) {
+        printf("observer %u: no notification\n", num);
+        return -1;
+    }
+    if ((coap_get_token_len(&pdu) != token_len) ||
+        memcmp(pdu.token, token, token_len)) {
+        printf("observer %u: wrong token\n", num);
+        return -1;
+    }
+    if (!coap_has_observe(&pdu) ||
+        (coap_get_code_raw(&pdu) != COAP_CODE_CONTENT) ||
+        (pdu.payload_len != sizeof(_payload) - 1) ||
+        memcmp(pdu.payload, _payload, pdu.payload_len)) {
+        printf("observer %u: wrong notification\n", num);
+        return -1;
+    }
+    return 0;
+}
+
+int main(void)
+{
+    coap_pkt_t pdu;
+    unsigned failed = 0;
+
+    gcoap_register_listener(&_listener);
+
+    for (unsigned i = 0; i < OBSERVERS; i++) {
+        if (_register(i) < 0) {
+            printf("registration %u failed\n", i);
+            return 1;
+        }
+    }
+
+    if (gcoap_obs_notify_init(&pdu, _buf, sizeof(_buf),
+                              &_resources[0]) != GCOAP_OBS_INIT_OK) {
+        puts("unable to initialize notification");
+        return 1;
+    }
+    coap_opt_add_format(&pdu, COAP_FORMAT_TEXT);
+    size_t len = coap_opt_finish(&pdu, COAP_OPT_FINISH_PAYLOAD);
+    memcpy(pdu.payload, _payload, sizeof(_payload) - 1);
+    len += sizeof(_payload) - 1;
+
+    unsigned notified = gcoap_obs_notify(&pdu, len, &_resources[0]);
+    printf("notified %u of %u observers\n", notified, OBSERVERS);
+
+    for (unsigned i = 0; i < OBSERVERS; i++) {
+        if (_check_notification(i) < 0) {
+            failed++;
+        }
+        sock_udp_close(&_socks[i]);
+    }
+
+    if ((notified != OBSERVERS) || failed) {
+        puts("FAILED");
+        return 1;
+    }
+    puts("SUCCESS");
+
+    return 0;
+}
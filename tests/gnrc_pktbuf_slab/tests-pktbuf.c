@@ -0,0 +1 @@
+../unittests/tests-pktbuf/tests-pktbuf.c
\ No newline at end of file
@@ -0,0 +1 @@
+../unittests/tests-pktbuf/tests-pktbuf.h
\ No newline at end of file
@@ -423,6 +423,50 @@ static void test_sock_udp_recv__non_blocking(void)
     expect(_check_net());
 }
 
+static void test_sock_udp_recv_many(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    static uint8_t bufs[3][8];
+    sock_udp_ep_t results[3];
+    sock_udp_dgram_t dgrams[3];
+
+    for (unsigned i = 0; i < ARRAY_SIZE(dgrams); i++) {
+        dgrams[i].data = bufs[i];
+        dgrams[i].len = sizeof(bufs[i]);
+        dgrams[i].remote = &results[i];
+    }
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(-EAGAIN == sock_udp_recv_many(&_sock, dgrams, ARRAY_SIZE(dgrams),
+                                         0));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"),
+                          _TEST_NETIF));
+    /* too large for the buffer, so it is dropped */
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "0123456789", sizeof("0123456789"),
+                          _TEST_NETIF));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "EF", sizeof("EF"),
+                          _TEST_NETIF));
+    expect(2 == sock_udp_recv_many(&_sock, dgrams, ARRAY_SIZE(dgrams),
+                                   SOCK_NO_TIMEOUT));
+    expect(sizeof("ABCD") == dgrams[0].len);
+    expect(memcmp(bufs[0], "ABCD", sizeof("ABCD")) == 0);
+    expect(sizeof("EF") == dgrams[1].len);
+    expect(memcmp(bufs[1], "EF", sizeof("EF")) == 0);
+    for (unsigned i = 0; i < 2; i++) {
+        expect(AF_INET6 == results[i].family);
+        expect(memcmp(&results[i].addr, &src_addr,
+                      sizeof(results[i].addr)) == 0);
+        expect(_TEST_PORT_REMOTE == results[i].port);
+        expect(_TEST_NETIF == results[i].netif);
+    }
+    expect(_check_net());
+}
+
 static void test_sock_udp_recv__aux(void)
 {
     static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
@@ -765,6 +809,41 @@ static void test_sock_udp_send__no_sock(void)
     expect(_check_net());
 }
 
+static void test_sock_udp_send_many(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const sock_udp_ep_t local = { .addr = { .ipv6 = _TEST_ADDR_LOCAL },
+                                         .family = AF_INET6,
+                                         .netif = _TEST_NETIF,
+                                         .port = _TEST_PORT_LOCAL };
+    static sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
+                                    .family = AF_INET6,
+                                    .port = _TEST_PORT_REMOTE };
+    static sock_udp_ep_t invalid = { .family = AF_INET6 };
+    sock_udp_dgram_t dgrams[] = {
+        { .data = "ABCD", .len = sizeof("ABCD"), .remote = NULL },
+        { .data = "EF", .len = sizeof("EF"), .remote = &remote },
+        { .data = "GH", .len = sizeof("GH"), .remote = &invalid },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    /* unconnected sock, so the first datagram needs a remote */
+    expect(-ENOTCONN == sock_udp_send_many(&_sock, dgrams, ARRAY_SIZE(dgrams)));
+    dgrams[0].remote = &remote;
+    _prepare_send_many_checks();
+    expect(2 == sock_udp_send_many(&_sock, dgrams, ARRAY_SIZE(dgrams)));
+    expect(_check_packet(&src_addr, &dst_addr, _TEST_PORT_LOCAL,
+                         _TEST_PORT_REMOTE, "ABCD", sizeof("ABCD"),
+                         _TEST_NETIF, false));
+    expect(_check_packet(&src_addr, &dst_addr, _TEST_PORT_LOCAL,
+                         _TEST_PORT_REMOTE, "EF", sizeof("EF"),
+                         _TEST_NETIF, false));
+    _finish_send_many_checks();
+    xtimer_usleep(1000);    /* let GNRC stack finish */
+    expect(_check_net());
+}
+
 int main(void)
 {
     _net_init();
@@ -797,6 +876,7 @@ int main(void)
     CALL(test_sock_udp_recv__with_timeout());
     CALL(test_sock_udp_recv__non_blocking());
     CALL(test_sock_udp_recv__aux());
+    CALL(test_sock_udp_recv_many());
     CALL(test_sock_udp_recv_buf__success());
     _prepare_send_checks();
     CALL(test_sock_udp_send__EAFNOSUPPORT());
@@ -815,6 +895,7 @@ int main(void)
     CALL(test_sock_udp_send__unsocketed());
     CALL(test_sock_udp_send__no_sock_no_netif());
     CALL(test_sock_udp_send__no_sock());
+    CALL(test_sock_udp_send_many());
 
     puts("ALL TESTS SUCCESSFUL");
 
@@ -39,6 +39,18 @@ void _net_init(void);
  */
 void _prepare_send_checks(void);
 
+/**
+ * @brief   Checks packets sent with @ref sock_udp_send_many() instead
+ *
+ * Those are handed to the network layer directly, so they are caught there
+ */
+void _prepare_send_many_checks(void);
+
+/**
+ * @brief   Reverts @ref _prepare_send_many_checks()
+ */
+void _finish_send_many_checks(void);
+
 /**
  * @brief   Auxiliary data to inject
  */
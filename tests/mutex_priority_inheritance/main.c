@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for priority inheritance of core_mutex
+ *
+ * All other threads have a higher priority than main, so they run right
+ * after being created or woken up and main sees the state they leave behind.
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdio.h>
+
+#include "mutex.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define PRIO                (THREAD_PRIORITY_MAIN)
+#define ISR_DELAY_US        (1000U)
+
+static char _stacks[2][THREAD_STACKSIZE_DEFAULT];
+static mutex_t _mutex_a = MUTEX_INIT;
+static mutex_t _mutex_b = MUTEX_INIT;
+static mutex_cancel_t _mc;
+static int _cancel_res;
+static uint8_t _chain_prio;
+static volatile int _isr_res = -1;
+
+static uint8_t _prio(void)
+{
+    return thread_get_active()->priority;
+}
+
+static kernel_pid_t _create(unsigned stack, uint8_t prio,
+                            thread_task_func_t func, void *arg)
+{
+    return thread_create(_stacks[stack], sizeof(_stacks[stack]), prio,
+                         THREAD_CREATE_STACKTEST, func, arg, "waiter");
+}
+
+static void *_lock_unlock(void *arg)
+{
+    mutex_lock(arg);
+    mutex_unlock(arg);
+    return NULL;
+}
+
+static void *_chain(void *arg)
+{
+    (void)arg;
+    mutex_lock(&_mutex_b);
+    mutex_lock(&_mutex_a);
+    mutex_unlock(&_mutex_a);
+    mutex_unlock(&_mutex_b);
+    _chain_prio = _prio();
+    return NULL;
+}
+
+static void *_lock_cancelable(void *arg)
+{
+    _mc = mutex_cancel_init(arg);
+    _cancel_res = mutex_lock_cancelable(&_mc);
+    return NULL;
+}
+
+static void _trylock_isr(void *arg)
+{
+    _isr_res = mutex_trylock(arg);
+}
+
+static void test_simple(void)
+{
+    mutex_lock(&_mutex_a);
+    _create(0, PRIO - 2, _lock_unlock, &_mutex_a);
+    expect(_prio() == PRIO - 2);
+    mutex_unlock(&_mutex_a);
+    expect(_prio() == PRIO);
+    puts("test_simple: OK");
+}
+
+static void test_nested(void)
+{
+    mutex_lock(&_mutex_a);
+    mutex_lock(&_mutex_b);
+    _create(0, PRIO - 1, _lock_unlock, &_mutex_a);
+    expect(_prio() == PRIO - 1);
+    _create(1, PRIO - 3, _lock_unlock, &_mutex_b);
+    expect(_prio() == PRIO - 3);
+    /* still inherits from the waiter for _mutex_a */
+    mutex_unlock(&_mutex_b);
+    expect(_prio() == PRIO - 1);
+    mutex_unlock(&_mutex_a);
+    expect(_prio() == PRIO);
+    puts("test_nested: OK");
+}
+
+static void test_transitive(void)
+{
+    mutex_lock(&_mutex_a);
+    /* holds _mutex_b and blocks on _mutex_a */
+    kernel_pid_t chain = _create(0, PRIO - 1, _chain, NULL);
+    expect(_prio() == PRIO - 1);
+    /* blocks on _mutex_b, raising chain and in turn main */
+    _create(1, PRIO - 3, _lock_unlock, &_mutex_b);
+    expect(thread_get(chain)->priority == PRIO - 3);
+    expect(_prio() == PRIO - 3);
+    mutex_unlock(&_mutex_a);
+    expect(_prio() == PRIO);
+    expect(_chain_prio == PRIO - 1);
+    puts("test_transitive: OK");
+}
+
+static void test_cancel(void)
+{
+    mutex_lock(&_mutex_a);
+    _create(0, PRIO - 2, _lock_cancelable, &_mutex_a);
+    expect(_prio() == PRIO - 2);
+    mutex_cancel(&_mc);
+    expect(_cancel_res == -ECANCELED);
+    expect(_prio() == PRIO);
+    mutex_unlock(&_mutex_a);
+    puts("test_cancel: OK");
+}
+
+static void test_isr(void)
+{
+    ztimer_t timer = { .callback = _trylock_isr, .arg = &_mutex_a };
+
+    /* main keeps running while the ISR locks the mutex */
+    ztimer_set(ZTIMER_USEC, &timer, ISR_DELAY_US);
+    while (_isr_res < 0) {}
+    expect(_isr_res == 1);
+    expect(_mutex_a.owner == KERNEL_PID_UNDEF);
+    /* the waiter must not raise main, which was interrupted */
+    _create(0, PRIO - 2, _lock_unlock, &_mutex_a);
+    expect(_prio() == PRIO);
+    /* unlock on behalf of the ISR */
+    mutex_unlock(&_mutex_a);
+    expect(_prio() == PRIO);
+    puts("test_isr: OK");
+}
+
+int main(void)
+{
+    puts("Test Application for priority inheritance of mutexes\n"
+         "====================================================\n");
+
+    test_simple();
+    test_nested();
+    test_transitive();
+    test_cancel();
+    test_isr();
+
+    puts("TEST PASSED");
+
+    return 0;
+}
@@ -376,26 +376,76 @@ static int cmd_auto_test(int argc, char **argv)
     return 0;
 }
 
+static gpio_t _bench_pin;
+
+static void _bench_nop(void *arg)
+{
+    (void)arg;
+    __asm__ volatile("nop");
+}
+
+static void _bench_set(void *arg)
+{
+    (void)arg;
+    gpio_set(_bench_pin);
+}
+
+static void _bench_clear(void *arg)
+{
+    (void)arg;
+    gpio_clear(_bench_pin);
+}
+
+static void _bench_toggle(void *arg)
+{
+    (void)arg;
+    gpio_toggle(_bench_pin);
+}
+
+static void _bench_read(void *arg)
+{
+    (void)arg;
+    (void)gpio_read(_bench_pin);
+}
+
+static void _bench_write(void *arg)
+{
+    (void)arg;
+    gpio_write(_bench_pin, 1);
+}
+
 static int bench(int argc, char **argv)
 {
+    char param[8];
+    benchmark_case_t cases[] = {
+        { .name = "nop loop", .func = _bench_nop },
+        { .name = "gpio_set", .func = _bench_set },
+        { .name = "gpio_clear", .func = _bench_clear },
+        { .name = "gpio_toggle", .func = _bench_toggle },
+        { .name = "gpio_read", .func = _bench_read },
+        { .name = "gpio_write", .func = _bench_write },
+    };
+
     if (argc < 3) {
         printf("usage: %s <port> <pin> [# of runs]\n", argv[0]);
         return 1;
     }
 
-    gpio_t pin = GPIO_PIN(atoi(argv[1]), atoi(argv[2]));
+    _bench_pin = GPIO_PIN(atoi(argv[1]), atoi(argv[2]));
     unsigned long runs = BENCH_RUNS_DEFAULT;
     if (argc > 3) {
         runs = (unsigned long)atol(argv[3]);
     }
 
+    /* the runs are spread over the samples of each case */
+    snprintf(param, sizeof(param), "%d.%d", atoi(argv[1]), atoi(argv[2]));
+    for (unsigned i = 0; i < ARRAY_SIZE(cases); i++) {
+        cases[i].param = param;
+        cases[i].iterations = runs / CONFIG_BENCHMARK_SAMPLES;
+    }
+
     puts("\nGPIO driver run-time performance benchmark\n");
-    BENCHMARK_FUNC("nop loop", runs, __asm__ volatile("nop"));
-    BENCHMARK_FUNC("gpio_set", runs, gpio_set(pin));
-    BENCHMARK_FUNC("gpio_clear", runs, gpio_clear(pin));
-    BENCHMARK_FUNC("gpio_toggle", runs, gpio_toggle(pin));
-    BENCHMARK_FUNC("gpio_read", runs, (void)gpio_read(pin));
-    BENCHMARK_FUNC("gpio_write", runs, gpio_write(pin, 1));
+    benchmark_run_all(cases, ARRAY_SIZE(cases));
     puts("\n --- DONE ---");
     return 0;
 }
@@ -13,23 +13,24 @@ from testrunner import run
 
 # Allow setting a specific port to test
 PORT_UNDER_TEST = int(os.environ.get('PORT_UNDER_TEST') or 0)
+FUNCS = ["nop loop", "gpio_set", "gpio_clear", "gpio_toggle", "gpio_read",
+         "gpio_write"]
 
 
 def testfunc(child):
     for pin in range(0, 8):
         child.sendline("bench {} {}".format(PORT_UNDER_TEST, pin))
-        child.expect(r" *nop loop: +(\d+)us  --- +(\d+\.\d+)us per call  --- +(\d+) calls per sec")
-        child.expect(r" *gpio_set: +(\d+)us  --- +(\d+\.\d+)us per call  --- +(\d+) calls per sec")
-        child.expect(r" *gpio_clear: +(\d+)us  --- +(\d+\.\d+)us per call  --- +(\d+) calls per sec")
-        child.expect(r" *gpio_toggle: +(\d+)us  --- +(\d+\.\d+)us per call  --- +(\d+) calls per sec")
-        child.expect(r" *gpio_read: +(\d+)us  --- +(\d+\.\d+)us per call  --- +(\d+) calls per sec")
-        child.expect(r" *gpio_write: +(\d+)us  --- +(\d+\.\d+)us per call  --- +(\d+) calls per sec")
+        child.expect_exact("name,param,iterations,samples,"
+                           "min_ns,median_ns,p99_ns,max_ns,mean_ns")
+        for func in FUNCS:
+            child.expect(r"{},{}\.{},\d+(,\d+){{6}}".format(
+                func, PORT_UNDER_TEST, pin))
+        child.expect_exact("benchmark: {} cases run".format(len(FUNCS)))
         child.expect_exact(" --- DONE ---")
         child.expect_exact(">")
 
     # TODO do some automated verification here? E.g. all pins should have the
     #      same timing?
-    # TODO parse output data and put in some unified format?
 
     print("Benchmark was successful")
 
@@ -0,0 +1,195 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests for the digest riotboot_flashwrite calculates while
+ *              writing
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "hashes/sha256.h"
+#include "riotboot/flashwrite.h"
+#include "riotboot/slot.h"
+#include "suit.h"
+#include "suit/storage.h"
+
+/* spans several write blocks and, on most MCUs, a page boundary */
+#define IMAGE_LEN           (2048U + 77U)
+
+/* the first block is only written by riotboot_flashwrite_finish() */
+#if CONFIG_RIOTBOOT_FLASHWRITE_RAW
+#define FIRST_WRITTEN       RIOTBOOT_FLASHPAGE_BUFFER_SIZE
+#else
+#define FIRST_WRITTEN       RIOTBOOT_FLASHWRITE_SKIPLEN
+#endif
+
+/* odd sizes, so chunks do not start at write block boundaries */
+static const uint8_t _chunk_lens[] = { 13, 1, 3, 7, 61, 5 };
+
+static riotboot_flashwrite_t _writer;
+static uint8_t _chunk[64];
+
+static uint8_t _image_byte(size_t off)
+{
+    if (off < RIOTBOOT_FLASHWRITE_SKIPLEN) {
+        return "RIOT"[off];
+    }
+    return off * 7 + (off >> 8) + 0x5a;
+}
+
+static size_t _next_chunk(size_t off, unsigned num)
+{
+    size_t len = _chunk_lens[num % ARRAY_SIZE(_chunk_lens)];
+
+    if (len > IMAGE_LEN - off) {
+        len = IMAGE_LEN - off;
+    }
+    for (size_t i = 0; i < len; i++) {
+        _chunk[i] = _image_byte(off + i);
+    }
+    return len;
+}
+
+static void _image_sha256(uint8_t *digest)
+{
+    sha256_context_t ctx;
+
+    sha256_init(&ctx);
+    for (size_t off = 0; off < IMAGE_LEN; off++) {
+        uint8_t byte = _image_byte(off);
+        sha256_update(&ctx, &byte, 1);
+    }
+    sha256_final(&ctx, digest);
+}
+
+static void _write_image(int slot)
+{
+    size_t off = RIOTBOOT_FLASHWRITE_SKIPLEN;
+
+    TEST_ASSERT_EQUAL_INT(0, riotboot_flashwrite_init(&_writer, slot));
+    for (unsigned i = 0; off < IMAGE_LEN; i++) {
+        size_t len = _next_chunk(off, i);
+
+        TEST_ASSERT_EQUAL_INT(0, riotboot_flashwrite_putbytes(&_writer, _chunk,
+                                                              len, true));
+        off += len;
+    }
+    TEST_ASSERT_EQUAL_INT(0, riotboot_flashwrite_flush(&_writer));
+}
+
+static void tear_down(void)
+{
+    /* leave no image in the slot */
+    riotboot_flashwrite_invalidate(riotboot_slot_other());
+}
+
+static void test_riotboot_flashwrite_unaligned(void)
+{
+    int slot = riotboot_slot_other();
+    const uint8_t *img = (const uint8_t *)riotboot_slot_get_hdr(slot);
+
+    _write_image(slot);
+    for (size_t off = FIRST_WRITTEN; off < IMAGE_LEN; off++) {
+        TEST_ASSERT_EQUAL_INT(_image_byte(off), img[off]);
+    }
+}
+
+static void test_riotboot_flashwrite_sha256(void)
+{
+    int slot = riotboot_slot_other();
+    uint8_t expected[SHA256_DIGEST_LENGTH];
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+
+    _image_sha256(expected);
+    _write_image(slot);
+    riotboot_flashwrite_get_sha256(&_writer, digest);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(expected, digest, sizeof(digest)));
+
+    /* reading the slot back must give the same digest */
+    TEST_ASSERT_EQUAL_INT(0, riotboot_flashwrite_finish(&_writer));
+    TEST_ASSERT_EQUAL_INT(0, riotboot_flashwrite_verify_sha256(digest,
+                                                               IMAGE_LEN,
+                                                               slot));
+}
+
+static void test_suit_storage_flashwrite_sha256(void)
+{
+    suit_storage_t *storage = suit_storage_find_by_id("");
+    uint8_t expected[SHA256_DIGEST_LENGTH];
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    sha256_context_t ctx;
+    size_t off = 0;
+
+    TEST_ASSERT_NOT_NULL(storage);
+    TEST_ASSERT(suit_storage_has_sha256(storage));
+
+    _image_sha256(expected);
+    TEST_ASSERT_EQUAL_INT(SUIT_OK, suit_storage_start(storage, NULL,
+                                                      IMAGE_LEN));
+    for (unsigned i = 0; off < IMAGE_LEN; i++) {
+        size_t len = _next_chunk(off, i);
+
+        TEST_ASSERT_EQUAL_INT(SUIT_OK, suit_storage_write(storage, NULL,
+                                                          _chunk, off, len));
+        off += len;
+    }
+    TEST_ASSERT_EQUAL_INT(SUIT_OK, suit_storage_finish(storage, NULL));
+
+    TEST_ASSERT_EQUAL_INT(SUIT_OK, suit_storage_get_sha256(storage, IMAGE_LEN,
+                                                           digest));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(expected, digest, sizeof(digest)));
+
+    /* the digest does not cover a payload of another length, the manifest
+     * handler has to read the payload back then */
+    TEST_ASSERT(suit_storage_get_sha256(storage, IMAGE_LEN - 1,
+                                        digest) != SUIT_OK);
+    sha256_init(&ctx);
+    for (off = 0; off < IMAGE_LEN; off += sizeof(_chunk)) {
+        size_t len = IMAGE_LEN - off;
+
+        if (len > sizeof(_chunk)) {
+            len = sizeof(_chunk);
+        }
+        TEST_ASSERT_EQUAL_INT(SUIT_OK, suit_storage_read(storage, _chunk, off,
+                                                         len));
+        sha256_update(&ctx, _chunk, len);
+    }
+    sha256_final(&ctx, digest);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(expected, digest, sizeof(digest)));
+}
+
+static Test *tests_riotboot_flashwrite_sha256(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_riotboot_flashwrite_unaligned),
+        new_TestFixture(test_riotboot_flashwrite_sha256),
+        new_TestFixture(test_suit_storage_flashwrite_sha256),
+    };
+
+    EMB_UNIT_TESTCALLER(riotboot_flashwrite_sha256_tests, NULL, tear_down,
+                        fixtures);
+
+    return (Test *)&riotboot_flashwrite_sha256_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_riotboot_flashwrite_sha256());
+    TESTS_END();
+    return 0;
+}
@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the scheduling latency statistics
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdio.h>
+
+#include "bitarithm.h"
+#include "ps.h"
+#include "schedstatistics.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define RUNS                (8U)
+#define BUSY_US             (2000U)
+#define DELAY_US            (1000U)
+#define SLEEP_US            (1000U)
+
+static char _stacks[2][THREAD_STACKSIZE_DEFAULT];
+static uint8_t _dump[SCHEDSTATISTICS_DUMP_MAXLEN];
+
+static void *_busy(void *arg)
+{
+    (void)arg;
+    while (1) {
+        thread_sleep();
+        ztimer_spin(ZTIMER_USEC, BUSY_US);
+    }
+    return NULL;
+}
+
+static void *_lazy(void *arg)
+{
+    (void)arg;
+    while (1) {
+        thread_sleep();
+    }
+    return NULL;
+}
+
+/* number of latencies of at least 2^from us counted since before */
+static unsigned _counted(const schedstat_t *before, const schedstat_t *after,
+                         unsigned from)
+{
+    unsigned sum = 0;
+
+    for (unsigned i = from; i < CONFIG_SCHEDSTATISTICS_LATENCY_BUCKETS; i++) {
+        sum += after->latency_hist[i] - before->latency_hist[i];
+    }
+    return sum;
+}
+
+static void _print_stat(const char *name, kernel_pid_t pid)
+{
+    const schedstat_t *stat = &sched_pidlist[pid];
+
+    printf("%s: pid %" PRIkernel_pid ", %u schedules, latency max %" PRIu32
+           " us, running max %" PRIu32 " us, histogram",
+           name, pid, stat->schedules, stat->latency_max, stat->running_max);
+    for (unsigned i = 0; i < CONFIG_SCHEDSTATISTICS_LATENCY_BUCKETS; i++) {
+        printf(" %u", stat->latency_hist[i]);
+    }
+    puts("");
+}
+
+int main(void)
+{
+    kernel_pid_t high = thread_create(_stacks[0], sizeof(_stacks[0]),
+                                      THREAD_PRIORITY_MAIN - 1,
+                                      THREAD_CREATE_STACKTEST,
+                                      _busy, NULL, "high");
+    kernel_pid_t low = thread_create(_stacks[1], sizeof(_stacks[1]),
+                                     THREAD_PRIORITY_MAIN + 1,
+                                     THREAD_CREATE_STACKTEST,
+                                     _lazy, NULL, "low");
+
+    /* let low go to sleep */
+    ztimer_sleep(ZTIMER_USEC, SLEEP_US);
+
+    schedstat_t high_before = sched_pidlist[high];
+    schedstat_t low_before = sched_pidlist[low];
+
+    for (unsigned i = 0; i < RUNS; i++) {
+        /* preempts main right away and runs for BUSY_US */
+        thread_wakeup(high);
+        /* becomes runnable, but main keeps it waiting for DELAY_US */
+        thread_wakeup(low);
+        ztimer_spin(ZTIMER_USEC, DELAY_US);
+        ztimer_sleep(ZTIMER_USEC, SLEEP_US);
+    }
+
+    schedstat_t high_after = sched_pidlist[high];
+    schedstat_t low_after = sched_pidlist[low];
+
+    expect(high_after.schedules - high_before.schedules == RUNS);
+    expect(_counted(&high_before, &high_after, 0) == RUNS);
+    expect(high_after.running_max >= BUSY_US);
+    expect(low_after.schedules - low_before.schedules == RUNS);
+    expect(_counted(&low_before, &low_after, bitarithm_msb(DELAY_US)) == RUNS);
+    expect(low_after.latency_max >= DELAY_US);
+    expect(sched_pidlist[thread_getpid()].running_max >= DELAY_US);
+    puts("statistics: OK");
+
+    _print_stat("high", high);
+    _print_stat("low", low);
+
+    expect(schedstatistics_dump(_dump, SCHEDSTATISTICS_DUMP_HDR_LEN) == -ENOBUFS);
+    int len = schedstatistics_dump(_dump, sizeof(_dump));
+    expect(len > 0);
+    printf("dump:");
+    for (int i = 0; i < len; i++) {
+        printf(" %02x", _dump[i]);
+    }
+    puts("");
+
+    ps();
+
+    puts("TEST DONE");
+    return 0;
+}
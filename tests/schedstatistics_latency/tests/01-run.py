@@ -0,0 +1,70 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2021 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import struct
+import sys
+from testrunner import run
+
+# layout as documented for schedstatistics_dump() in schedstatistics.h
+HDR = struct.Struct('<4sBBH')
+REC = struct.Struct('<HIQII')
+
+STAT = (r'{}: pid (\d+), (\d+) schedules, latency max (\d+) us, '
+        r'running max (\d+) us, histogram((?: \d+)+)\r\n')
+
+
+def _expect_stat(child, name):
+    child.expect(STAT.format(name))
+    pid, schedules, lat_max, run_max = (int(x) for x in child.match.groups()[:4])
+    hist = tuple(int(x) for x in child.match.group(5).split())
+    return pid, (schedules, lat_max, run_max, hist)
+
+
+def _decode(data):
+    magic, version, buckets, numof = HDR.unpack_from(data)
+    assert magic == b'SCHS'
+    assert version == 1
+    assert buckets > 0
+    rec_len = REC.size + 2 * buckets
+    assert len(data) == HDR.size + numof * rec_len
+    records = {}
+    for i in range(numof):
+        offset = HDR.size + i * rec_len
+        pid, schedules, _, lat_max, run_max = REC.unpack_from(data, offset)
+        hist = struct.unpack_from('<{}H'.format(buckets), data,
+                                  offset + REC.size)
+        records[pid] = (schedules, lat_max, run_max, hist)
+    return records
+
+
+def testfunc(child):
+    child.expect_exact('statistics: OK')
+    stats = dict((_expect_stat(child, 'high'), _expect_stat(child, 'low')))
+
+    child.expect(r'dump:((?: [0-9a-f]{2})+)\r\n')
+    records = _decode(bytes.fromhex(child.match.group(1)))
+    for pid, stat in stats.items():
+        assert records[pid] == stat
+
+    child.expect(r'\| runtime  \| switches  \| lat max  \| run max')
+    for pid, (_, lat_max, run_max, _) in stats.items():
+        child.expect(r'\t\s*{} \|.*\|\s+(\d+)us \|\s+(\d+)us\r\n'.format(pid))
+        assert int(child.match.group(1)) == lat_max
+        assert int(child.match.group(2)) == run_max
+
+    child.expect_exact('Scheduling latency histogram')
+    for pid, (_, _, _, hist) in stats.items():
+        child.expect(r'\t\s*{}((?: \| +\d+)+)\r\n'.format(pid))
+        row = tuple(int(x) for x in child.match.group(1).split('|')[1:])
+        assert row == hist
+
+    child.expect_exact('TEST DONE')
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
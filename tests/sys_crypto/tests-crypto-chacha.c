@@ -131,12 +131,55 @@ static void test_crypto_chacha20_tc8(void)
                         TC8_CHACHA20_BLOCK0, TC8_CHACHA20_BLOCK1);
 }
 
+static void _test_crypto_chacha_blocks(unsigned rounds,
+                                       const uint8_t block0[64],
+                                       const uint8_t block1[64])
+{
+    chacha_ctx ctx, ref;
+    static uint8_t blocks[6 * 64];
+    uint8_t block[64];
+
+    TEST_ASSERT_EQUAL_INT(0, chacha_init(&ctx, rounds, TC8_KEY, 16, TC8_IV));
+    ref = ctx;
+
+    chacha_keystream_blocks(&ctx, blocks, 6);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(&blocks[0], block0, 64));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(&blocks[64], block1, 64));
+    for (unsigned i = 0; i < 6; i++) {
+        chacha_keystream_bytes(&ref, block);
+        TEST_ASSERT_EQUAL_INT(0, memcmp(&blocks[i * 64], block, 64));
+    }
+    TEST_ASSERT_EQUAL_INT(0, memcmp(ctx.state, ref.state, 64));
+
+    /* the block counter carries into the upper word within a batch */
+    ctx.state[12] = 0xfffffffe;
+    ref = ctx;
+    chacha_keystream_blocks(&ctx, blocks, 4);
+    for (unsigned i = 0; i < 4; i++) {
+        chacha_keystream_bytes(&ref, block);
+        TEST_ASSERT_EQUAL_INT(0, memcmp(&blocks[i * 64], block, 64));
+    }
+    TEST_ASSERT_EQUAL_INT(0, memcmp(ctx.state, ref.state, 64));
+}
+
+static void test_crypto_chacha8_blocks(void)
+{
+    _test_crypto_chacha_blocks(8, TC8_CHACHA8_BLOCK0, TC8_CHACHA8_BLOCK1);
+}
+
+static void test_crypto_chacha20_blocks(void)
+{
+    _test_crypto_chacha_blocks(20, TC8_CHACHA20_BLOCK0, TC8_CHACHA20_BLOCK1);
+}
+
 Test *tests_crypto_chacha_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_crypto_chacha8_tc8),
         new_TestFixture(test_crypto_chacha12_tc8),
         new_TestFixture(test_crypto_chacha20_tc8),
+        new_TestFixture(test_crypto_chacha8_blocks),
+        new_TestFixture(test_crypto_chacha20_blocks),
     };
     EMB_UNIT_TESTCALLER(crypto_chacha_tests, NULL, NULL, fixtures);
     return (Test *)&crypto_chacha_tests;
@@ -58,28 +58,104 @@ static const uint8_t ciphertext_1[] = {
     0xe2, 0x6a, 0x7e, 0x90, 0x2e, 0xcb, 0xd0, 0x60, 0x06, 0x91,
 };
 
+/* 300 bytes, i.e. several batches of key stream blocks and a partial block,
+ * computed with an independent implementation of RFC 8439 */
+static const uint8_t key_2[32] = {
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97,
+    0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f,
+};
+
+static const uint8_t aad_2[] = {
+    0x50, 0x51, 0x52, 0x53, 0xc0, 0xc1, 0xc2, 0xc3,
+};
+
+static const uint8_t nonce_2[] = {
+    0x00, 0x00, 0x00, 0x07, 0x40, 0x41, 0x42, 0x43,
+    0x44, 0x45, 0x46, 0x47,
+};
+
+/* msg_2[i] = i * 13 + 5 */
+static uint8_t msg_2[300];
+
+static const uint8_t ciphertext_2[] = {
+    0x3d, 0xff, 0x43, 0x06, 0x82, 0x4c, 0x5e, 0x2a,
+    0x21, 0x5f, 0x8c, 0x99, 0xf0, 0x98, 0xc1, 0x00,
+    0x80, 0xfc, 0xb4, 0x11, 0x78, 0xe3, 0xcb, 0x72,
+    0x41, 0xcf, 0x4c, 0x71, 0x3a, 0x78, 0x5c, 0x9c,
+    0x63, 0x58, 0x55, 0xe5, 0x97, 0x88, 0xc1, 0xf0,
+    0x58, 0x30, 0x19, 0xc3, 0x9c, 0xa4, 0x43, 0xc4,
+    0x0a, 0xfb, 0x42, 0xae, 0xda, 0x78, 0x63, 0x74,
+    0xc4, 0x08, 0x93, 0xd6, 0x9e, 0x9c, 0xf2, 0xf8,
+    0x86, 0xd5, 0xc3, 0xdd, 0x30, 0x64, 0xc1, 0x6e,
+    0x8a, 0x8f, 0x1e, 0xa4, 0x52, 0xaa, 0xda, 0xb5,
+    0x28, 0xca, 0x3c, 0xde, 0x22, 0x0e, 0x7c, 0x42,
+    0x9d, 0x06, 0x66, 0x7c, 0x72, 0x48, 0x94, 0x7b,
+    0x77, 0xca, 0x7c, 0xfd, 0xbd, 0x65, 0x7d, 0x8a,
+    0x50, 0xf5, 0x91, 0x2e, 0x4e, 0xd0, 0xbd, 0x42,
+    0xb2, 0x38, 0x9b, 0xb8, 0xfa, 0x73, 0x55, 0x6f,
+    0x65, 0x02, 0x66, 0xa4, 0x3e, 0xbb, 0x76, 0x46,
+    0xdd, 0x7c, 0x57, 0x84, 0x6e, 0x5e, 0xb2, 0xa2,
+    0x2a, 0x34, 0x7d, 0x32, 0x36, 0xd3, 0x43, 0x5c,
+    0x54, 0x62, 0x92, 0x80, 0x00, 0x97, 0x1c, 0xaa,
+    0x31, 0xf2, 0xb5, 0xf8, 0xa3, 0x7b, 0xcd, 0xfa,
+    0x08, 0x81, 0xb9, 0x52, 0xb5, 0x90, 0xc4, 0x84,
+    0x34, 0x01, 0x16, 0x9e, 0xae, 0x69, 0x67, 0xa2,
+    0x4b, 0xb7, 0x89, 0xd4, 0xcc, 0x23, 0x36, 0xc1,
+    0x73, 0x7f, 0x05, 0x32, 0x3f, 0x3d, 0x6f, 0x83,
+    0x79, 0x0b, 0x47, 0xc7, 0x94, 0x86, 0xd4, 0xd0,
+    0x46, 0x58, 0x43, 0x75, 0x24, 0xa1, 0x63, 0xd1,
+    0x6a, 0xc2, 0x61, 0x42, 0xca, 0x0b, 0x00, 0x7a,
+    0x8f, 0x8b, 0x1a, 0x22, 0xb5, 0xc6, 0xd9, 0xa8,
+    0xcc, 0x51, 0x18, 0xfa, 0xe6, 0xf5, 0x35, 0x23,
+    0x25, 0xa7, 0x38, 0xe5, 0xc7, 0x25, 0x81, 0x60,
+    0x39, 0x4b, 0x37, 0x84, 0x48, 0xec, 0x94, 0x57,
+    0x3a, 0xe0, 0x69, 0xe7, 0x3b, 0x4d, 0x9a, 0x9e,
+    0xfc, 0xd1, 0x31, 0x42, 0x9e, 0x02, 0x8a, 0x91,
+    0x0a, 0x52, 0xc2, 0x21, 0x5f, 0x34, 0xa7, 0x6a,
+    0x92, 0x0d, 0xc7, 0x0f, 0x7c, 0xd0, 0xcd, 0xea,
+    0x18, 0x3a, 0xa5, 0x52, 0x13, 0x88, 0x07, 0xae,
+    0xc2, 0x64, 0x71, 0x8f, 0xe0, 0x48, 0x53, 0xc4,
+    0x3b, 0x39, 0x68, 0x53, 0x98, 0x45, 0xed, 0x22,
+    0xc5, 0xfd, 0xb4, 0xb5, 0x25, 0x25, 0xd6, 0xed,
+    0xf9, 0x73, 0xbb, 0x0e,
+};
+
 static void _test_chacha20poly1305(const uint8_t *key, const uint8_t *nonce,
                                    const uint8_t *msg, size_t msglen,
-                                   const uint8_t *aad, size_t aadlen)
+                                   const uint8_t *aad, size_t aadlen,
+                                   const uint8_t *ciphertext)
 {
     memcpy(ebuf, msg, msglen);
     chacha20poly1305_encrypt(ebuf, msg, msglen, aad, aadlen, key, nonce);
-    TEST_ASSERT_EQUAL_INT(0, memcmp(ebuf, ciphertext_1, msglen + 16));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(ebuf, ciphertext, msglen + 16));
     size_t len;
     TEST_ASSERT_EQUAL_INT(1,
             chacha20poly1305_decrypt(ebuf, msglen+16, pbuf, &len, aad, aadlen, key, nonce));
-    TEST_ASSERT_EQUAL_INT(0, memcmp(pbuf, msg_1, msglen));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(pbuf, msg, msglen));
 }
 
 static void test_crypto_chacha20poly1305_1(void)
 {
-    _test_chacha20poly1305(key_1, nonce_1, msg_1, sizeof(msg_1), aad_1, sizeof(aad_1));
+    _test_chacha20poly1305(key_1, nonce_1, msg_1, sizeof(msg_1), aad_1, sizeof(aad_1),
+                           ciphertext_1);
+}
+
+static void test_crypto_chacha20poly1305_2(void)
+{
+    for (unsigned i = 0; i < sizeof(msg_2); i++) {
+        msg_2[i] = i * 13 + 5;
+    }
+    _test_chacha20poly1305(key_2, nonce_2, msg_2, sizeof(msg_2), aad_2, sizeof(aad_2),
+                           ciphertext_2);
 }
 
 Test *tests_crypto_chacha20poly1305_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_crypto_chacha20poly1305_1),
+        new_TestFixture(test_crypto_chacha20poly1305_2),
     };
     EMB_UNIT_TESTCALLER(crypto_chacha20poly1305_tests, NULL, NULL, fixtures);
     return (Test *) &crypto_chacha20poly1305_tests;
@@ -999,6 +999,104 @@ static const uint8_t TEST_MANUAL_01_EXPECTED[] = {
 };
 static const size_t TEST_MANUAL_01_EXPECTED_LEN = 318;
 
+/* Associated data of 256 bytes, whose length has a zero low byte. The Adata
+ * flag of B0 must be set nevertheless. Created with a reference implementation
+ * on top of the AES of OpenSSL, which reproduces the vectors above */
+static const uint8_t TEST_MANUAL_02_KEY[] = {
+    0xDC, 0x1F, 0x67, 0xF2, 0xBD, 0x83, 0x92, 0xCE,
+    0x9B, 0x65, 0x63, 0x4C, 0x8C, 0x20, 0x11, 0xA4,
+};
+static const size_t TEST_MANUAL_02_KEY_LEN = 16;
+static const uint8_t TEST_MANUAL_02_NONCE[] = {
+    0x1F, 0x62, 0x7D, 0x2F, 0x1C, 0xF4, 0xD2, 0x7F,
+    0x0C, 0x7E, 0xE0, 0xC7, 0x2D,
+};
+static const size_t TEST_MANUAL_02_NONCE_LEN = 13;
+static const size_t TEST_MANUAL_02_MAC_LEN = 8;
+static const uint8_t TEST_MANUAL_02_INPUT[] = {
+    /* AAD */
+    0xDB, 0x49, 0xAD, 0x3D, 0x81, 0x96, 0x9D, 0x81,
+    0x31, 0x40, 0x03, 0x8A, 0xFD, 0x50, 0xA8, 0x9E,
+    0xA3, 0x46, 0x80, 0xDA, 0x61, 0xD4, 0xC4, 0x03,
+    0x61, 0x50, 0x75, 0x09, 0xEB, 0xAE, 0x7E, 0x37,
+    0xF6, 0xA6, 0x82, 0xB7, 0x3F, 0x49, 0x51, 0xDD,
+    0xA7, 0x85, 0xBA, 0x2B, 0x46, 0xB8, 0x66, 0x19,
+    0x4D, 0xDB, 0xF4, 0xD7, 0xD0, 0xC1, 0x91, 0xAE,
+    0x00, 0x56, 0x1E, 0x7C, 0xCB, 0xA3, 0x27, 0xCC,
+    0xB9, 0x93, 0xC7, 0x42, 0xAB, 0x14, 0x81, 0x3C,
+    0x55, 0xF0, 0x6D, 0xBE, 0x17, 0xDB, 0xE1, 0xC4,
+    0xD6, 0x25, 0x53, 0xBD, 0xB2, 0x67, 0xB8, 0x3B,
+    0xE0, 0x24, 0x3D, 0xB9, 0x55, 0xA8, 0x7A, 0x88,
+    0xF8, 0x77, 0xF4, 0x9B, 0x4D, 0x03, 0xC4, 0xC9,
+    0x0C, 0xF1, 0x97, 0x8F, 0x7B, 0x18, 0xCD, 0xD7,
+    0xEA, 0x24, 0x33, 0x2D, 0x7F, 0x20, 0xF4, 0x36,
+    0x23, 0xF8, 0xDC, 0x6D, 0x5E, 0x7B, 0xA1, 0xAD,
+    0xDB, 0xF7, 0xFD, 0xDC, 0xD7, 0xDD, 0x02, 0xE9,
+    0x98, 0x6D, 0x24, 0xA3, 0x33, 0x70, 0x2F, 0xA3,
+    0x81, 0xFF, 0xE9, 0x8F, 0x59, 0x80, 0x66, 0x2A,
+    0x47, 0x38, 0x6F, 0x81, 0x8F, 0xDE, 0x42, 0x8C,
+    0x13, 0x51, 0xE0, 0x51, 0xB1, 0x5A, 0xF6, 0x09,
+    0xD5, 0x00, 0x38, 0x3C, 0x63, 0xC6, 0x0A, 0xE2,
+    0x3F, 0xF1, 0x1E, 0xA8, 0x20, 0x8F, 0x62, 0x72,
+    0x12, 0xDA, 0x05, 0x8D, 0x87, 0x28, 0x5B, 0x41,
+    0x20, 0x72, 0xCD, 0x08, 0xBA, 0xBD, 0x85, 0x34,
+    0x42, 0xAD, 0xDD, 0xC3, 0xA4, 0x1E, 0x8F, 0xDB,
+    0x72, 0xF5, 0xA1, 0xCC, 0x2E, 0x04, 0xE3, 0xAA,
+    0x80, 0x03, 0x3D, 0xE1, 0x64, 0x1E, 0xE9, 0xB9,
+    0x32, 0xB7, 0xFE, 0x41, 0x8D, 0x79, 0x7C, 0xDA,
+    0x18, 0x54, 0xE9, 0xE1, 0x52, 0x32, 0x00, 0xCC,
+    0x74, 0x03, 0xDD, 0x19, 0x87, 0x97, 0xFE, 0x27,
+    0x70, 0xB3, 0xC3, 0x55, 0x2F, 0xC7, 0x45, 0x65,
+    /* PLAINTEXT */
+    0x2A, 0xF5, 0x30, 0x74, 0x5F, 0x0A, 0x34, 0x09,
+    0xC6, 0x0D, 0x0D, 0x1B, 0x40, 0xB3, 0x2B, 0xBB,
+    0x55, 0x4E, 0xB4, 0xAF,
+};
+static const size_t TEST_MANUAL_02_INPUT_LEN = 20;
+static const size_t TEST_MANUAL_02_ADATA_LEN = 256;
+static const uint8_t TEST_MANUAL_02_EXPECTED[] = {
+    /* AAD */
+    0xDB, 0x49, 0xAD, 0x3D, 0x81, 0x96, 0x9D, 0x81,
+    0x31, 0x40, 0x03, 0x8A, 0xFD, 0x50, 0xA8, 0x9E,
+    0xA3, 0x46, 0x80, 0xDA, 0x61, 0xD4, 0xC4, 0x03,
+    0x61, 0x50, 0x75, 0x09, 0xEB, 0xAE, 0x7E, 0x37,
+    0xF6, 0xA6, 0x82, 0xB7, 0x3F, 0x49, 0x51, 0xDD,
+    0xA7, 0x85, 0xBA, 0x2B, 0x46, 0xB8, 0x66, 0x19,
+    0x4D, 0xDB, 0xF4, 0xD7, 0xD0, 0xC1, 0x91, 0xAE,
+    0x00, 0x56, 0x1E, 0x7C, 0xCB, 0xA3, 0x27, 0xCC,
+    0xB9, 0x93, 0xC7, 0x42, 0xAB, 0x14, 0x81, 0x3C,
+    0x55, 0xF0, 0x6D, 0xBE, 0x17, 0xDB, 0xE1, 0xC4,
+    0xD6, 0x25, 0x53, 0xBD, 0xB2, 0x67, 0xB8, 0x3B,
+    0xE0, 0x24, 0x3D, 0xB9, 0x55, 0xA8, 0x7A, 0x88,
+    0xF8, 0x77, 0xF4, 0x9B, 0x4D, 0x03, 0xC4, 0xC9,
+    0x0C, 0xF1, 0x97, 0x8F, 0x7B, 0x18, 0xCD, 0xD7,
+    0xEA, 0x24, 0x33, 0x2D, 0x7F, 0x20, 0xF4, 0x36,
+    0x23, 0xF8, 0xDC, 0x6D, 0x5E, 0x7B, 0xA1, 0xAD,
+    0xDB, 0xF7, 0xFD, 0xDC, 0xD7, 0xDD, 0x02, 0xE9,
+    0x98, 0x6D, 0x24, 0xA3, 0x33, 0x70, 0x2F, 0xA3,
+    0x81, 0xFF, 0xE9, 0x8F, 0x59, 0x80, 0x66, 0x2A,
+    0x47, 0x38, 0x6F, 0x81, 0x8F, 0xDE, 0x42, 0x8C,
+    0x13, 0x51, 0xE0, 0x51, 0xB1, 0x5A, 0xF6, 0x09,
+    0xD5, 0x00, 0x38, 0x3C, 0x63, 0xC6, 0x0A, 0xE2,
+    0x3F, 0xF1, 0x1E, 0xA8, 0x20, 0x8F, 0x62, 0x72,
+    0x12, 0xDA, 0x05, 0x8D, 0x87, 0x28, 0x5B, 0x41,
+    0x20, 0x72, 0xCD, 0x08, 0xBA, 0xBD, 0x85, 0x34,
+    0x42, 0xAD, 0xDD, 0xC3, 0xA4, 0x1E, 0x8F, 0xDB,
+    0x72, 0xF5, 0xA1, 0xCC, 0x2E, 0x04, 0xE3, 0xAA,
+    0x80, 0x03, 0x3D, 0xE1, 0x64, 0x1E, 0xE9, 0xB9,
+    0x32, 0xB7, 0xFE, 0x41, 0x8D, 0x79, 0x7C, 0xDA,
+    0x18, 0x54, 0xE9, 0xE1, 0x52, 0x32, 0x00, 0xCC,
+    0x74, 0x03, 0xDD, 0x19, 0x87, 0x97, 0xFE, 0x27,
+    0x70, 0xB3, 0xC3, 0x55, 0x2F, 0xC7, 0x45, 0x65,
+    /* CIPHERTEXT */
+    0x5E, 0x6F, 0x9F, 0x0F, 0x3F, 0x12, 0xC0, 0x89,
+    0x40, 0xE4, 0xDC, 0x46, 0x62, 0x4C, 0x47, 0x3C,
+    0x27, 0xD3, 0xE0, 0x2F,
+    /* MAC */
+    0x2A, 0xA5, 0xFB, 0xFD, 0x46, 0xB5, 0xAA, 0x0B,
+};
+static const size_t TEST_MANUAL_02_EXPECTED_LEN = 284;
+
 /* Test to check that the whole plaintext_len is written */
 static const uint8_t TEST_CUSTOM_1_KEY[]        = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -1198,6 +1296,7 @@ static void test_crypto_modes_ccm_encrypt(void)
     do_test_encrypt_op(WYCHEPROOF_28);
 
     do_test_encrypt_op(MANUAL_01);
+    do_test_encrypt_op(MANUAL_02);
     do_test_encrypt_op(CUSTOM_1);
 }
 
@@ -1251,6 +1350,7 @@ static void test_crypto_modes_ccm_decrypt(void)
     do_test_decrypt_op(WYCHEPROOF_28);
 
     do_test_decrypt_op(MANUAL_01);
+    do_test_decrypt_op(MANUAL_02);
     do_test_decrypt_op(CUSTOM_1);
 }
 
@@ -1259,6 +1359,98 @@ typedef int (*func_ccm_t)(const cipher_t *, const uint8_t *, uint32_t,
                           uint8_t, uint8_t, const uint8_t *, size_t,
                           const uint8_t *, size_t, uint8_t *);
 
+/* encrypts and decrypts in parts of varying length with the incremental API */
+static void test_stream_op(const uint8_t *key, uint8_t key_len,
+                           const uint8_t *adata, size_t adata_len,
+                           const uint8_t *nonce, uint8_t nonce_len,
+                           const uint8_t *plain, size_t plain_len,
+                           const uint8_t *output_expected,
+                           size_t output_expected_len,
+                           uint8_t mac_length)
+{
+    static const uint8_t parts[] = { 1, 15, 17, 2, 33 };
+    cipher_t cipher;
+    cipher_ccm_t ccm;
+    int err, cmp;
+    size_t len_encoding = nonce_and_len_encoding_size - nonce_len;
+    size_t pos = 0;
+
+    TEST_ASSERT_MESSAGE(sizeof(data) >= output_expected_len,
+                        "Output buffer too small");
+
+    err = cipher_init(&cipher, CIPHER_AES_128, key, key_len);
+    TEST_ASSERT_EQUAL_INT(1, err);
+
+    err = cipher_ccm_init(&ccm, &cipher, adata, adata_len, mac_length,
+                          len_encoding, nonce, nonce_len, plain_len);
+    TEST_ASSERT_EQUAL_INT(0, err);
+    for (unsigned i = 0; pos < plain_len; i++) {
+        size_t len = parts[i % sizeof(parts)];
+
+        len = (len > plain_len - pos) ? plain_len - pos : len;
+        err = cipher_ccm_encrypt_update(&ccm, plain + pos, len, data + pos);
+        TEST_ASSERT_EQUAL_INT(len, err);
+        pos += len;
+    }
+    err = cipher_ccm_encrypt_finish(&ccm, data + pos);
+    TEST_ASSERT_EQUAL_INT(mac_length, err);
+    TEST_ASSERT_EQUAL_INT(output_expected_len, pos + mac_length);
+    cmp = compare(output_expected, data, output_expected_len);
+    TEST_ASSERT_MESSAGE(1 == cmp, "wrong ciphertext");
+
+    /* decrypt in place */
+    err = cipher_ccm_init(&ccm, &cipher, adata, adata_len, mac_length,
+                          len_encoding, nonce, nonce_len, plain_len);
+    TEST_ASSERT_EQUAL_INT(0, err);
+    for (pos = 0; pos < plain_len; pos++) {
+        err = cipher_ccm_decrypt_update(&ccm, data + pos, 1, data + pos);
+        TEST_ASSERT_EQUAL_INT(1, err);
+    }
+    err = cipher_ccm_decrypt_update(&ccm, data, 1, data);
+    TEST_ASSERT_EQUAL_INT(CCM_ERR_INVALID_DATA_LENGTH, err);
+    err = cipher_ccm_decrypt_finish(&ccm, output_expected + plain_len);
+    TEST_ASSERT_EQUAL_INT(0, err);
+    cmp = compare(plain, data, plain_len);
+    TEST_ASSERT_MESSAGE(1 == cmp, "wrong plaintext");
+
+    /* a modified MAC must be detected */
+    memcpy(data, output_expected, output_expected_len);
+    data[output_expected_len - 1] ^= 0x01;
+    err = cipher_ccm_init(&ccm, &cipher, adata, adata_len, mac_length,
+                          len_encoding, nonce, nonce_len, plain_len);
+    TEST_ASSERT_EQUAL_INT(0, err);
+    err = cipher_ccm_decrypt_update(&ccm, data, plain_len, data);
+    TEST_ASSERT_EQUAL_INT(plain_len, err);
+    err = cipher_ccm_decrypt_finish(&ccm, data + plain_len);
+    TEST_ASSERT_EQUAL_INT(CCM_ERR_INVALID_CBC_MAC, err);
+}
+
+#define do_test_stream_op(name) do { \
+        test_stream_op(TEST_ ## name ## _KEY, TEST_ ## name ## _KEY_LEN, \
+                       TEST_ ## name ## _INPUT, TEST_ ## name ## _ADATA_LEN, \
+                       TEST_ ## name ## _NONCE, TEST_ ## name ## _NONCE_LEN, \
+                    \
+                       TEST_ ## name ## _INPUT + TEST_ ## name ## _ADATA_LEN, \
+                       TEST_ ## name ## _INPUT_LEN, \
+                    \
+                       TEST_ ## name ## _EXPECTED + TEST_ ## name ## _ADATA_LEN, \
+                       TEST_ ## name ## _EXPECTED_LEN - TEST_ ## name ## _ADATA_LEN, \
+                    \
+                       TEST_ ## name ## _MAC_LEN \
+                       ); \
+} while (0)
+
+static void test_crypto_modes_ccm_stream(void)
+{
+    do_test_stream_op(RFC_1);
+    do_test_stream_op(RFC_4);
+    do_test_stream_op(NIST_1);
+    do_test_stream_op(MANUAL_01);
+    do_test_stream_op(MANUAL_02);
+    do_test_stream_op(CUSTOM_1);
+}
+
+
 static int _test_ccm_len(func_ccm_t func, uint8_t len_encoding,
                          const uint8_t *input, size_t input_len,
                          size_t adata_len)
@@ -1335,6 +1527,7 @@ Test *tests_crypto_modes_ccm_tests(void)
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_crypto_modes_ccm_encrypt),
         new_TestFixture(test_crypto_modes_ccm_decrypt),
+        new_TestFixture(test_crypto_modes_ccm_stream),
         new_TestFixture(test_crypto_modes_ccm_check_len),
     };
 
@@ -0,0 +1 @@
+../sys_crypto/tests-crypto-aes.c
\ No newline at end of file
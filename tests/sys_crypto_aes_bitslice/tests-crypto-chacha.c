@@ -0,0 +1 @@
+../sys_crypto/tests-crypto-chacha.c
\ No newline at end of file
@@ -0,0 +1 @@
+../sys_crypto/tests-crypto-chacha20poly1305.c
\ No newline at end of file
@@ -0,0 +1 @@
+../sys_crypto/tests-crypto-cipher.c
\ No newline at end of file
@@ -0,0 +1 @@
+../sys_crypto/tests-crypto-helper.c
\ No newline at end of file
@@ -0,0 +1 @@
+../sys_crypto/tests-crypto-modes-cbc.c
\ No newline at end of file
@@ -0,0 +1 @@
+../sys_crypto/tests-crypto-modes-ccm.c
\ No newline at end of file
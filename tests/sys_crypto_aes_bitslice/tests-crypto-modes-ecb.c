@@ -0,0 +1 @@
+../sys_crypto/tests-crypto-modes-ecb.c
\ No newline at end of file
@@ -0,0 +1 @@
+../sys_crypto/tests-crypto-modes-ocb.c
\ No newline at end of file
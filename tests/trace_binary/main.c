@@ -0,0 +1,47 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the binary output of the trace module
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "trace.h"
+
+/* the largest values encoded in 1 to 5 bytes and the smallest in 2 to 5 */
+static const uint32_t _args[] = {
+    0, 0x7f, 0x80, 0x3fff, 0x4000, 0x1fffff, 0x200000, 0xfffffff, 0x10000000,
+    UINT32_MAX,
+};
+
+int main(void)
+{
+    trace(0x12345678);
+    for (unsigned i = 0; i < ARRAY_SIZE(_args); i += TRACE_ARGS_MAX) {
+        unsigned argc = ARRAY_SIZE(_args) - i;
+
+        if (argc > TRACE_ARGS_MAX) {
+            argc = TRACE_ARGS_MAX;
+        }
+        trace_event(TRACE_EVENT_APP + i, argc, &_args[i]);
+    }
+
+    puts("START");
+    trace_dump_binary();
+    puts("\nEND");
+
+    return 0;
+}
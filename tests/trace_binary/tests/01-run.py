@@ -0,0 +1,66 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2021 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import json
+import os
+import subprocess
+import sys
+
+import pexpect
+from testrunner import setup_child, teardown_child
+
+RIOTBASE = os.environ.get("RIOTBASE") or \
+    os.path.join(os.path.dirname(__file__), "..", "..", "..")
+TRACE2JSON = os.path.join(RIOTBASE, "dist", "tools", "trace", "trace2json.py")
+
+# must match main.c
+ARGS = [0, 0x7f, 0x80, 0x3fff, 0x4000, 0x1fffff, 0x200000, 0xfffffff,
+        0x10000000, 0xffffffff]
+TRACE_ARGS_MAX = 3
+
+
+def expected_events():
+    events = [("trace", {"val": 0x12345678})]
+    for i in range(0, len(ARGS), TRACE_ARGS_MAX):
+        args = ARGS[i:i + TRACE_ARGS_MAX]
+        events.append(("app_{:#x}".format(0x80 + i),
+                       {"arg{}".format(n): val for n, val in enumerate(args)}))
+    return events
+
+
+def testfunc(child):
+    child.expect_exact(b"START\r\n")
+    child.expect_exact(b"\r\nEND\r\n")
+    # the pty translates every "\n" into "\r\n"
+    data = child.before.replace(b"\r\n", b"\n")
+
+    out = subprocess.run([sys.executable, TRACE2JSON], input=data,
+                         stdout=subprocess.PIPE, check=True).stdout
+    events = [e for e in json.loads(out)["traceEvents"] if e["ph"] == "i"]
+
+    assert [(e["name"], e["args"]) for e in events] == expected_events()
+    times = [e["ts"] for e in events]
+    assert times == sorted(times)
+    print("SUCCESS")
+
+
+def main():
+    child = setup_child(env=os.environ, logfile=sys.stdout.buffer,
+                        spawnclass=pexpect.spawn)
+    try:
+        testfunc(child)
+    except (pexpect.TIMEOUT, pexpect.EOF, AssertionError) as exc:
+        print("FAILED: {}".format(repr(exc)))
+        return 1
+    finally:
+        teardown_child(child)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the trace points of the trace module
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "msg.h"
+#include "mutex.h"
+#include "thread.h"
+#include "trace.h"
+
+#define MSG_TYPE        (0x4242)
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static mutex_t _mutex = MUTEX_INIT;
+
+static void *_receiver(void *arg)
+{
+    msg_t msg;
+
+    (void)arg;
+    msg_receive(&msg);
+    return NULL;
+}
+
+int main(void)
+{
+    /* the trace points run since the first context switch, getting here
+     * shows that they work before ztimer is initialized */
+    puts("trace_points test application");
+
+    kernel_pid_t pid = thread_create(_stack, sizeof(_stack),
+                                     THREAD_PRIORITY_MAIN - 1,
+                                     THREAD_CREATE_STACKTEST, _receiver,
+                                     NULL, "receiver");
+    msg_t msg = { .type = MSG_TYPE };
+
+    trace_reset();
+    msg_send(&msg, pid);
+    mutex_lock(&_mutex);
+    mutex_unlock(&_mutex);
+
+    printf("receiver: %u, mutex: %p\n", (unsigned)pid, (void *)&_mutex);
+    trace_dump();
+    puts("DONE");
+
+    return 0;
+}
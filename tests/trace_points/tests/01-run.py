@@ -0,0 +1,38 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2021 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+# see trace_event_id_t
+EVENT_SCHED = 1
+EVENT_MSG_SEND = 2
+EVENT_MUTEX_LOCK = 3
+
+
+def event(event_id, *args):
+    line = r"n=\s*\d+ t=[ +]\s*\d+ e=\s*{}".format(event_id)
+    for arg in args:
+        line += r" 0x{:08x}".format(arg) if arg is not None else r" 0x[0-9a-f]{8}"
+    return line + r"\r\n"
+
+
+def testfunc(child):
+    child.expect_exact("trace_points test application")
+    child.expect(r"receiver: (\d+), mutex: (0x)?([0-9a-fA-F]+)\r\n")
+    pid = int(child.match.group(1))
+    mutex = int(child.match.group(3), 16)
+    child.expect(event(EVENT_MSG_SEND, pid, 0x4242))
+    child.expect(event(EVENT_SCHED, pid))
+    child.expect(event(EVENT_SCHED, None))
+    child.expect(event(EVENT_MUTEX_LOCK, mutex & 0xffffffff, 0))
+    child.expect_exact("DONE")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
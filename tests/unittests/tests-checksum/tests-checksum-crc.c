@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit/embUnit.h"
+
+#include "checksum/crc.h"
+
+#include "tests-checksum.h"
+
+static crc_engine_t engine;
+static uint8_t buf[300];
+
+static uint32_t calc_with_update(const void *data, size_t len, size_t split)
+{
+    uint32_t crc = crc_start(&engine);
+
+    crc = crc_update(&engine, crc, data, split);
+    crc = crc_update(&engine, crc, (const uint8_t *)data + split, len - split);
+    return crc_finish(&engine, crc);
+}
+
+static void calc_and_compare_crc(const void *data, size_t len,
+                                 uint32_t expect)
+{
+    TEST_ASSERT_EQUAL_INT(expect, crc_calc(&engine, data, len));
+    TEST_ASSERT_EQUAL_INT(expect, calc_with_update(data, len, len / 2));
+}
+
+/* same reference values as for crc8() */
+static void test_checksum_crc_crc8(void)
+{
+    const uint8_t bytes[] = { 0x12, 0x34, 0x56, 0x78 };
+
+    crc_engine_init(&engine, &crc_params_crc8);
+    memset(buf, 'A', 256);
+
+    calc_and_compare_crc("", 0, 0xFF);
+    calc_and_compare_crc("A", 1, 0xA0);
+    calc_and_compare_crc(buf, 256, 0xF0);
+    calc_and_compare_crc("123456789", 9, 0xF7);
+    calc_and_compare_crc(bytes, sizeof(bytes), 0xE0);
+}
+
+/* same reference values as for crc16_ccitt_calc() and ucrc16_calc_be() */
+static void test_checksum_crc_crc16_ccitt(void)
+{
+    const uint8_t bytes[] = { 0x12, 0x34, 0x56, 0x78 };
+
+    crc_engine_init(&engine, &crc_params_crc16_ccitt);
+    memset(buf, 'A', 256);
+
+    calc_and_compare_crc("", 0, 0x1D0F);
+    calc_and_compare_crc("A", 1, 0x9479);
+    calc_and_compare_crc(buf, 256, 0xE938);
+    calc_and_compare_crc("123456789", 9, 0xE5CC);
+    calc_and_compare_crc(bytes, sizeof(bytes), 0xBA3C);
+}
+
+/* same reference value as for ucrc16_calc_le() */
+static void test_checksum_crc_crc16_kermit(void)
+{
+    const uint8_t frame[] = { 0x41, 0xcc, 0xa4, 0xff, 0xff, 0x8a, 0x18, 0x00,
+                              0xff, 0xff, 0xda, 0x1c, 0x00, 0x88, 0x18, 0x00,
+                              0xff, 0xff, 0xda, 0x1c, 0x00, 0x41, 0x60, 0x00,
+                              0x00, 0x00, 0x00, 0x19, 0x11, 0x40, 0xfe, 0x80,
+                              0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c,
+                              0xda, 0xff, 0xff, 0x00, 0x18, 0x88, 0xfe, 0x80,
+                              0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c,
+                              0xda, 0xff, 0xff, 0x00, 0x18, 0x8a, 0x04, 0x01,
+                              0xf0, 0xb1, 0x00, 0x19, 0xea, 0x8a, 0x48, 0x65,
+                              0x6c, 0x6c, 0x6f, 0x20, 0x30, 0x30, 0x33, 0x20,
+                              0x30, 0x78, 0x43, 0x35, 0x39, 0x41, 0x0a };
+
+    crc_engine_init(&engine, &crc_params_crc16_kermit);
+
+    calc_and_compare_crc(frame, sizeof(frame), 0x31f9);
+    calc_and_compare_crc("123456789", 9, 0x2189);
+}
+
+static void test_checksum_crc_crc32(void)
+{
+    crc_engine_init(&engine, &crc_params_crc32);
+
+    calc_and_compare_crc("", 0, 0);
+    calc_and_compare_crc("123456789", 9, 0xCBF43926);
+    calc_and_compare_crc("The quick brown fox jumps over the lazy dog", 43,
+                         0x414FA339);
+
+    crc_engine_init(&engine, &crc_params_crc32c);
+
+    calc_and_compare_crc("123456789", 9, 0xE3069283);
+}
+
+/* splitting the data must not change the result, whatever path each part
+ * takes */
+static void test_checksum_crc_update_split(void)
+{
+    const crc_params_t *params[] = {
+        &crc_params_crc8, &crc_params_crc16_ccitt, &crc_params_crc32,
+    };
+
+    for (unsigned i = 0; i < sizeof(buf); i++) {
+        buf[i] = i * 7 + 3;
+    }
+
+    for (unsigned i = 0; i < ARRAY_SIZE(params); i++) {
+        crc_engine_init(&engine, params[i]);
+        uint32_t expect = crc_calc(&engine, buf, sizeof(buf));
+
+        for (size_t split = 0; split <= sizeof(buf); split += 13) {
+            TEST_ASSERT_EQUAL_INT(expect,
+                                  calc_with_update(buf, sizeof(buf), split));
+        }
+    }
+}
+
+Test *tests_checksum_crc_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_checksum_crc_crc8),
+        new_TestFixture(test_checksum_crc_crc16_ccitt),
+        new_TestFixture(test_checksum_crc_crc16_kermit),
+        new_TestFixture(test_checksum_crc_crc32),
+        new_TestFixture(test_checksum_crc_update_split),
+    };
+
+    EMB_UNIT_TESTCALLER(checksum_crc_tests, NULL, NULL, fixtures);
+
+    return (Test *)&checksum_crc_tests;
+}
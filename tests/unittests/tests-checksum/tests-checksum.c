@@ -10,6 +10,7 @@
 
 void tests_checksum(void)
 {
+    TESTS_RUN(tests_checksum_crc_tests());
     TESTS_RUN(tests_checksum_crc8_tests());
     TESTS_RUN(tests_checksum_crc16_ccitt_tests());
     TESTS_RUN(tests_checksum_fletcher16_tests());
@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "event.h"
+#include "event/ordered.h"
+#include "tests-event_ordered.h"
+
+#define EVENTS_NUMOF    (6U)
+
+static event_queue_t _queue;
+static event_ordered_t _events[EVENTS_NUMOF];
+
+static void set_up(void)
+{
+    memset(_events, 0, sizeof(_events));
+    event_queue_init_ordered_detached(&_queue);
+}
+
+/* position of the next event in _events, -1 if the queue is empty */
+static int _take(void)
+{
+    event_t *event = event_get(&_queue);
+
+    if (event == NULL) {
+        return -1;
+    }
+    return container_of(event, event_ordered_t, super) - _events;
+}
+
+static void test_event_ordered_priority(void)
+{
+    static const uint32_t keys[EVENTS_NUMOF] = { 5, 1, 3, 1, 5, 0 };
+    /* events with the same key in the order they were posted */
+    static const int order[EVENTS_NUMOF] = { 5, 1, 3, 2, 0, 4 };
+
+    for (unsigned i = 0; i < EVENTS_NUMOF; i++) {
+        event_post_ordered(&_queue, &_events[i], keys[i]);
+    }
+    for (unsigned i = 0; i < EVENTS_NUMOF; i++) {
+        TEST_ASSERT_EQUAL_INT(order[i], _take());
+    }
+    TEST_ASSERT_EQUAL_INT(-1, _take());
+}
+
+static void test_event_ordered_deadline(void)
+{
+    /* deadlines around the wrap-around of the clock */
+    static const uint32_t keys[EVENTS_NUMOF] = {
+        0x10, 0xfffffff0, 0x0, 0xfffffff8, 0x10, 0xfffffff0,
+    };
+    static const int order[EVENTS_NUMOF] = { 1, 5, 3, 2, 0, 4 };
+
+    for (unsigned i = 0; i < EVENTS_NUMOF; i++) {
+        event_post_ordered(&_queue, &_events[i], keys[i]);
+    }
+    for (unsigned i = 0; i < EVENTS_NUMOF; i++) {
+        TEST_ASSERT_EQUAL_INT(order[i], _take());
+    }
+    TEST_ASSERT_EQUAL_INT(-1, _take());
+}
+
+static void test_event_ordered_repost(void)
+{
+    event_post_ordered(&_queue, &_events[0], 10);
+    event_post_ordered(&_queue, &_events[1], 20);
+    event_post_ordered(&_queue, &_events[2], 30);
+    event_post_ordered(&_queue, &_events[3], 20);
+
+    /* an earlier key moves the queued event forward, behind equal keys */
+    event_post_ordered(&_queue, &_events[2], 20);
+    TEST_ASSERT_EQUAL_INT(20, _events[2].key);
+    event_post_ordered(&_queue, &_events[3], 5);
+    /* a later or equal key leaves it where it is */
+    event_post_ordered(&_queue, &_events[0], 50);
+    event_post_ordered(&_queue, &_events[1], 20);
+    TEST_ASSERT_EQUAL_INT(10, _events[0].key);
+
+    TEST_ASSERT_EQUAL_INT(3, _take());
+    TEST_ASSERT_EQUAL_INT(0, _take());
+    TEST_ASSERT_EQUAL_INT(1, _take());
+    TEST_ASSERT_EQUAL_INT(2, _take());
+    TEST_ASSERT_EQUAL_INT(-1, _take());
+
+    /* an event taken from the queue is posted anew */
+    event_post_ordered(&_queue, &_events[1], 40);
+    event_post_ordered(&_queue, &_events[0], 50);
+    TEST_ASSERT_EQUAL_INT(1, _take());
+    TEST_ASSERT_EQUAL_INT(0, _take());
+    TEST_ASSERT_EQUAL_INT(-1, _take());
+}
+
+static void test_event_ordered_post(void)
+{
+    /* event_post() uses the key already set in the event */
+    _events[0].key = 7;
+    _events[1].key = 3;
+    event_post(&_queue, &_events[0].super);
+    event_post(&_queue, &_events[1].super);
+    event_post_ordered(&_queue, &_events[2], 5);
+    /* posting a queued event again has no effect */
+    event_post(&_queue, &_events[0].super);
+
+    TEST_ASSERT_EQUAL_INT(1, _take());
+    TEST_ASSERT_EQUAL_INT(2, _take());
+    TEST_ASSERT_EQUAL_INT(0, _take());
+    TEST_ASSERT_EQUAL_INT(-1, _take());
+}
+
+static void test_event_ordered_cancel(void)
+{
+    event_post_ordered(&_queue, &_events[0], 1);
+    event_post_ordered(&_queue, &_events[1], 2);
+    event_post_ordered(&_queue, &_events[2], 3);
+    event_cancel(&_queue, &_events[1].super);
+    /* a canceled event is posted anew */
+    event_post_ordered(&_queue, &_events[1], 4);
+
+    TEST_ASSERT_EQUAL_INT(0, _take());
+    TEST_ASSERT_EQUAL_INT(2, _take());
+    TEST_ASSERT_EQUAL_INT(1, _take());
+    TEST_ASSERT_EQUAL_INT(-1, _take());
+}
+
+static Test *tests_event_ordered_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_event_ordered_priority),
+        new_TestFixture(test_event_ordered_deadline),
+        new_TestFixture(test_event_ordered_repost),
+        new_TestFixture(test_event_ordered_post),
+        new_TestFixture(test_event_ordered_cancel),
+    };
+
+    EMB_UNIT_TESTCALLER(event_ordered_tests, set_up, NULL, fixtures);
+
+    return (Test *)&event_ordered_tests;
+}
+
+void tests_event_ordered(void)
+{
+    TESTS_RUN(tests_event_ordered_tests());
+}
+/** @} */
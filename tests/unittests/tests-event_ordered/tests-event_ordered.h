@@ -0,0 +1,35 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @addtogroup  unittests
+ * @{
+ *
+ * @file
+ * @brief       Unittests for ordered event queues
+ */
+#ifndef TESTS_EVENT_ORDERED_H
+#define TESTS_EVENT_ORDERED_H
+
+#include "embUnit.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Entry point of the test suite
+ */
+void tests_event_ordered(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TESTS_EVENT_ORDERED_H */
+/** @} */
@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Unittests for the FIB longest prefix match trie
+ */
+
+#include <string.h>
+#include <errno.h>
+#include "embUnit.h"
+#include "tests-fib.h"
+#include "xtimer.h"
+
+#include "net/fib.h"
+
+#define TEST_FIB_TRIE_TABLE_SIZE    (20)
+#define TEST_ADDR_SIZE              (16)
+
+static fib_entry_t _entries[TEST_FIB_TRIE_TABLE_SIZE];
+static fib_trie_node_t _nodes[FIB_TRIE_NODES_NUMOF(TEST_FIB_TRIE_TABLE_SIZE)];
+static fib_table_t test_fib_table = { .data.entries = _entries,
+                                      .table_type = FIB_TABLE_TYPE_SH,
+                                      .size = TEST_FIB_TRIE_TABLE_SIZE,
+                                      .mtx_access = MUTEX_INIT,
+                                      .notify_rp_pos = 0,
+                                      .trie_nodes = _nodes };
+
+static void set_up(void)
+{
+    fib_init(&test_fib_table);
+}
+
+static void tear_down(void)
+{
+    fib_deinit(&test_fib_table);
+}
+
+static int _add(uint8_t b0, uint8_t b1, uint8_t b15, unsigned prefix_len,
+                uint8_t nh, uint32_t lifetime)
+{
+    uint8_t dst[TEST_ADDR_SIZE] = { b0, b1 };
+    uint8_t next_hop[TEST_ADDR_SIZE] = { 0xfe, 0x80 };
+    uint32_t dst_flags = prefix_len << FIB_FLAG_NET_PREFIX_SHIFT;
+
+    dst[15] = b15;
+    next_hop[15] = nh;
+    return fib_add_entry(&test_fib_table, 42, dst, sizeof(dst), dst_flags,
+                         next_hop, sizeof(next_hop), 0, lifetime);
+}
+
+static void _remove(uint8_t b0, uint8_t b1, uint8_t b15)
+{
+    uint8_t dst[TEST_ADDR_SIZE] = { b0, b1 };
+
+    dst[15] = b15;
+    fib_remove_entry(&test_fib_table, dst, sizeof(dst));
+}
+
+/* returns the last byte of the next hop for the destination, or an error */
+static int _lookup(uint8_t b0, uint8_t b1, uint8_t b15)
+{
+    uint8_t dst[TEST_ADDR_SIZE] = { b0, b1 };
+    uint8_t next_hop[TEST_ADDR_SIZE];
+    size_t next_hop_size = sizeof(next_hop);
+    uint32_t next_hop_flags;
+    kernel_pid_t iface_id;
+
+    dst[15] = b15;
+    int ret = fib_get_next_hop(&test_fib_table, &iface_id, next_hop,
+                               &next_hop_size, &next_hop_flags,
+                               dst, sizeof(dst), 0);
+    return (ret < 0) ? ret : next_hop[15];
+}
+
+/*
+ * @brief testing longest prefix match on nested prefixes
+ */
+static void test_fib_trie_01_longest_prefix_match(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, _add(0x20, 0x00, 0x00, 8, 1, 100000));
+    TEST_ASSERT_EQUAL_INT(0, _add(0x20, 0x01, 0x00, 16, 2, 100000));
+    TEST_ASSERT_EQUAL_INT(0, _add(0x20, 0x01, 0x07, 128, 3, 100000));
+    TEST_ASSERT_EQUAL_INT(0, _add(0x20, 0x80, 0x00, 9, 4, 100000));
+
+    TEST_ASSERT_EQUAL_INT(-EHOSTUNREACH, _lookup(0x30, 0x01, 0x07));
+    TEST_ASSERT_EQUAL_INT(1, _lookup(0x20, 0x02, 0x07));
+    TEST_ASSERT_EQUAL_INT(2, _lookup(0x20, 0x01, 0x08));
+    TEST_ASSERT_EQUAL_INT(3, _lookup(0x20, 0x01, 0x07));
+    TEST_ASSERT_EQUAL_INT(4, _lookup(0x20, 0xff, 0x07));
+    TEST_ASSERT_EQUAL_INT(1, _lookup(0x20, 0x7f, 0x07));
+
+    /* a default route matches everything else */
+    TEST_ASSERT_EQUAL_INT(0, _add(0x00, 0x00, 0x00, 0, 5, 100000));
+    TEST_ASSERT_EQUAL_INT(5, _lookup(0x30, 0x01, 0x07));
+    TEST_ASSERT_EQUAL_INT(2, _lookup(0x20, 0x01, 0x08));
+}
+
+/*
+ * @brief testing that removing prefixes falls back to shorter ones
+ */
+static void test_fib_trie_02_remove(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, _add(0x20, 0x00, 0x00, 8, 1, 100000));
+    TEST_ASSERT_EQUAL_INT(0, _add(0x20, 0x01, 0x00, 16, 2, 100000));
+    TEST_ASSERT_EQUAL_INT(0, _add(0x20, 0x01, 0x07, 128, 3, 100000));
+    TEST_ASSERT_EQUAL_INT(3, fib_get_num_used_entries(&test_fib_table));
+
+    _remove(0x20, 0x01, 0x00);
+    TEST_ASSERT_EQUAL_INT(3, _lookup(0x20, 0x01, 0x07));
+    TEST_ASSERT_EQUAL_INT(1, _lookup(0x20, 0x01, 0x08));
+
+    _remove(0x20, 0x01, 0x07);
+    TEST_ASSERT_EQUAL_INT(1, _lookup(0x20, 0x01, 0x07));
+
+    _remove(0x20, 0x00, 0x00);
+    TEST_ASSERT_EQUAL_INT(-EHOSTUNREACH, _lookup(0x20, 0x01, 0x07));
+    TEST_ASSERT_EQUAL_INT(0, fib_get_num_used_entries(&test_fib_table));
+}
+
+/*
+ * @brief testing that the trie nodes suffice for a full table, no matter in
+ *        which order entries are added and removed
+ */
+static void test_fib_trie_03_fill_and_drain(void)
+{
+    for (unsigned round = 0; round < 3; round++) {
+        for (unsigned i = 0; i < TEST_FIB_TRIE_TABLE_SIZE; i++) {
+            /* mix of disjoint, nested and host routes */
+            uint8_t b1 = ((i / 2) * 37) & 0xff;
+            TEST_ASSERT_EQUAL_INT(0, _add(0x20, b1, i, 16 + (i % 3) * 56,
+                                          i, 100000));
+        }
+        TEST_ASSERT_EQUAL_INT(-ENOMEM, _add(0x30, 0, 0, 128, 0, 100000));
+
+        for (unsigned i = 0; i < TEST_FIB_TRIE_TABLE_SIZE; i++) {
+            unsigned j = (i * 7 + round) % TEST_FIB_TRIE_TABLE_SIZE;
+            _remove(0x20, ((j / 2) * 37) & 0xff, j);
+        }
+        TEST_ASSERT_EQUAL_INT(0, fib_get_num_used_entries(&test_fib_table));
+        TEST_ASSERT_EQUAL_INT(-1, test_fib_table.trie_root);
+    }
+}
+
+/*
+ * @brief testing that expired entries are removed on lookup
+ */
+static void test_fib_trie_04_expiry(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, _add(0x20, 0x00, 0x00, 8, 1, 100000));
+    TEST_ASSERT_EQUAL_INT(0, _add(0x20, 0x01, 0x00, 16, 2, 1));
+    TEST_ASSERT_EQUAL_INT(2, _lookup(0x20, 0x01, 0x07));
+
+    xtimer_usleep(2000);
+
+    TEST_ASSERT_EQUAL_INT(1, _lookup(0x20, 0x01, 0x07));
+    TEST_ASSERT_EQUAL_INT(1, fib_get_num_used_entries(&test_fib_table));
+}
+
+Test *tests_fib_trie_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_fib_trie_01_longest_prefix_match),
+        new_TestFixture(test_fib_trie_02_remove),
+        new_TestFixture(test_fib_trie_03_fill_and_drain),
+        new_TestFixture(test_fib_trie_04_expiry),
+    };
+
+    EMB_UNIT_TESTCALLER(fib_trie_tests, set_up, tear_down, fixtures);
+
+    return (Test *)&fib_trie_tests;
+}
+
+/** @} */
@@ -1010,4 +1010,5 @@ Test *tests_fib_tests(void)
 void tests_fib(void)
 {
     TESTS_RUN(tests_fib_tests());
+    TESTS_RUN(tests_fib_trie_tests());
 }
@@ -35,6 +35,13 @@ void tests_fib(void);
  */
 Test *tests_fib_tests(void);
 
+/**
+ * @brief   Generates tests for the FIB longest prefix match trie
+ *
+ * @return  embUnit tests if successful, NULL if not.
+ */
+Test *tests_fib_trie_tests(void);
+
 #ifdef __cplusplus
 }
 #endif
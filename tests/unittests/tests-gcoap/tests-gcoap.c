@@ -49,6 +49,30 @@ static gcoap_listener_t listener_second = {
     .next          = NULL
 };
 
+#if IS_USED(MODULE_NANOCOAP_RESOURCE_TREE)
+static const coap_resource_t resources_tree[] = {
+    { .path = "/tree/", .methods = (COAP_PUT | COAP_MATCH_SUBTREE) },
+    { .path = "/tree/a", .methods = (COAP_GET) },
+    { .path = "/tree/ab", .methods = (COAP_GET | COAP_POST) },
+};
+
+static coap_resource_tree_node_t tree_nodes[
+                        COAP_RESOURCE_TREE_NODES_NUMOF(ARRAY_SIZE(resources_tree))];
+
+static coap_resource_tree_t tree = {
+    .nodes          = tree_nodes,
+    .nodes_numof    = ARRAY_SIZE(tree_nodes),
+};
+
+static gcoap_listener_t listener_tree = {
+    .resources     = &resources_tree[0],
+    .resources_len = ARRAY_SIZE(resources_tree),
+    .link_encoder  = NULL,
+    .next          = NULL,
+    .resource_tree = &tree,
+};
+#endif
+
 static const char *resource_list_str = "</second/part>,</act/switch>,</sensor/temp>,</test/info/all>";
 
 /*
@@ -385,6 +409,44 @@ static void test_gcoap__server_get_resource_list(void)
     TEST_ASSERT_EQUAL_STRING(resource_list_str, (char *)res);
 }
 
+#if IS_USED(MODULE_NANOCOAP_RESOURCE_TREE)
+static int _match_tree(unsigned code, const char *path,
+                       const coap_resource_t **resource)
+{
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+    coap_pkt_t pdu;
+
+    gcoap_req_init(&pdu, &buf[0], sizeof(buf), code, path);
+    ssize_t len = coap_opt_finish(&pdu, COAP_OPT_FINISH_NONE);
+    coap_parse(&pdu, &buf[0], len);
+
+    return listener_tree.request_matcher(&listener_tree, resource, &pdu);
+}
+
+/*
+ * Test matching requests with a resource tree built by the default request
+ * matcher
+ */
+static void test_gcoap__server_resource_tree(void)
+{
+    const coap_resource_t *resource;
+
+    gcoap_register_listener(&listener_tree);
+    TEST_ASSERT(listener_tree.resource_tree == &tree);
+
+    TEST_ASSERT_EQUAL_INT(GCOAP_RESOURCE_FOUND,
+                          _match_tree(COAP_METHOD_GET, "/tree/ab", &resource));
+    TEST_ASSERT(resource == &resources_tree[2]);
+    TEST_ASSERT_EQUAL_INT(GCOAP_RESOURCE_FOUND,
+                          _match_tree(COAP_METHOD_PUT, "/tree/ab", &resource));
+    TEST_ASSERT(resource == &resources_tree[0]);
+    TEST_ASSERT_EQUAL_INT(GCOAP_RESOURCE_WRONG_METHOD,
+                          _match_tree(COAP_METHOD_POST, "/tree/a", &resource));
+    TEST_ASSERT_EQUAL_INT(GCOAP_RESOURCE_NO_PATH,
+                          _match_tree(COAP_METHOD_GET, "/tree", &resource));
+}
+#endif
+
 Test *tests_gcoap_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -398,7 +460,11 @@ Test *tests_gcoap_tests(void)
         new_TestFixture(test_gcoap__server_get_resp),
         new_TestFixture(test_gcoap__server_con_req),
         new_TestFixture(test_gcoap__server_con_resp),
-        new_TestFixture(test_gcoap__server_get_resource_list)
+        new_TestFixture(test_gcoap__server_get_resource_list),
+#if IS_USED(MODULE_NANOCOAP_RESOURCE_TREE)
+        /* registers another listener, so after the resource list test */
+        new_TestFixture(test_gcoap__server_resource_tree),
+#endif
     };
 
     EMB_UNIT_TESTCALLER(gcoap_tests, NULL, NULL, fixtures);
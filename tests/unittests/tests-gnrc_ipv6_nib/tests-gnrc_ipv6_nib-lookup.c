@@ -0,0 +1,280 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief   Consistency checks and a microbenchmark for NIB lookups
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "net/ipv6/addr.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "xtimer.h"
+
+#include "_nib-internal.h"
+
+#include "tests-gnrc_ipv6_nib.h"
+
+#define GLOBAL_PREFIX       { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0 }
+#define LINK_LOCAL_PREFIX   { 0xfe, 0x80, 0, 0, 0, 0, 0, 0 }
+#define IFACE               (6)
+#define NEXT_HOP_NUMOF      (4U)
+#define BENCH_RUNS          (1000U)
+
+static void set_up(void)
+{
+    evtimer_event_t *tmp;
+
+    for (evtimer_event_t *ptr = _nib_evtimer.events;
+         (ptr != NULL) && (tmp = (ptr->next), 1);
+         ptr = tmp) {
+        evtimer_del((evtimer_t *)(&_nib_evtimer), ptr);
+    }
+    _nib_init();
+}
+
+static void _node_addr(ipv6_addr_t *addr, unsigned i)
+{
+    *addr = (ipv6_addr_t){ .u64 = { { .u8 = GLOBAL_PREFIX } } };
+    /* addresses differing in a single byte only, as in a typical
+     * 6LoWPAN network */
+    addr->u8[15] = i + 1;
+}
+
+/* prefixes of varying length, some nested into each other */
+static unsigned _dst_pfx(ipv6_addr_t *pfx, unsigned i)
+{
+    static const uint8_t lens[] = { 128, 64, 128, 48, 128, 96, 127, 33 };
+    unsigned len = lens[i % ARRAY_SIZE(lens)];
+    ipv6_addr_t addr = { .u64 = { { .u8 = GLOBAL_PREFIX } } };
+
+    addr.u8[5] = i % 3;
+    addr.u8[7] = i % 5;
+    addr.u8[15] = i;
+    ipv6_addr_set_unspecified(pfx);
+    ipv6_addr_init_prefix(pfx, &addr, len);
+    return len;
+}
+
+static void _dst_addr(ipv6_addr_t *addr, unsigned i)
+{
+    *addr = (ipv6_addr_t){ .u64 = { { .u8 = GLOBAL_PREFIX } } };
+    addr->u8[5] = i % 3;
+    addr->u8[7] = (i * 7) % 5;
+    addr->u8[15] = i % 11;
+}
+
+static void _fill_nc(unsigned numof)
+{
+    for (unsigned i = 0; i < numof; i++) {
+        ipv6_addr_t addr;
+
+        _node_addr(&addr, i);
+        TEST_ASSERT_NOT_NULL(_nib_nc_add(&addr, IFACE,
+                                         GNRC_IPV6_NIB_NC_INFO_NUD_STATE_STALE));
+    }
+}
+
+static void _fill_ft(void)
+{
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF; i++) {
+        ipv6_addr_t next_hop = { .u64 = { { .u8 = LINK_LOCAL_PREFIX } } };
+        ipv6_addr_t pfx;
+        unsigned pfx_len = _dst_pfx(&pfx, i);
+
+        next_hop.u8[15] = (i % NEXT_HOP_NUMOF) + 1;
+        TEST_ASSERT_NOT_NULL(_nib_ft_add(&next_hop, IFACE, &pfx, pfx_len));
+    }
+}
+
+/* longest prefix match, the first entry wins among prefixes of equal length */
+static _nib_offl_entry_t *_ref_match(const ipv6_addr_t *dst)
+{
+    _nib_offl_entry_t *res = NULL, *entry = NULL;
+
+    while ((entry = _nib_offl_iter(entry))) {
+        if ((ipv6_addr_match_prefix(&entry->pfx, dst) >= entry->pfx_len) &&
+            ((res == NULL) || (entry->pfx_len > res->pfx_len))) {
+            res = entry;
+        }
+    }
+    return res;
+}
+
+static void _check_route(const ipv6_addr_t *dst)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    _nib_offl_entry_t *exp = _ref_match(dst);
+
+    if (exp == NULL) {
+        TEST_ASSERT_EQUAL_INT(-ENETUNREACH, _nib_get_route(dst, NULL, &fte));
+    }
+    else {
+        TEST_ASSERT_EQUAL_INT(0, _nib_get_route(dst, NULL, &fte));
+        TEST_ASSERT(ipv6_addr_equal(&exp->pfx, &fte.dst));
+        TEST_ASSERT_EQUAL_INT(exp->pfx_len, fte.dst_len);
+        TEST_ASSERT(ipv6_addr_equal(&exp->next_hop->ipv6, &fte.next_hop));
+    }
+}
+
+static void _check_routes(void)
+{
+    /* matches a /32 and a /64 by the same number of bits in
+     * test_nib_lookup__offl_get_match_tie() */
+    ipv6_addr_t dst = { .u64 = { { .u8 = GLOBAL_PREFIX } } };
+
+    dst.u8[15] = 1;
+    _check_route(&dst);
+    for (unsigned i = 0; i < 64; i++) {
+        _dst_addr(&dst, i);
+        _check_route(&dst);
+    }
+}
+
+/*
+ * Fills the neighbor cache, removes every other entry and adds them again.
+ * Expected result: every node is found by its address with and without
+ * interface, removed nodes are not found.
+ */
+static void test_nib_lookup__onl_get(void)
+{
+    _nib_onl_entry_t *nodes[CONFIG_GNRC_IPV6_NIB_NUMOF];
+    ipv6_addr_t addr;
+
+    _fill_nc(CONFIG_GNRC_IPV6_NIB_NUMOF);
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
+        _node_addr(&addr, i);
+        TEST_ASSERT_NOT_NULL((nodes[i] = _nib_onl_get(&addr, IFACE)));
+        TEST_ASSERT(ipv6_addr_equal(&addr, &nodes[i]->ipv6));
+        TEST_ASSERT(nodes[i] == _nib_onl_get(&addr, 0));
+        TEST_ASSERT_NULL(_nib_onl_get(&addr, IFACE + 1));
+    }
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i += 2) {
+        _nib_nc_remove(nodes[i]);
+    }
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
+        _node_addr(&addr, i);
+        if (i & 1) {
+            TEST_ASSERT(nodes[i] == _nib_onl_get(&addr, IFACE));
+        }
+        else {
+            TEST_ASSERT_NULL(_nib_onl_get(&addr, IFACE));
+        }
+    }
+    _fill_nc(CONFIG_GNRC_IPV6_NIB_NUMOF);
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
+        _nib_onl_entry_t *node;
+
+        _node_addr(&addr, i);
+        TEST_ASSERT_NOT_NULL((node = _nib_onl_get(&addr, IFACE)));
+        TEST_ASSERT(ipv6_addr_equal(&addr, &node->ipv6));
+    }
+}
+
+/*
+ * Fills the forwarding table with nested prefixes and removes some of them.
+ * Expected result: the routes are the same as with the linear longest prefix
+ * match.
+ */
+static void test_nib_lookup__offl_get_match(void)
+{
+    _nib_offl_entry_t *entry = NULL;
+    unsigned i = 0;
+
+    _fill_ft();
+    _check_routes();
+    while ((entry = _nib_offl_iter(entry))) {
+        if ((i++ % 3) == 0) {
+            _nib_ft_remove(entry);
+        }
+    }
+    _check_routes();
+    _fill_ft();
+    _check_routes();
+}
+
+/*
+ * Adds 2001:db8::/32 and then 2001:db8::/64 to the forwarding table.
+ * Expected result: although both match 2001:db8::1 by 127 bits, the route
+ * via the /64 is taken; 2001:db8:0:1::1 is only covered by the /32.
+ */
+static void test_nib_lookup__offl_get_match_tie(void)
+{
+    ipv6_addr_t next_hop = { .u64 = { { .u8 = LINK_LOCAL_PREFIX } } };
+    ipv6_addr_t pfx = { .u64 = { { .u8 = GLOBAL_PREFIX } } };
+    ipv6_addr_t dst = pfx;
+    gnrc_ipv6_nib_ft_t fte;
+
+    next_hop.u8[15] = 1;
+    TEST_ASSERT_NOT_NULL(_nib_ft_add(&next_hop, IFACE, &pfx, 32));
+    next_hop.u8[15] = 2;
+    TEST_ASSERT_NOT_NULL(_nib_ft_add(&next_hop, IFACE, &pfx, 64));
+    dst.u8[15] = 1;
+    TEST_ASSERT_EQUAL_INT(0, _nib_get_route(&dst, NULL, &fte));
+    TEST_ASSERT_EQUAL_INT(64, fte.dst_len);
+    TEST_ASSERT(ipv6_addr_equal(&next_hop, &fte.next_hop));
+    dst.u8[7] = 1;
+    TEST_ASSERT_EQUAL_INT(0, _nib_get_route(&dst, NULL, &fte));
+    TEST_ASSERT_EQUAL_INT(32, fte.dst_len);
+    _check_routes();
+}
+
+/*
+ * Measures the time for neighbor cache and forwarding table lookups in a
+ * full NIB.
+ */
+static void test_nib_lookup__bench(void)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    ipv6_addr_t addr;
+    uint32_t start, nc_time, ft_time;
+
+    /* leave space for the next hops of the forwarding table */
+    _fill_nc(CONFIG_GNRC_IPV6_NIB_NUMOF - NEXT_HOP_NUMOF);
+    _fill_ft();
+
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < BENCH_RUNS; i++) {
+        _node_addr(&addr, i % (CONFIG_GNRC_IPV6_NIB_NUMOF - NEXT_HOP_NUMOF));
+        TEST_ASSERT_NOT_NULL(_nib_onl_get(&addr, IFACE));
+    }
+    nc_time = xtimer_now_usec() - start;
+
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < BENCH_RUNS; i++) {
+        _dst_addr(&addr, i);
+        _nib_get_route(&addr, NULL, &fte);
+    }
+    ft_time = xtimer_now_usec() - start;
+
+    printf("\nnib lookup (NUMOF = %u, OFFL_NUMOF = %u, hash index = %u): "
+           "nc %" PRIu32 " ns, ft %" PRIu32 " ns\n",
+           CONFIG_GNRC_IPV6_NIB_NUMOF, CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF,
+           CONFIG_GNRC_IPV6_NIB_HASH_INDEX,
+           (uint32_t)(((uint64_t)nc_time * 1000) / BENCH_RUNS),
+           (uint32_t)(((uint64_t)ft_time * 1000) / BENCH_RUNS));
+}
+
+Test *tests_gnrc_ipv6_nib_lookup_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_nib_lookup__onl_get),
+        new_TestFixture(test_nib_lookup__offl_get_match),
+        new_TestFixture(test_nib_lookup__offl_get_match_tie),
+        new_TestFixture(test_nib_lookup__bench),
+    };
+
+    EMB_UNIT_TESTCALLER(tests, set_up, NULL,
+                        fixtures);
+
+    return (Test *)&tests;
+}
@@ -29,6 +29,7 @@
 
 #include "embUnit/embUnit.h"
 
+#include "kernel_defines.h"
 #include "hashes/sha256.h"
 
 #include "tests-hashes.h"
@@ -266,6 +267,38 @@ static void test_hashes_sha256_hash_sequence_abc_long(void)
     TEST_ASSERT(calc_and_compare_hash_wrapper(teststring, h_fips_multiblock));
 }
 
+static void test_hashes_sha256_multi(void)
+{
+    /* lengths around the block and padding boundaries */
+    static const size_t lens[] = { 0, 55, 56, 64, 119, 200 };
+    static uint8_t data[6][200];
+    static uint8_t digests[6][SHA256_DIGEST_LENGTH];
+    uint8_t expected[SHA256_DIGEST_LENGTH];
+    const void *msgs[6];
+    void *outs[6];
+
+    for (unsigned i = 0; i < ARRAY_SIZE(data); i++) {
+        for (unsigned j = 0; j < sizeof(data[i]); j++) {
+            data[i][j] = i * 31 + j;
+        }
+        msgs[i] = data[i];
+        outs[i] = digests[i];
+    }
+
+    for (unsigned n = 0; n < ARRAY_SIZE(lens); n++) {
+        /* one message less than there are lanes and one more */
+        for (unsigned numof = 3; numof <= 6; numof += 3) {
+            memset(digests, 0, sizeof(digests));
+            sha256_multi(msgs, lens[n], outs, numof);
+            for (unsigned i = 0; i < numof; i++) {
+                sha256(data[i], lens[n], expected);
+                TEST_ASSERT_EQUAL_INT(0, memcmp(expected, digests[i],
+                                                SHA256_DIGEST_LENGTH));
+            }
+        }
+    }
+}
+
 Test *tests_hashes_sha256_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -284,6 +317,8 @@ Test *tests_hashes_sha256_tests(void)
 
         new_TestFixture(test_hashes_sha256_hash_sequence_abc),
         new_TestFixture(test_hashes_sha256_hash_sequence_abc_long),
+
+        new_TestFixture(test_hashes_sha256_multi),
     };
 
     EMB_UNIT_TESTCALLER(hashes_sha256_tests, NULL, NULL,
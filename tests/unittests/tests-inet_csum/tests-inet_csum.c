@@ -13,6 +13,7 @@
  */
 #include <errno.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "embUnit.h"
 
@@ -165,6 +166,57 @@ static void test_inet_csum__empty_app_buffer(void)
     TEST_ASSERT_EQUAL_INT(hdr_expected, pyld_sum);
 }
 
+static void test_inet_csum__unaligned(void)
+{
+    /* source: https://www.cloudshark.org/captures/ea72fbab241b (No. 1) */
+    static const uint8_t data[] = {
+        0xc0, 0xa8, 0x01, 0x91, 0x4b, 0x4b, 0x4b, 0x4b, /* IPv4 source + dest*/
+        0xf6, 0xfb, 0x00, 0x35, 0x00, 0x27, 0xd1, 0xa2, /* UDP header */
+        0xa5, 0x6f, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, /* DNS payload */
+        0x00, 0x00, 0x00, 0x00, 0x09, 0x74, 0x65, 0x73,
+        0x74, 0x2d, 0x69, 0x70, 0x76, 0x36, 0x03, 0x63,
+        0x6f, 0x6d, 0x00, 0x00, 0x01, 0x00, 0x01,
+    };
+    uint8_t buf[sizeof(data) + 16];
+
+    /* the result must not depend on the alignment of the buffer */
+    for (unsigned offset = 0; offset < 16; offset++) {
+        memcpy(&buf[offset], data, sizeof(data));
+        TEST_ASSERT_EQUAL_INT(0xffff, inet_csum(17 + 39, &buf[offset],
+                                                sizeof(data)));
+    }
+
+    /* nor on how the buffer is sliced */
+    for (unsigned split = 0; split <= sizeof(data); split++) {
+        uint16_t sum = inet_csum_slice(17 + 39, data, split, 0);
+
+        sum = inet_csum_slice(sum, &data[split], sizeof(data) - split, split);
+        TEST_ASSERT_EQUAL_INT(0xffff, sum);
+    }
+}
+
+static void test_inet_csum__long(void)
+{
+    static uint8_t data[1027];
+    uint32_t expected = 0;
+
+    for (unsigned i = 0; i < sizeof(data); i++) {
+        data[i] = (i * 13) ^ (i >> 3);
+        expected += (i & 1) ? data[i] : (data[i] << 8);
+    }
+    while (expected >> 16) {
+        expected = (expected & 0xffff) + (expected >> 16);
+    }
+
+    for (unsigned offset = 0; offset < 4; offset++) {
+        uint16_t sum = inet_csum_slice(0, data, offset, 0);
+
+        sum = inet_csum_slice(sum, &data[offset], sizeof(data) - offset,
+                              offset);
+        TEST_ASSERT_EQUAL_INT(expected, sum);
+    }
+}
+
 Test *tests_inet_csum_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -176,6 +228,8 @@ Test *tests_inet_csum_tests(void)
         new_TestFixture(test_inet_csum__odd_len),
         new_TestFixture(test_inet_csum__two_app_snips),
         new_TestFixture(test_inet_csum__empty_app_buffer),
+        new_TestFixture(test_inet_csum__unaligned),
+        new_TestFixture(test_inet_csum__long),
     };
 
     EMB_UNIT_TESTCALLER(inet_csum_tests, NULL, NULL, fixtures);
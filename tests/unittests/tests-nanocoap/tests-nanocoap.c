@@ -692,6 +692,73 @@ static void test_nanocoap__options_iterate(void)
  * Tests use of coap_opt_get_opaque() to find an option as a byte array, and
  * coap_opt_get_next() to find a second option with the same option number.
  */
+/* options without a define in net/coap.h */
+#define _OPT_SIZE1          (60U)
+#define _OPT_NO_RESPONSE    (258U)
+
+/*
+ * Helper for options_get_values test below. Reads the options of the request
+ * written there.
+ */
+static void _check_option_values(coap_pkt_t *pkt)
+{
+    char uri[CONFIG_NANOCOAP_URI_MAX];
+    coap_block1_t block;
+    uint8_t *value;
+    uint32_t num;
+
+    TEST_ASSERT(coap_get_uri_path(pkt, (uint8_t *)uri) > 0);
+    TEST_ASSERT_EQUAL_STRING("/sensor/temp", uri);
+    TEST_ASSERT_EQUAL_INT(COAP_FORMAT_CBOR, coap_get_content_type(pkt));
+    TEST_ASSERT_EQUAL_INT(0, coap_opt_get_uint(pkt, COAP_OPT_ACCEPT, &num));
+    TEST_ASSERT_EQUAL_INT(COAP_FORMAT_JSON, num);
+    TEST_ASSERT_EQUAL_INT(1, coap_get_block2(pkt, &block));
+    TEST_ASSERT_EQUAL_INT(5, block.blknum);
+    TEST_ASSERT_EQUAL_INT(2, block.szx);
+    TEST_ASSERT_EQUAL_INT(19, coap_opt_get_opaque(pkt, COAP_OPT_PROXY_URI,
+                                                  &value));
+    TEST_ASSERT_EQUAL_INT(0, memcmp("coap://[::1]/remote", value, 19));
+    TEST_ASSERT_EQUAL_INT(0, coap_opt_get_uint(pkt, _OPT_SIZE1, &num));
+    TEST_ASSERT_EQUAL_INT(300, num);
+
+    /* absent options, below and above 31 */
+    TEST_ASSERT_EQUAL_INT(0, coap_get_block1(pkt, &block));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, coap_opt_get_uint(pkt, COAP_OPT_OBSERVE,
+                                                     &num));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, coap_opt_get_opaque(pkt, _OPT_NO_RESPONSE,
+                                                       &value));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, coap_opt_get_opaque(pkt, COAP_OPT_URI_HOST,
+                                                       &value));
+}
+
+/*
+ * Reads options of a request right after writing them, and after parsing
+ * the request.
+ */
+static void test_nanocoap__options_get_values(void)
+{
+    uint8_t buf[_BUF_SIZE];
+    coap_pkt_t pkt;
+    uint16_t msgid = 0xABCD;
+    uint8_t token[2] = {0xDA, 0xEC};
+
+    size_t len = coap_build_hdr((coap_hdr_t *)&buf[0], COAP_TYPE_NON,
+                                &token[0], 2, COAP_METHOD_GET, msgid);
+    coap_pkt_init(&pkt, &buf[0], sizeof(buf), len);
+
+    coap_opt_add_uri_path(&pkt, "/sensor/temp");
+    coap_opt_add_format(&pkt, COAP_FORMAT_CBOR);
+    coap_opt_add_uint(&pkt, COAP_OPT_ACCEPT, COAP_FORMAT_JSON);
+    coap_opt_add_uint(&pkt, COAP_OPT_BLOCK2, (5 << 4) | 2);
+    coap_opt_add_proxy_uri(&pkt, "coap://[::1]/remote");
+    coap_opt_add_uint(&pkt, _OPT_SIZE1, 300);
+    len = coap_opt_finish(&pkt, COAP_OPT_FINISH_NONE);
+    _check_option_values(&pkt);
+
+    TEST_ASSERT_EQUAL_INT(0, coap_parse(&pkt, &buf[0], len));
+    _check_option_values(&pkt);
+}
+
 static void test_nanocoap__options_get_opaque(void)
 {
     coap_pkt_t pkt;
@@ -836,6 +903,155 @@ static void test_nanocoap__token_length_over_limit(void)
     TEST_ASSERT_EQUAL_INT(-EBADMSG, res);
 }
 
+#if IS_USED(MODULE_NANOCOAP_RESOURCE_TREE)
+#define _TREE_NODES     (10U)   /* /node/00/ .. /node/09/ */
+#define _TREE_SENSORS   (15U)   /* s00 .. s14 */
+#define _TREE_RES_NUMOF (_TREE_NODES * (_TREE_SENSORS + 1) + 2)
+
+static char _tree_paths[_TREE_RES_NUMOF][16];
+static coap_resource_t _tree_res[_TREE_RES_NUMOF];
+static coap_resource_tree_node_t _tree_nodes[
+                                COAP_RESOURCE_TREE_NODES_NUMOF(_TREE_RES_NUMOF)];
+static coap_resource_tree_t _tree = {
+    .nodes = _tree_nodes,
+    .nodes_numof = ARRAY_SIZE(_tree_nodes),
+};
+
+/*
+ * Sorted resources: a firmware subtree, and a POST-only subtree next to the
+ * GET resources of each node.
+ */
+static void _tree_setup(void)
+{
+    unsigned n = 0;
+
+    strcpy(_tree_paths[n], "/fw/");
+    _tree_res[n].methods = COAP_PUT | COAP_MATCH_SUBTREE;
+    n++;
+    for (unsigned i = 0; i < _TREE_NODES; i++) {
+        sprintf(_tree_paths[n], "/node/%02u/", i);
+        _tree_res[n].methods = COAP_POST | COAP_MATCH_SUBTREE;
+        n++;
+        for (unsigned j = 0; j < _TREE_SENSORS; j++) {
+            sprintf(_tree_paths[n], "/node/%02u/s%02u", i, j);
+            _tree_res[n].methods = COAP_GET;
+            n++;
+        }
+    }
+    strcpy(_tree_paths[n], "/node/10");
+    _tree_res[n].methods = COAP_GET | COAP_PUT;
+    n++;
+    for (unsigned i = 0; i < n; i++) {
+        _tree_res[i].path = _tree_paths[i];
+    }
+}
+
+/* what coap_tree_handler() does */
+static const coap_resource_t *_linear_find(const char *uri, unsigned method)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_tree_res); i++) {
+        if (!(_tree_res[i].methods & method)) {
+            continue;
+        }
+        int res = coap_match_path(&_tree_res[i], (uint8_t *)uri);
+        if (res == 0) {
+            return &_tree_res[i];
+        }
+        else if (res < 0) {
+            break;
+        }
+    }
+    return NULL;
+}
+
+static const coap_resource_t *_tree_find(const char *uri, unsigned method)
+{
+    const coap_resource_t *resource;
+
+    if (coap_resource_tree_find(&_tree, uri, method, &resource) < 0) {
+        return NULL;
+    }
+    return resource;
+}
+
+/*
+ * Resource tree lookup yields the same resources as the linear lookup,
+ * including subtree matches and method filtering.
+ */
+static void test_nanocoap__resource_tree(void)
+{
+    static const char *uris[] = {
+        "/fw/", "/fw/image", "/fw", "/node/05/", "/node/05/s03",
+        "/node/05/s15", "/node/05/x", "/node/05", "/node/1", "/node/10",
+        "/node/10/", "/node/11", "/", "/x",
+    };
+    static const unsigned methods[] = { COAP_GET, COAP_POST, COAP_PUT };
+    const coap_resource_t *resource;
+
+    _tree_setup();
+    TEST_ASSERT_EQUAL_INT(0, coap_resource_tree_init(&_tree, _tree_res,
+                                                     ARRAY_SIZE(_tree_res)));
+    for (unsigned i = 0; i < ARRAY_SIZE(_tree_res); i++) {
+        for (unsigned j = 0; j < ARRAY_SIZE(methods); j++) {
+            TEST_ASSERT(_linear_find(_tree_paths[i], methods[j]) ==
+                        _tree_find(_tree_paths[i], methods[j]));
+        }
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(uris); i++) {
+        for (unsigned j = 0; j < ARRAY_SIZE(methods); j++) {
+            TEST_ASSERT(_linear_find(uris[i], methods[j]) ==
+                        _tree_find(uris[i], methods[j]));
+        }
+    }
+
+    TEST_ASSERT_EQUAL_INT(0, coap_resource_tree_find(&_tree, "/node/05/s03",
+                                                     COAP_GET, &resource));
+    TEST_ASSERT_EQUAL_STRING("/node/05/s03", resource->path);
+    TEST_ASSERT_EQUAL_INT(0, coap_resource_tree_find(&_tree, "/node/05/s03",
+                                                     COAP_POST, &resource));
+    TEST_ASSERT_EQUAL_STRING("/node/05/", resource->path);
+    TEST_ASSERT_EQUAL_INT(-EPERM, coap_resource_tree_find(&_tree, "/node/05/s03",
+                                                          COAP_PUT, &resource));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, coap_resource_tree_find(&_tree, "/node/05",
+                                                           COAP_GET, &resource));
+}
+
+/* Default node storage of coap_handle_req() fits 150+ resources. */
+static void test_nanocoap__resource_tree_default_size(void)
+{
+    _tree_setup();
+    _tree.nodes_numof = CONFIG_NANOCOAP_RESOURCE_TREE_NODES_MAX;
+    TEST_ASSERT_EQUAL_INT(0, coap_resource_tree_init(&_tree, _tree_res,
+                                                     ARRAY_SIZE(_tree_res)));
+    _tree.nodes_numof = ARRAY_SIZE(_tree_nodes);
+}
+
+/* Resource tree needs sorted resources and enough nodes. */
+static void test_nanocoap__resource_tree_init_fail(void)
+{
+    static const coap_resource_t unsorted[] = {
+        { "/b", COAP_GET, NULL, NULL },
+        { "/a", COAP_GET, NULL, NULL },
+    };
+    static const coap_resource_t sorted[] = {
+        { "/a", COAP_GET, NULL, NULL },
+        { "/b", COAP_GET, NULL, NULL },
+    };
+    coap_resource_tree_node_t nodes[COAP_RESOURCE_TREE_NODES_NUMOF(2)];
+    coap_resource_tree_t tree = {
+        .nodes = nodes,
+        .nodes_numof = ARRAY_SIZE(nodes),
+    };
+
+    TEST_ASSERT_EQUAL_INT(-EINVAL, coap_resource_tree_init(&tree, unsorted,
+                                                           ARRAY_SIZE(unsorted)));
+    /* root and the first path only, the second one splits it */
+    tree.nodes_numof = 2;
+    TEST_ASSERT_EQUAL_INT(-ENOMEM, coap_resource_tree_init(&tree, sorted,
+                                                           ARRAY_SIZE(sorted)));
+}
+#endif /* MODULE_NANOCOAP_RESOURCE_TREE */
+
 Test *tests_nanocoap_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -851,6 +1067,7 @@ Test *tests_nanocoap_tests(void)
         new_TestFixture(test_nanocoap__get_multi_query),
         new_TestFixture(test_nanocoap__add_uri_query2),
         new_TestFixture(test_nanocoap__option_add_buffer_max),
+        new_TestFixture(test_nanocoap__options_get_values),
         new_TestFixture(test_nanocoap__options_get_opaque),
         new_TestFixture(test_nanocoap__options_iterate),
         new_TestFixture(test_nanocoap__server_get_req),
@@ -863,6 +1080,11 @@ Test *tests_nanocoap_tests(void)
         new_TestFixture(test_nanocoap__add_path_unterminated_string),
         new_TestFixture(test_nanocoap__add_get_proxy_uri),
         new_TestFixture(test_nanocoap__token_length_over_limit),
+#if IS_USED(MODULE_NANOCOAP_RESOURCE_TREE)
+        new_TestFixture(test_nanocoap__resource_tree),
+        new_TestFixture(test_nanocoap__resource_tree_default_size),
+        new_TestFixture(test_nanocoap__resource_tree_init_fail),
+#endif
     };
 
     EMB_UNIT_TESTCALLER(nanocoap_tests, NULL, NULL, fixtures);
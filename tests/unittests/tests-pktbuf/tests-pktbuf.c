@@ -202,6 +202,7 @@ static void test_pktbuf_add__memfull(void)
 }
 #endif
 
+#ifndef MODULE_GNRC_PKTBUF_SLAB   /* CONFIG_GNRC_PKTBUF_SIZE does not apply for gnrc_pktbuf_slab */
 static void test_pktbuf_add__success(void)
 {
     gnrc_pktsnip_t *pkt, *pkt_prev = NULL;
@@ -225,6 +226,7 @@ static void test_pktbuf_add__success(void)
     }
     TEST_ASSERT(gnrc_pktbuf_is_sane());
 }
+#endif
 
 static void test_pktbuf_add__packed_struct(void)
 {
@@ -245,7 +247,8 @@ static void test_pktbuf_add__packed_struct(void)
     TEST_ASSERT_EQUAL_INT(data.s64, data_cpy->s64);
 }
 
-#ifndef MODULE_GNRC_PKTBUF_MALLOC   /* alignment-handling left to malloc, so no certainty here */
+/* alignment-handling left to malloc or done per block, so no certainty here */
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_SLAB)
 static void test_pktbuf_add__unaligned_in_aligned_hole(void)
 {
     gnrc_pktsnip_t *pkt1 = gnrc_pktbuf_add(NULL, NULL, 8, GNRC_NETTYPE_TEST);
@@ -653,7 +656,7 @@ static void test_pktbuf_realloc_data__success3(void)
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
 
-#ifndef MODULE_GNRC_PKTBUF_MALLOC
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_SLAB)
 static void test_pktbuf_merge_data__memfull(void)
 {
     gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, (CONFIG_GNRC_PKTBUF_SIZE / 4),
@@ -813,7 +816,7 @@ static void test_pktbuf_start_write__pkt_users_2(void)
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
 
-#ifndef MODULE_GNRC_PKTBUF_MALLOC
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_SLAB)
 static void test_pktbuf_reverse_snips__too_full(void)
 {
     gnrc_pktsnip_t *pkt, *pkt_next, *pkt_huge;
@@ -852,6 +855,111 @@ static void test_pktbuf_reverse_snips__success(void)
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
 
+#ifdef MODULE_GNRC_PKTBUF_SLAB
+static unsigned _slab_used(gnrc_pktbuf_slab_class_t cls)
+{
+    gnrc_pktbuf_slab_stats_t stats;
+
+    gnrc_pktbuf_slab_stats(cls, &stats);
+    return stats.used;
+}
+
+static void test_pktbuf_slab__stats(void)
+{
+    gnrc_pktbuf_slab_stats_t stats;
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE,
+                                          GNRC_NETTYPE_TEST);
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_NOT_NULL((pkt = gnrc_pktbuf_add(pkt, TEST_STRING8, sizeof(TEST_STRING8),
+                                                GNRC_NETTYPE_TEST)));
+    TEST_ASSERT_EQUAL_INT(2, _slab_used(GNRC_PKTBUF_SLAB_SNIP));
+    TEST_ASSERT_EQUAL_INT(1, _slab_used(GNRC_PKTBUF_SLAB_SMALL));
+    TEST_ASSERT_EQUAL_INT(1, _slab_used(GNRC_PKTBUF_SLAB_LARGE));
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+
+    gnrc_pktbuf_slab_stats(GNRC_PKTBUF_SLAB_SNIP, &stats);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF, stats.numof);
+    TEST_ASSERT_EQUAL_INT(0, stats.used);
+    TEST_ASSERT_EQUAL_INT(2, stats.max_used);
+    gnrc_pktbuf_slab_stats(GNRC_PKTBUF_SLAB_LARGE, &stats);
+    TEST_ASSERT(stats.size >= CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE);
+    TEST_ASSERT_EQUAL_INT(1, stats.max_used);
+    TEST_ASSERT_NULL(gnrc_pktbuf_add(NULL, NULL, stats.size + 1, GNRC_NETTYPE_TEST));
+}
+
+static void test_pktbuf_slab__small_falls_back_to_large(void)
+{
+    gnrc_pktsnip_t *pkt = NULL;
+
+    for (unsigned i = 0; i < CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF; i++) {
+        TEST_ASSERT_NOT_NULL((pkt = gnrc_pktbuf_add(pkt, NULL, 1, GNRC_NETTYPE_TEST)));
+    }
+    TEST_ASSERT_EQUAL_INT(0, _slab_used(GNRC_PKTBUF_SLAB_LARGE));
+    TEST_ASSERT_NOT_NULL((pkt = gnrc_pktbuf_add(pkt, NULL, 1, GNRC_NETTYPE_TEST)));
+    TEST_ASSERT_EQUAL_INT(1, _slab_used(GNRC_PKTBUF_SLAB_LARGE));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_slab__mark_shares_block(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, TEST_STRING64, sizeof(TEST_STRING64),
+                                          GNRC_NETTYPE_TEST);
+    gnrc_pktsnip_t *hdr1, *hdr2;
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_NOT_NULL((hdr1 = gnrc_pktbuf_mark(pkt, 7, GNRC_NETTYPE_UNDEF)));
+    TEST_ASSERT_NOT_NULL((hdr2 = gnrc_pktbuf_mark(pkt, 9, GNRC_NETTYPE_UNDEF)));
+    /* no data was copied */
+    TEST_ASSERT((uint8_t *)hdr1->data + 7 == hdr2->data);
+    TEST_ASSERT((uint8_t *)hdr2->data + 9 == pkt->data);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(TEST_STRING64 + 16, pkt->data, pkt->size));
+    TEST_ASSERT_EQUAL_INT(1, _slab_used(GNRC_PKTBUF_SLAB_SMALL));
+    TEST_ASSERT_EQUAL_INT(3, _slab_used(GNRC_PKTBUF_SLAB_SNIP));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+
+    /* block stays in use as long as any part of it is */
+    pkt = gnrc_pktbuf_remove_snip(pkt, hdr2);
+    TEST_ASSERT_EQUAL_INT(1, _slab_used(GNRC_PKTBUF_SLAB_SMALL));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(TEST_STRING64, hdr1->data, hdr1->size));
+    /* growing a shared part must not overwrite the others */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(hdr1, 12));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(TEST_STRING64, hdr1->data, 7));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(TEST_STRING64 + 16, pkt->data, pkt->size));
+    TEST_ASSERT_EQUAL_INT(2, _slab_used(GNRC_PKTBUF_SLAB_SMALL));
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_slab__realloc_shrink_to_small(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE,
+                                          GNRC_NETTYPE_TEST);
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    memcpy(pkt->data, TEST_STRING64, sizeof(TEST_STRING64));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt, sizeof(TEST_STRING64)));
+    TEST_ASSERT_EQUAL_INT(0, _slab_used(GNRC_PKTBUF_SLAB_LARGE));
+    TEST_ASSERT_EQUAL_INT(1, _slab_used(GNRC_PKTBUF_SLAB_SMALL));
+    TEST_ASSERT_EQUAL_INT(sizeof(TEST_STRING64), pkt->size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(TEST_STRING64, pkt->data, pkt->size));
+    /* grows in place up to the block size */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt, CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE));
+    TEST_ASSERT_EQUAL_INT(1, _slab_used(GNRC_PKTBUF_SLAB_SMALL));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt,
+                                                      CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE + 64));
+    TEST_ASSERT_EQUAL_INT(0, _slab_used(GNRC_PKTBUF_SLAB_SMALL));
+    TEST_ASSERT_EQUAL_INT(1, _slab_used(GNRC_PKTBUF_SLAB_LARGE));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(TEST_STRING64, pkt->data, sizeof(TEST_STRING64)));
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+#endif /* MODULE_GNRC_PKTBUF_SLAB */
+
 Test *tests_pktbuf_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -866,9 +974,11 @@ Test *tests_pktbuf_tests(void)
 #ifndef MODULE_GNRC_PKTBUF_MALLOC
         new_TestFixture(test_pktbuf_add__memfull),
 #endif
+#ifndef MODULE_GNRC_PKTBUF_SLAB
         new_TestFixture(test_pktbuf_add__success),
+#endif
         new_TestFixture(test_pktbuf_add__packed_struct),
-#ifndef MODULE_GNRC_PKTBUF_MALLOC
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_SLAB)
         new_TestFixture(test_pktbuf_add__unaligned_in_aligned_hole),
 #endif
         new_TestFixture(test_pktbuf_add__0_sized_release),
@@ -892,7 +1002,7 @@ Test *tests_pktbuf_tests(void)
         new_TestFixture(test_pktbuf_realloc_data__success),
         new_TestFixture(test_pktbuf_realloc_data__success2),
         new_TestFixture(test_pktbuf_realloc_data__success3),
-#ifndef MODULE_GNRC_PKTBUF_MALLOC
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_SLAB)
         new_TestFixture(test_pktbuf_merge_data__memfull),
 #endif /* MODULE_GNRC_PKTBUF_MALLOC */
         new_TestFixture(test_pktbuf_merge_data__success1),
@@ -906,10 +1016,16 @@ Test *tests_pktbuf_tests(void)
         new_TestFixture(test_pktbuf_start_write__NULL),
         new_TestFixture(test_pktbuf_start_write__pkt_users_1),
         new_TestFixture(test_pktbuf_start_write__pkt_users_2),
-#ifndef MODULE_GNRC_PKTBUF_MALLOC
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_SLAB)
         new_TestFixture(test_pktbuf_reverse_snips__too_full),
 #endif /* MODULE_GNRC_PKTBUF_MALLOC */
         new_TestFixture(test_pktbuf_reverse_snips__success),
+#ifdef MODULE_GNRC_PKTBUF_SLAB
+        new_TestFixture(test_pktbuf_slab__stats),
+        new_TestFixture(test_pktbuf_slab__small_falls_back_to_large),
+        new_TestFixture(test_pktbuf_slab__mark_shares_block),
+        new_TestFixture(test_pktbuf_slab__realloc_shrink_to_small),
+#endif
     };
 
     EMB_UNIT_TESTCALLER(gnrc_pktbuf_tests, set_up, NULL, fixtures);
@@ -0,0 +1,222 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit/embUnit.h"
+
+#include "unittests-constants.h"
+#include "spscrb.h"
+#include "tests-spscrb.h"
+
+#define TEST_INPUT          (0xdb)
+#define TEST_DROP_NUM       (4U)
+#define TEST_OFFSET         (5U)
+#define BUFFER_SIZE         (16)    /* intentionally not unsigned to easier
+                                     * check for implicit casting problems */
+#define IO_BUFFER_CANARY    (0xb8)
+
+typedef struct {
+    uint16_t a;
+    uint8_t b;
+} test_elem_t;
+
+static uint8_t _rb_buffer[BUFFER_SIZE];
+static uint8_t _io_buffer[BUFFER_SIZE * 2];
+static spscrb_t _rb = SPSCRB_INIT(_rb_buffer);
+
+static void tear_down(void)
+{
+    memset(_io_buffer, IO_BUFFER_CANARY, sizeof(_io_buffer));
+    memset(_rb_buffer, 0, sizeof(_rb_buffer));
+    spscrb_init(&_rb, _rb_buffer, BUFFER_SIZE);
+}
+
+/* moves read and write position, so that the next data wraps around */
+static void _set_offset(void)
+{
+    TEST_ASSERT_EQUAL_INT(TEST_OFFSET, spscrb_add(&_rb, _io_buffer,
+                                                  TEST_OFFSET));
+    TEST_ASSERT_EQUAL_INT(TEST_OFFSET, spscrb_drop(&_rb, TEST_OFFSET));
+}
+
+static void test_empty(void)
+{
+    TEST_ASSERT_EQUAL_INT(1, spscrb_empty(&_rb));
+
+    TEST_ASSERT_EQUAL_INT(0, spscrb_add_one(&_rb, TEST_INPUT));
+    TEST_ASSERT_EQUAL_INT(0, spscrb_empty(&_rb));
+}
+
+static void test_avail_free(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, spscrb_avail(&_rb));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, spscrb_free(&_rb));
+
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(0, spscrb_full(&_rb));
+        TEST_ASSERT_EQUAL_INT(0, spscrb_add_one(&_rb, TEST_INPUT));
+        TEST_ASSERT_EQUAL_INT(i + 1, spscrb_avail(&_rb));
+        TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - (i + 1), spscrb_free(&_rb));
+    }
+    TEST_ASSERT_EQUAL_INT(1, spscrb_full(&_rb));
+    TEST_ASSERT_EQUAL_INT(-1, spscrb_add_one(&_rb, TEST_INPUT));
+}
+
+static void test_get_one(void)
+{
+    int res;
+
+    TEST_ASSERT_EQUAL_INT(-1, spscrb_get_one(&_rb));
+    TEST_ASSERT_EQUAL_INT(0, spscrb_add_one(&_rb, TEST_INPUT));
+    TEST_ASSERT_EQUAL_INT(TEST_INPUT, spscrb_get_one(&_rb));
+    TEST_ASSERT_EQUAL_INT(-1, spscrb_get_one(&_rb));
+    TEST_ASSERT_EQUAL_INT(0, spscrb_add_one(&_rb, 0xff));
+    res = spscrb_get_one(&_rb);
+    TEST_ASSERT_EQUAL_INT(0xff, res);
+    TEST_ASSERT_EQUAL_INT(-1, spscrb_get_one(&_rb));
+}
+
+static void test_add_get_wrap(void)
+{
+    uint8_t in[BUFFER_SIZE];
+
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        in[i] = TEST_INPUT + i;
+    }
+    _set_offset();
+    TEST_ASSERT_EQUAL_INT(0, spscrb_add(&_rb, in, 0));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, spscrb_add(&_rb, in,
+                                                  sizeof(_io_buffer)));
+    TEST_ASSERT_EQUAL_INT(1, spscrb_full(&_rb));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, spscrb_get(&_rb, _io_buffer,
+                                                  sizeof(_io_buffer)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(in, _io_buffer, BUFFER_SIZE));
+    for (int i = BUFFER_SIZE; i < (int)sizeof(_io_buffer); i++) {
+        TEST_ASSERT_EQUAL_INT(IO_BUFFER_CANARY, _io_buffer[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(1, spscrb_empty(&_rb));
+}
+
+static void test_drop(void)
+{
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(0, spscrb_add_one(&_rb, TEST_INPUT + i));
+    }
+    TEST_ASSERT_EQUAL_INT(TEST_DROP_NUM, spscrb_drop(&_rb, TEST_DROP_NUM));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_DROP_NUM, spscrb_avail(&_rb));
+    TEST_ASSERT_EQUAL_INT(TEST_INPUT + TEST_DROP_NUM, spscrb_get_one(&_rb));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_DROP_NUM - 1,
+                          spscrb_drop(&_rb, sizeof(_io_buffer)));
+    TEST_ASSERT_EQUAL_INT(1, spscrb_empty(&_rb));
+}
+
+static void test_reserve_commit(void)
+{
+    uint8_t *data;
+
+    _set_offset();
+    /* free space ends at the end of the buffer */
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_OFFSET,
+                          spscrb_reserve(&_rb, &data));
+    TEST_ASSERT(data == &_rb_buffer[TEST_OFFSET]);
+    memset(data, TEST_INPUT, 2);
+    TEST_ASSERT_EQUAL_INT(0, spscrb_avail(&_rb));
+    spscrb_commit(&_rb, 2);
+    TEST_ASSERT_EQUAL_INT(2, spscrb_avail(&_rb));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_OFFSET - 2,
+                          spscrb_reserve(&_rb, &data));
+    spscrb_commit(&_rb, BUFFER_SIZE - TEST_OFFSET - 2);
+    /* the rest starts at the beginning */
+    TEST_ASSERT_EQUAL_INT(TEST_OFFSET, spscrb_reserve(&_rb, &data));
+    TEST_ASSERT(data == &_rb_buffer[0]);
+    spscrb_commit(&_rb, TEST_OFFSET);
+    TEST_ASSERT_EQUAL_INT(0, spscrb_reserve(&_rb, &data));
+    TEST_ASSERT_EQUAL_INT(1, spscrb_full(&_rb));
+    TEST_ASSERT_EQUAL_INT(TEST_INPUT, spscrb_get_one(&_rb));
+}
+
+static void test_peek_consume(void)
+{
+    uint8_t *data;
+
+    _set_offset();
+    TEST_ASSERT_EQUAL_INT(0, spscrb_peek(&_rb, &data));
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(0, spscrb_add_one(&_rb, TEST_INPUT + i));
+    }
+    /* data ends at the end of the buffer */
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_OFFSET, spscrb_peek(&_rb, &data));
+    TEST_ASSERT_EQUAL_INT(TEST_INPUT, data[0]);
+    spscrb_consume(&_rb, 1);
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - 1, spscrb_avail(&_rb));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_OFFSET - 1,
+                          spscrb_peek(&_rb, &data));
+    TEST_ASSERT_EQUAL_INT(TEST_INPUT + 1, data[0]);
+    spscrb_consume(&_rb, BUFFER_SIZE - TEST_OFFSET - 1);
+    /* the rest starts at the beginning */
+    TEST_ASSERT_EQUAL_INT(TEST_OFFSET, spscrb_peek(&_rb, &data));
+    TEST_ASSERT(data == &_rb_buffer[0]);
+    TEST_ASSERT_EQUAL_INT(TEST_INPUT + BUFFER_SIZE - TEST_OFFSET, data[0]);
+    spscrb_consume(&_rb, TEST_OFFSET);
+    TEST_ASSERT_EQUAL_INT(1, spscrb_empty(&_rb));
+}
+
+static void test_elems(void)
+{
+    /* 4 bytes each, so 4 of them fit */
+    test_elem_t in[5], out[5];
+
+    memset(in, 0, sizeof(in));
+    memset(out, 0, sizeof(out));
+    for (unsigned i = 0; i < ARRAY_SIZE(in); i++) {
+        in[i].a = 0x1234 + i;
+        in[i].b = i;
+    }
+    _set_offset();
+    TEST_ASSERT_EQUAL_INT(-1, spscrb_get_elem(&_rb, &out[0], sizeof(out[0])));
+    TEST_ASSERT_EQUAL_INT(0, spscrb_add_elem(&_rb, &in[0], sizeof(in[0])));
+    TEST_ASSERT_EQUAL_INT(3, spscrb_add_elems(&_rb, &in[1], 4,
+                                              sizeof(in[0])));
+    TEST_ASSERT_EQUAL_INT(-1, spscrb_add_elem(&_rb, &in[4], sizeof(in[0])));
+    TEST_ASSERT_EQUAL_INT(0, spscrb_get_elem(&_rb, &out[0], sizeof(out[0])));
+    TEST_ASSERT_EQUAL_INT(3, spscrb_get_elems(&_rb, &out[1], 4,
+                                              sizeof(out[0])));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(in, out, 4 * sizeof(in[0])));
+    TEST_ASSERT_EQUAL_INT(1, spscrb_empty(&_rb));
+}
+
+static Test *tests_spscrb_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_empty),
+        new_TestFixture(test_avail_free),
+        new_TestFixture(test_get_one),
+        new_TestFixture(test_add_get_wrap),
+        new_TestFixture(test_drop),
+        new_TestFixture(test_reserve_commit),
+        new_TestFixture(test_peek_consume),
+        new_TestFixture(test_elems),
+    };
+
+    EMB_UNIT_TESTCALLER(spscrb_tests, NULL, tear_down, fixtures);
+
+    return (Test *)&spscrb_tests;
+}
+
+void tests_spscrb(void)
+{
+    TESTS_RUN(tests_spscrb_tests());
+}
+/** @} */
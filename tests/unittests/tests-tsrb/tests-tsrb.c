@@ -11,13 +11,17 @@
  *
  * @file
  */
+#include <inttypes.h>
 #include <stdint.h>
+#include <stdio.h>
 #include <string.h>
 
 #include "embUnit/embUnit.h"
 
 #include "unittests-constants.h"
+#include "spscrb.h"
 #include "tsrb.h"
+#include "xtimer.h"
 #include "tests-tsrb.h"
 
 #define TEST_INPUT          (0xdb)
@@ -25,6 +29,9 @@
 #define BUFFER_SIZE         (16)    /* intentionally not unsigned to easier
                                      * check for implicit casting problems */
 #define IO_BUFFER_CANARY    (0xb8)
+#define SPEED_BUFFER_SIZE   (256U)
+#define SPEED_CHUNK_SIZE    (64U)
+#define SPEED_RUNS          (1000U)
 
 static uint8_t _tsrb_buffer[BUFFER_SIZE];
 static uint8_t _io_buffer[BUFFER_SIZE * 2];
@@ -162,6 +169,53 @@ static void test_add(void)
     }
 }
 
+static uint32_t _tsrb_time(uint8_t *chunk, uint8_t *buf, unsigned *moved)
+{
+    tsrb_t rb;
+
+    tsrb_init(&rb, buf, SPEED_BUFFER_SIZE);
+    *moved = 0;
+    uint32_t start = xtimer_now_usec();
+    for (unsigned i = 0; i < SPEED_RUNS; i++) {
+        tsrb_add(&rb, chunk, SPEED_CHUNK_SIZE);
+        *moved += tsrb_get(&rb, chunk, SPEED_CHUNK_SIZE);
+    }
+    return xtimer_now_usec() - start;
+}
+
+static uint32_t _spscrb_time(uint8_t *chunk, uint8_t *buf, unsigned *moved)
+{
+    spscrb_t rb;
+
+    spscrb_init(&rb, buf, SPEED_BUFFER_SIZE);
+    *moved = 0;
+    uint32_t start = xtimer_now_usec();
+    for (unsigned i = 0; i < SPEED_RUNS; i++) {
+        spscrb_add(&rb, chunk, SPEED_CHUNK_SIZE);
+        *moved += spscrb_get(&rb, chunk, SPEED_CHUNK_SIZE);
+    }
+    return xtimer_now_usec() - start;
+}
+
+/* Compare throughput with the lock-free ringbuffer. */
+static void test_throughput(void)
+{
+    static uint8_t buf[SPEED_BUFFER_SIZE];
+    uint8_t chunk[SPEED_CHUNK_SIZE];
+    unsigned moved;
+
+    memset(chunk, TEST_INPUT, sizeof(chunk));
+    uint32_t tsrb = _tsrb_time(chunk, buf, &moved);
+    TEST_ASSERT_EQUAL_INT(SPEED_RUNS * SPEED_CHUNK_SIZE, moved);
+    uint32_t spscrb = _spscrb_time(chunk, buf, &moved);
+    TEST_ASSERT_EQUAL_INT(SPEED_RUNS * SPEED_CHUNK_SIZE, moved);
+
+    printf("\n%u byte chunks: tsrb %" PRIu32 " ns, spscrb %" PRIu32 " ns\n",
+           SPEED_CHUNK_SIZE,
+           (uint32_t)(((uint64_t)tsrb * 1000) / SPEED_RUNS),
+           (uint32_t)(((uint64_t)spscrb * 1000) / SPEED_RUNS));
+}
+
 static Test *tests_tsrb_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -174,6 +228,7 @@ static Test *tests_tsrb_tests(void)
         new_TestFixture(test_drop),
         new_TestFixture(test_add_one),
         new_TestFixture(test_add),
+        new_TestFixture(test_throughput),
     };
 
     EMB_UNIT_TESTCALLER(tsrb_tests, NULL, tear_down, fixtures);
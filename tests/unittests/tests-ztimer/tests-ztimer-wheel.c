@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2021 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Unittests for the ztimer hashed timer wheel
+ */
+
+#include "ztimer.h"
+#include "ztimer/mock.h"
+#include "ztimer/wheel.h"
+
+#include "embUnit/embUnit.h"
+
+#include "tests-ztimer.h"
+
+#define TIMERS_NUMOF    (24U)
+#define BUCKETS_NUMOF   (8U)
+#define SLOT_SHIFT      (4U)
+
+static ztimer_mock_t zmock;
+static ztimer_wheel_t wheel;
+static ztimer_base_t *buckets[BUCKETS_NUMOF];
+static ztimer_t timers[TIMERS_NUMOF];
+static uint32_t fired_at[TIMERS_NUMOF];
+
+static void cb_record(void *arg)
+{
+    uint32_t *ptr = arg;
+
+    *ptr = ztimer_now(&zmock.super);
+}
+
+static void set_up(void)
+{
+    ztimer_mock_init(&zmock, 32);
+    ztimer_wheel_init(&zmock.super, &wheel, buckets, BUCKETS_NUMOF,
+                      SLOT_SHIFT);
+    for (unsigned i = 0; i < TIMERS_NUMOF; i++) {
+        timers[i] = (ztimer_t){ .callback = cb_record, .arg = &fired_at[i] };
+        fired_at[i] = UINT32_MAX;
+    }
+}
+
+/* offsets within the current slot, a few slots ahead and several wheel
+ * revolutions (8 * 16 ticks) ahead */
+static uint32_t _offset(unsigned i)
+{
+    return 1 + ((i * 37) % 7) + ((i * 53) % 11) * 16 + (i % 3) * 128;
+}
+
+static void test_ztimer_wheel_set(void)
+{
+    ztimer_clock_t *z = &zmock.super;
+
+    ztimer_mock_advance(&zmock, 5);
+    for (unsigned i = 0; i < TIMERS_NUMOF; i++) {
+        ztimer_set(z, &timers[i], _offset(i));
+        TEST_ASSERT(ztimer_is_set(z, &timers[i]));
+    }
+
+    /* advance in odd steps so the slot timer fires in between timers */
+    for (unsigned t = 0; t < 500; t += 3) {
+        ztimer_mock_advance(&zmock, 3);
+    }
+
+    for (unsigned i = 0; i < TIMERS_NUMOF; i++) {
+        TEST_ASSERT_EQUAL_INT(5 + _offset(i), fired_at[i]);
+        TEST_ASSERT(!ztimer_is_set(z, &timers[i]));
+    }
+    TEST_ASSERT(!ztimer_is_set(z, &wheel.slot_timer));
+}
+
+static void test_ztimer_wheel_remove(void)
+{
+    ztimer_clock_t *z = &zmock.super;
+
+    for (unsigned i = 0; i < TIMERS_NUMOF; i++) {
+        ztimer_set(z, &timers[i], _offset(i));
+    }
+    for (unsigned i = 0; i < TIMERS_NUMOF; i += 2) {
+        ztimer_remove(z, &timers[i]);
+        TEST_ASSERT(!ztimer_is_set(z, &timers[i]));
+    }
+    /* re-setting an armed timer moves it */
+    ztimer_set(z, &timers[1], 1000);
+
+    ztimer_mock_advance(&zmock, 999);
+    TEST_ASSERT_EQUAL_INT(UINT32_MAX, fired_at[1]);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(1000, fired_at[1]);
+
+    for (unsigned i = 2; i < TIMERS_NUMOF; i++) {
+        if (i & 1) {
+            TEST_ASSERT_EQUAL_INT(_offset(i), fired_at[i]);
+        }
+        else {
+            TEST_ASSERT_EQUAL_INT(UINT32_MAX, fired_at[i]);
+        }
+    }
+}
+
+static void test_ztimer_wheel_long(void)
+{
+    ztimer_clock_t *z = &zmock.super;
+
+    /* far beyond one revolution and across the 32 bit wrap */
+    ztimer_mock_jump(&zmock, 0xfffff000ul);
+    ztimer_set(z, &timers[0], 0x2000ul);
+    ztimer_set(z, &timers[1], 0x10);
+    ztimer_mock_advance(&zmock, 0x10);
+    TEST_ASSERT_EQUAL_INT(0xfffff010ul, fired_at[1]);
+    ztimer_mock_advance(&zmock, 0x1fef);
+    TEST_ASSERT_EQUAL_INT(UINT32_MAX, fired_at[0]);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(0x1000ul, fired_at[0]);
+}
+
+Test *tests_ztimer_wheel_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_ztimer_wheel_set),
+        new_TestFixture(test_ztimer_wheel_remove),
+        new_TestFixture(test_ztimer_wheel_long),
+    };
+
+    EMB_UNIT_TESTCALLER(ztimer_tests, set_up, NULL, fixtures);
+
+    return (Test *)&ztimer_tests;
+}
+
+/** @} */